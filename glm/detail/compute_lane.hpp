@@ -0,0 +1,868 @@
+/// @ref core
+/// @file glm/detail/compute_lane.hpp
+///
+/// Lanes of the branch free batch kernels of the extensions: a kernel written once on a lane type
+/// runs on scalars, on four float lanes with SSE2 and on eight float lanes with AVX.
+
+#pragma once
+
+#include "../common.hpp"
+#include "../exponential.hpp"
+#include "../trigonometric.hpp"
+#include <cstddef>
+
+namespace glm{
+namespace detail
+{
+	// Operations on scalar lanes, overloaded below for SIMD lanes
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_select(bool c, T a, T b)
+	{
+		return c ? a : b;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_sqrt(T x)
+	{
+		return sqrt(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_rsqrt(T x)
+	{
+		return static_cast<T>(1) / sqrt(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_abs(T x)
+	{
+		return abs(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_max(T a, T b)
+	{
+		return max(a, b);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_min(T a, T b)
+	{
+		return min(a, b);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_floor(T x)
+	{
+		return floor(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_fma(T a, T b, T c)
+	{
+		return a * b + c;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void lane_sincos(T x, T& s, T& c)
+	{
+		s = sin(x);
+		c = cos(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_exp2(T x)
+	{
+		return exp2(x);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_atan2(T y, T x)
+	{
+		return atan(y, x);
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER V lane_dot(V const x[4], V const y[4])
+	{
+		return x[0] * y[0] + x[1] * y[1] + x[2] * y[2] + x[3] * y[3];
+	}
+
+	template<typename V>
+	GLM_FUNC_QUALIFIER void lane_cross(V const x[3], V const y[3], V r[3])
+	{
+		r[0] = x[1] * y[2] - x[2] * y[1];
+		r[1] = x[2] * y[0] - x[0] * y[2];
+		r[2] = x[0] * y[1] - x[1] * y[0];
+	}
+
+	// Components x, y, z, w of the quaternion i
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(qua<T, Q> const* q, std::size_t i, T a[4])
+	{
+		T const* p = reinterpret_cast<T const*>(q + i);
+		for(length_t c = 0; c < 4; ++c)
+			a[c] = p[c];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(T const a[4], std::size_t i, qua<T, Q>* q)
+	{
+		T* p = reinterpret_cast<T*>(q + i);
+		for(length_t c = 0; c < 4; ++c)
+			p[c] = a[c];
+	}
+}//namespace detail
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	// Four float lanes
+	struct lane4
+	{
+		GLM_FUNC_QUALIFIER lane4() {}
+		GLM_FUNC_QUALIFIER explicit lane4(glm_vec4 v) : data(v) {}
+		GLM_FUNC_QUALIFIER explicit lane4(double x) : data(_mm_set1_ps(static_cast<float>(x))) {}
+
+		glm_vec4 data;
+	};
+
+	struct lane_mask4
+	{
+		GLM_FUNC_QUALIFIER explicit lane_mask4(glm_vec4 v) : data(v) {}
+
+		glm_vec4 data;
+	};
+
+	GLM_FUNC_QUALIFIER lane4 operator+(lane4 const& a, lane4 const& b) { return lane4(_mm_add_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane4 operator-(lane4 const& a, lane4 const& b) { return lane4(_mm_sub_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane4 operator*(lane4 const& a, lane4 const& b) { return lane4(_mm_mul_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane4 operator/(lane4 const& a, lane4 const& b) { return lane4(_mm_div_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane4 operator-(lane4 const& a) { return lane4(_mm_xor_ps(a.data, _mm_set1_ps(-0.0f))); }
+	GLM_FUNC_QUALIFIER lane_mask4 operator<(lane4 const& a, lane4 const& b) { return lane_mask4(_mm_cmplt_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane_mask4 operator>(lane4 const& a, lane4 const& b) { return lane_mask4(_mm_cmpgt_ps(a.data, b.data)); }
+
+	GLM_FUNC_QUALIFIER lane4 lane_select(lane_mask4 const& c, lane4 const& a, lane4 const& b)
+	{
+#		if GLM_ARCH & GLM_ARCH_SSE41_BIT
+			return lane4(_mm_blendv_ps(b.data, a.data, c.data));
+#		else
+			return lane4(_mm_or_ps(_mm_and_ps(c.data, a.data), _mm_andnot_ps(c.data, b.data)));
+#		endif
+	}
+
+	GLM_FUNC_QUALIFIER lane4 lane_sqrt(lane4 const& x) { return lane4(_mm_sqrt_ps(x.data)); }
+	// Approximation refined by a Newton-Raphson step, about 23 bits and much shorter latency than a division
+	GLM_FUNC_QUALIFIER lane4 lane_rsqrt(lane4 const& x)
+	{
+		glm_vec4 const y = _mm_rsqrt_ps(x.data);
+		glm_vec4 const yyx = _mm_mul_ps(_mm_mul_ps(y, y), x.data);
+		return lane4(_mm_mul_ps(_mm_mul_ps(_mm_set1_ps(0.5f), y), _mm_sub_ps(_mm_set1_ps(3.0f), yyx)));
+	}
+	GLM_FUNC_QUALIFIER lane4 lane_abs(lane4 const& x) { return lane4(_mm_andnot_ps(_mm_set1_ps(-0.0f), x.data)); }
+	GLM_FUNC_QUALIFIER lane4 lane_max(lane4 const& a, lane4 const& b) { return lane4(_mm_max_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane4 lane_min(lane4 const& a, lane4 const& b) { return lane4(_mm_min_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane4 lane_floor(lane4 const& x) { return lane4(glm_vec4_floor(x.data)); }
+	GLM_FUNC_QUALIFIER lane4 lane_fma(lane4 const& a, lane4 const& b, lane4 const& c) { return lane4(glm_vec4_fma(a.data, b.data, c.data)); }
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Eight float lanes
+	struct lane8
+	{
+		GLM_FUNC_QUALIFIER lane8() {}
+		GLM_FUNC_QUALIFIER explicit lane8(__m256 v) : data(v) {}
+		GLM_FUNC_QUALIFIER explicit lane8(double x) : data(_mm256_set1_ps(static_cast<float>(x))) {}
+
+		// Copied as a whole register, GCC copies the trivial aggregate in halves which defeats the store to load forwarding
+		GLM_FUNC_QUALIFIER lane8(lane8 const& v) : data(v.data) {}
+		GLM_FUNC_QUALIFIER lane8& operator=(lane8 const& v) { data = v.data; return *this; }
+
+		__m256 data;
+	};
+
+	struct lane_mask8
+	{
+		GLM_FUNC_QUALIFIER explicit lane_mask8(__m256 v) : data(v) {}
+
+		__m256 data;
+	};
+
+	GLM_FUNC_QUALIFIER lane8 operator+(lane8 const& a, lane8 const& b) { return lane8(_mm256_add_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane8 operator-(lane8 const& a, lane8 const& b) { return lane8(_mm256_sub_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane8 operator*(lane8 const& a, lane8 const& b) { return lane8(_mm256_mul_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane8 operator/(lane8 const& a, lane8 const& b) { return lane8(_mm256_div_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane8 operator-(lane8 const& a) { return lane8(_mm256_xor_ps(a.data, _mm256_set1_ps(-0.0f))); }
+	GLM_FUNC_QUALIFIER lane_mask8 operator<(lane8 const& a, lane8 const& b) { return lane_mask8(_mm256_cmp_ps(a.data, b.data, _CMP_LT_OQ)); }
+	GLM_FUNC_QUALIFIER lane_mask8 operator>(lane8 const& a, lane8 const& b) { return lane_mask8(_mm256_cmp_ps(a.data, b.data, _CMP_GT_OQ)); }
+
+	GLM_FUNC_QUALIFIER lane8 lane_select(lane_mask8 const& c, lane8 const& a, lane8 const& b) { return lane8(_mm256_blendv_ps(b.data, a.data, c.data)); }
+	GLM_FUNC_QUALIFIER lane8 lane_sqrt(lane8 const& x) { return lane8(_mm256_sqrt_ps(x.data)); }
+	GLM_FUNC_QUALIFIER lane8 lane_rsqrt(lane8 const& x)
+	{
+		__m256 const y = _mm256_rsqrt_ps(x.data);
+		__m256 const yyx = _mm256_mul_ps(_mm256_mul_ps(y, y), x.data);
+		return lane8(_mm256_mul_ps(_mm256_mul_ps(_mm256_set1_ps(0.5f), y), _mm256_sub_ps(_mm256_set1_ps(3.0f), yyx)));
+	}
+	GLM_FUNC_QUALIFIER lane8 lane_abs(lane8 const& x) { return lane8(_mm256_andnot_ps(_mm256_set1_ps(-0.0f), x.data)); }
+	GLM_FUNC_QUALIFIER lane8 lane_max(lane8 const& a, lane8 const& b) { return lane8(_mm256_max_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane8 lane_min(lane8 const& a, lane8 const& b) { return lane8(_mm256_min_ps(a.data, b.data)); }
+	GLM_FUNC_QUALIFIER lane8 lane_floor(lane8 const& x) { return lane8(_mm256_floor_ps(x.data)); }
+
+	GLM_FUNC_QUALIFIER lane8 lane_fma(lane8 const& a, lane8 const& b, lane8 const& c)
+	{
+#		if (GLM_ARCH & GLM_ARCH_AVX2_BIT) && !(GLM_COMPILER & GLM_COMPILER_CLANG)
+			return lane8(_mm256_fmadd_ps(a.data, b.data, c.data));
+#		else
+			return a * b + c;
+#		endif
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// acos(x) for x in [-1, 1] with the polynomial of Abramowitz and Stegun 4.4.46, about 2e-8 absolute error
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER V lane_acos_polynomial(V const& x)
+	{
+		V const a = lane_abs(x);
+		V p(-0.0012624911);
+		p = p * a + V(0.0066700901);
+		p = p * a + V(-0.0170881256);
+		p = p * a + V(0.0308918810);
+		p = p * a + V(-0.0501743046);
+		p = p * a + V(0.0889789874);
+		p = p * a + V(-0.2145988016);
+		p = p * a + V(1.5707963050);
+		V const Acos = lane_sqrt(V(1) - a) * p;
+		M const Negative = x < V(0);
+		return lane_select(Negative, V(3.14159265358979323846) - Acos, Acos);
+	}
+
+	// sin(x) for x in [-pi / 2, pi / 2] with the Taylor series up to the 11th degree, about 6e-8 absolute error
+	template<typename V>
+	GLM_FUNC_QUALIFIER V lane_sin_polynomial(V const& x)
+	{
+		V const x2 = x * x;
+		V s(-1.0 / 39916800.0);
+		s = s * x2 + V(1.0 / 362880.0);
+		s = s * x2 + V(-1.0 / 5040.0);
+		s = s * x2 + V(1.0 / 120.0);
+		s = s * x2 + V(-1.0 / 6.0);
+		return (s * x2 + V(1)) * x;
+	}
+
+	// sin(x) and cos(x) reduced to [-pi / 2, pi / 2] by the nearest multiple n of pi, both change sign when n is odd.
+	// pi is split in three parts so that the reduction is exact for |x| < 10000, about 2e-7 absolute error.
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER void lane_sincos_polynomial(V const& x, V& s, V& c)
+	{
+		// Adding and subtracting 1.5 * 2^23 rounds to the nearest integer
+		V const Round(12582912.0);
+		V const n = (x * V(0.31830988618379067154) + Round) - Round;
+		V const r = ((x - n * V(3.140625)) - n * V(9.675025939941406e-4)) - n * V(1.509958025280866e-7);
+		V const h = n * V(0.5);
+		M const Odd = lane_abs(h - ((h + Round) - Round)) > V(0.25);
+
+		V const r2 = r * r;
+		V p(1.0 / 479001600.0);
+		p = p * r2 + V(-1.0 / 3628800.0);
+		p = p * r2 + V(1.0 / 40320.0);
+		p = p * r2 + V(-1.0 / 720.0);
+		p = p * r2 + V(1.0 / 24.0);
+		p = p * r2 + V(-0.5);
+		V const Cos = p * r2 + V(1);
+		V const Sin = lane_sin_polynomial(r);
+
+		s = lane_select(Odd, -Sin, Sin);
+		c = lane_select(Odd, -Cos, Cos);
+	}
+
+	// atan2(y, x) with the polynomial of atan of Cephes on [0, tan(pi / 8)], about 3e-7 absolute error, atan2(0, 0) is 0
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER V lane_atan2_polynomial(V const& y, V const& x)
+	{
+		V const AbsX = lane_abs(x);
+		V const AbsY = lane_abs(y);
+		V const Max = lane_max(AbsX, AbsY);
+		V const Min = lane_min(AbsX, AbsY);
+
+		// atan(t) = pi / 4 + atan((t - 1) / (t + 1)) above tan(pi / 8)
+		M const Reduce = Min > Max * V(0.41421356237309504880);
+		V const t = lane_select(Reduce, Min - Max, Min) / lane_max(lane_select(Reduce, Min + Max, Max), V(1e-30));
+		V const t2 = t * t;
+		V p(8.05374449538e-2);
+		p = p * t2 + V(-1.38776856032e-1);
+		p = p * t2 + V(1.99777106478e-1);
+		p = p * t2 + V(-3.33329491539e-1);
+		V a = p * t2 * t + t;
+		a = lane_select(Reduce, a + V(0.78539816339744830962), a);
+
+		a = lane_select(AbsY > AbsX, V(1.57079632679489661923) - a, a);
+		a = lane_select(x < V(0), V(3.14159265358979323846) - a, a);
+		return lane_select(y < V(0), -a, a);
+	}
+
+	// 2^x as 2^n * 2^f with n the nearest integer and the Taylor series of 2^f for f in [-0.5, 0.5] up to the 6th degree,
+	// about 2e-7 relative error. x is clamped to [-126, 126] and 2^n is built in the exponent bits of a float.
+	template<typename V>
+	GLM_FUNC_QUALIFIER V lane_exp2_polynomial(V const& x, V& n)
+	{
+		V const Round(12582912.0);
+		V const Clamped = lane_min(lane_max(x, V(-126.0)), V(126.0));
+		n = (Clamped + Round) - Round;
+
+		V const f = Clamped - n;
+		V p(1.5403530393381606e-4);
+		p = p * f + V(1.3333558146428443e-3);
+		p = p * f + V(9.6181291076284772e-3);
+		p = p * f + V(5.5504108664821580e-2);
+		p = p * f + V(2.4022650695910071e-1);
+		p = p * f + V(6.9314718055994531e-1);
+		return p * f + V(1);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_sincos(lane4 const& x, lane4& s, lane4& c)
+	{
+		lane_sincos_polynomial<lane4, lane_mask4>(x, s, c);
+	}
+
+	GLM_FUNC_QUALIFIER lane4 lane_exp2(lane4 const& x)
+	{
+		lane4 n;
+		lane4 const p = lane_exp2_polynomial(x, n);
+		lane4 const Bits = (n + lane4(127.0)) * lane4(8388608.0);
+		return p * lane4(_mm_castsi128_ps(_mm_cvtps_epi32(Bits.data)));
+	}
+
+	GLM_FUNC_QUALIFIER lane4 lane_atan2(lane4 const& y, lane4 const& x)
+	{
+		return lane_atan2_polynomial<lane4, lane_mask4>(y, x);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER void lane_sincos(lane8 const& x, lane8& s, lane8& c)
+	{
+		lane_sincos_polynomial<lane8, lane_mask8>(x, s, c);
+	}
+
+	GLM_FUNC_QUALIFIER lane8 lane_exp2(lane8 const& x)
+	{
+		lane8 n;
+		lane8 const p = lane_exp2_polynomial(x, n);
+		lane8 const Bits = (n + lane8(127.0)) * lane8(8388608.0);
+		return p * lane8(_mm256_castsi256_ps(_mm256_cvtps_epi32(Bits.data)));
+	}
+
+	GLM_FUNC_QUALIFIER lane8 lane_atan2(lane8 const& y, lane8 const& x)
+	{
+		return lane_atan2_polynomial<lane8, lane_mask8>(y, x);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// Lanes of the floats [i, i + 4) or [i, i + 8)
+	GLM_FUNC_QUALIFIER void lane_load(float const* p, std::size_t i, lane4& a)
+	{
+		a = lane4(_mm_loadu_ps(p + i));
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store(lane4 const& a, std::size_t i, float* p)
+	{
+		_mm_storeu_ps(p + i, a.data);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER void lane_load(float const* p, std::size_t i, lane8& a)
+	{
+		a = lane8(_mm256_loadu_ps(p + i));
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store(lane8 const& a, std::size_t i, float* p)
+	{
+		_mm256_storeu_ps(p + i, a.data);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// Gather the matrices or vectors [i, i + 4) or [i, i + 8) into lanes and scatter the results back
+	template<length_t C, length_t R, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(mat<C, R, float, Q> const* m, std::size_t i, lane4 a[C][R])
+	{
+		for(length_t c = 0; c < C; ++c)
+		for(length_t r = 0; r < R; ++r)
+			a[c][r] = lane4(_mm_setr_ps(m[i][c][r], m[i + 1][c][r], m[i + 2][c][r], m[i + 3][c][r]));
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(vec<L, float, Q> const* v, std::size_t i, lane4 a[L])
+	{
+		for(length_t c = 0; c < L; ++c)
+			a[c] = lane4(_mm_setr_ps(v[i][c], v[i + 1][c], v[i + 2][c], v[i + 3][c]));
+	}
+
+	template<length_t C, length_t R, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane4 const a[C][R], std::size_t i, mat<C, R, float, Q>* m)
+	{
+		for(length_t c = 0; c < C; ++c)
+		for(length_t r = 0; r < R; ++r)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a[c][r].data);
+			for(std::size_t j = 0; j < 4; ++j)
+				m[i + j][c][r] = Lanes[j];
+		}
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane4 const a[L], std::size_t i, vec<L, float, Q>* v)
+	{
+		for(length_t c = 0; c < L; ++c)
+		{
+			float Lanes[4];
+			_mm_storeu_ps(Lanes, a[c].data);
+			for(std::size_t j = 0; j < 4; ++j)
+				v[i + j][c] = Lanes[j];
+		}
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	template<length_t C, length_t R, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(mat<C, R, float, Q> const* m, std::size_t i, lane8 a[C][R])
+	{
+		for(length_t c = 0; c < C; ++c)
+		for(length_t r = 0; r < R; ++r)
+			a[c][r] = lane8(_mm256_setr_ps(
+				m[i][c][r], m[i + 1][c][r], m[i + 2][c][r], m[i + 3][c][r],
+				m[i + 4][c][r], m[i + 5][c][r], m[i + 6][c][r], m[i + 7][c][r]));
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(vec<L, float, Q> const* v, std::size_t i, lane8 a[L])
+	{
+		for(length_t c = 0; c < L; ++c)
+			a[c] = lane8(_mm256_setr_ps(
+				v[i][c], v[i + 1][c], v[i + 2][c], v[i + 3][c],
+				v[i + 4][c], v[i + 5][c], v[i + 6][c], v[i + 7][c]));
+	}
+
+	template<length_t C, length_t R, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane8 const a[C][R], std::size_t i, mat<C, R, float, Q>* m)
+	{
+		for(length_t c = 0; c < C; ++c)
+		for(length_t r = 0; r < R; ++r)
+		{
+			float Lanes[8];
+			_mm256_storeu_ps(Lanes, a[c][r].data);
+			for(std::size_t j = 0; j < 8; ++j)
+				m[i + j][c][r] = Lanes[j];
+		}
+	}
+
+	template<length_t L, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane8 const a[L], std::size_t i, vec<L, float, Q>* v)
+	{
+		for(length_t c = 0; c < L; ++c)
+		{
+			float Lanes[8];
+			_mm256_storeu_ps(Lanes, a[c].data);
+			for(std::size_t j = 0; j < 8; ++j)
+				v[i + j][c] = Lanes[j];
+		}
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	// Packed 3x3 matrices are gathered and scattered as two transposed blocks of four elements and a last element
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(mat<3, 3, float, Q> const* m, std::size_t i, lane4 a[3][3])
+	{
+		if(sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9)
+		{
+			float const* p = &m[i][0].x;
+			glm_vec4 r0 = _mm_loadu_ps(p);
+			glm_vec4 r1 = _mm_loadu_ps(p + 9);
+			glm_vec4 r2 = _mm_loadu_ps(p + 18);
+			glm_vec4 r3 = _mm_loadu_ps(p + 27);
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			glm_vec4 s0 = _mm_loadu_ps(p + 4);
+			glm_vec4 s1 = _mm_loadu_ps(p + 13);
+			glm_vec4 s2 = _mm_loadu_ps(p + 22);
+			glm_vec4 s3 = _mm_loadu_ps(p + 31);
+			_MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+			a[0][0] = lane4(r0);
+			a[0][1] = lane4(r1);
+			a[0][2] = lane4(r2);
+			a[1][0] = lane4(r3);
+			a[1][1] = lane4(s0);
+			a[1][2] = lane4(s1);
+			a[2][0] = lane4(s2);
+			a[2][1] = lane4(s3);
+			a[2][2] = lane4(_mm_setr_ps(p[8], p[17], p[26], p[35]));
+		}
+		else
+		{
+			for(length_t c = 0; c < 3; ++c)
+			for(length_t r = 0; r < 3; ++r)
+				a[c][r] = lane4(_mm_setr_ps(m[i][c][r], m[i + 1][c][r], m[i + 2][c][r], m[i + 3][c][r]));
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane4 const a[3][3], std::size_t i, mat<3, 3, float, Q>* m)
+	{
+		if(sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9)
+		{
+			float* p = &m[i][0].x;
+			glm_vec4 r0 = a[0][0].data;
+			glm_vec4 r1 = a[0][1].data;
+			glm_vec4 r2 = a[0][2].data;
+			glm_vec4 r3 = a[1][0].data;
+			_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+			glm_vec4 s0 = a[1][1].data;
+			glm_vec4 s1 = a[1][2].data;
+			glm_vec4 s2 = a[2][0].data;
+			glm_vec4 s3 = a[2][1].data;
+			_MM_TRANSPOSE4_PS(s0, s1, s2, s3);
+			glm_vec4 const Last = a[2][2].data;
+			_mm_storeu_ps(p, r0);
+			_mm_storeu_ps(p + 4, s0);
+			_mm_store_ss(p + 8, Last);
+			_mm_storeu_ps(p + 9, r1);
+			_mm_storeu_ps(p + 13, s1);
+			_mm_store_ss(p + 17, _mm_shuffle_ps(Last, Last, _MM_SHUFFLE(1, 1, 1, 1)));
+			_mm_storeu_ps(p + 18, r2);
+			_mm_storeu_ps(p + 22, s2);
+			_mm_store_ss(p + 26, _mm_shuffle_ps(Last, Last, _MM_SHUFFLE(2, 2, 2, 2)));
+			_mm_storeu_ps(p + 27, r3);
+			_mm_storeu_ps(p + 31, s3);
+			_mm_store_ss(p + 35, _mm_shuffle_ps(Last, Last, _MM_SHUFFLE(3, 3, 3, 3)));
+		}
+		else
+		{
+			for(length_t c = 0; c < 3; ++c)
+			for(length_t r = 0; r < 3; ++r)
+			{
+				float Lanes[4];
+				_mm_storeu_ps(Lanes, a[c][r].data);
+				for(std::size_t j = 0; j < 4; ++j)
+					m[i + j][c][r] = Lanes[j];
+			}
+		}
+	}
+
+	// Matrices with four rows are gathered and scattered with a transpose per column
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load_column(mat<C, 4, float, Q> const* m, std::size_t i, length_t c, lane4 a[4])
+	{
+		float const* p = reinterpret_cast<float const*>(m + i);
+		glm_vec4 r0 = _mm_loadu_ps(p + 4 * c);
+		glm_vec4 r1 = _mm_loadu_ps(p + 4 * (C + c));
+		glm_vec4 r2 = _mm_loadu_ps(p + 4 * (2 * C + c));
+		glm_vec4 r3 = _mm_loadu_ps(p + 4 * (3 * C + c));
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		a[0] = lane4(r0);
+		a[1] = lane4(r1);
+		a[2] = lane4(r2);
+		a[3] = lane4(r3);
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store_column(lane4 const a[4], std::size_t i, length_t c, mat<C, 4, float, Q>* m)
+	{
+		float* p = reinterpret_cast<float*>(m + i);
+		glm_vec4 r0 = a[0].data;
+		glm_vec4 r1 = a[1].data;
+		glm_vec4 r2 = a[2].data;
+		glm_vec4 r3 = a[3].data;
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		_mm_storeu_ps(p + 4 * c, r0);
+		_mm_storeu_ps(p + 4 * (C + c), r1);
+		_mm_storeu_ps(p + 4 * (2 * C + c), r2);
+		_mm_storeu_ps(p + 4 * (3 * C + c), r3);
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(mat<C, 4, float, Q> const* m, std::size_t i, lane4 a[C][4])
+	{
+		for(length_t c = 0; c < C; ++c)
+			lane_load_column(m, i, c, a[c]);
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane4 const a[C][4], std::size_t i, mat<C, 4, float, Q>* m)
+	{
+		for(length_t c = 0; c < C; ++c)
+			lane_store_column(a[c], i, c, m);
+	}
+
+	// Gather the quaternions [i, i + 4) or [i, i + 8) into lanes of their components x, y, z, w and scatter the results back
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(qua<float, Q> const* q, std::size_t i, lane4 a[4])
+	{
+		float const* p = reinterpret_cast<float const*>(q + i);
+		glm_vec4 r0 = _mm_loadu_ps(p);
+		glm_vec4 r1 = _mm_loadu_ps(p + 4);
+		glm_vec4 r2 = _mm_loadu_ps(p + 8);
+		glm_vec4 r3 = _mm_loadu_ps(p + 12);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		a[0] = lane4(r0);
+		a[1] = lane4(r1);
+		a[2] = lane4(r2);
+		a[3] = lane4(r3);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane4 const a[4], std::size_t i, qua<float, Q>* q)
+	{
+		float* p = reinterpret_cast<float*>(q + i);
+		glm_vec4 r0 = a[0].data;
+		glm_vec4 r1 = a[1].data;
+		glm_vec4 r2 = a[2].data;
+		glm_vec4 r3 = a[3].data;
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		_mm_storeu_ps(p, r0);
+		_mm_storeu_ps(p + 4, r1);
+		_mm_storeu_ps(p + 8, r2);
+		_mm_storeu_ps(p + 12, r3);
+	}
+
+	// Gather the four floats at p[j] + offset for the lanes j, for instance the quaternions of indexed bones
+	GLM_FUNC_QUALIFIER void lane_gather(float const* const p[4], std::size_t offset, lane4 a[4])
+	{
+		glm_vec4 r0 = _mm_loadu_ps(p[0] + offset);
+		glm_vec4 r1 = _mm_loadu_ps(p[1] + offset);
+		glm_vec4 r2 = _mm_loadu_ps(p[2] + offset);
+		glm_vec4 r3 = _mm_loadu_ps(p[3] + offset);
+		_MM_TRANSPOSE4_PS(r0, r1, r2, r3);
+		a[0] = lane4(r0);
+		a[1] = lane4(r1);
+		a[2] = lane4(r2);
+		a[3] = lane4(r3);
+	}
+
+	// Gather or scatter the float at p[j] + offset for the lanes j, for instance a component of strided vertices
+	GLM_FUNC_QUALIFIER void lane_gather(float const* const p[4], std::size_t offset, lane4& a)
+	{
+		a = lane4(_mm_setr_ps(p[0][offset], p[1][offset], p[2][offset], p[3][offset]));
+	}
+
+	GLM_FUNC_QUALIFIER void lane_scatter(lane4 const& a, std::size_t offset, float* const p[4])
+	{
+		float Lanes[4];
+		_mm_storeu_ps(Lanes, a.data);
+		for(std::size_t j = 0; j < 4; ++j)
+			p[j][offset] = Lanes[j];
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	// Transpose the 4x4 blocks of both 128 bits halves
+	GLM_FUNC_QUALIFIER void lane_transpose(__m256& r0, __m256& r1, __m256& r2, __m256& r3)
+	{
+		__m256 const t0 = _mm256_unpacklo_ps(r0, r1);
+		__m256 const t1 = _mm256_unpackhi_ps(r0, r1);
+		__m256 const t2 = _mm256_unpacklo_ps(r2, r3);
+		__m256 const t3 = _mm256_unpackhi_ps(r2, r3);
+		r0 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(1, 0, 1, 0));
+		r1 = _mm256_shuffle_ps(t0, t2, _MM_SHUFFLE(3, 2, 3, 2));
+		r2 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(1, 0, 1, 0));
+		r3 = _mm256_shuffle_ps(t1, t3, _MM_SHUFFLE(3, 2, 3, 2));
+	}
+
+	// The elements j and j + 4, stride floats apart, share a row of the transposes
+	GLM_FUNC_QUALIFIER __m256 lane_load_pair(float const* p, std::size_t stride)
+	{
+		return _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p)), _mm_loadu_ps(p + stride), 1);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_store_pair(float* p, std::size_t stride, __m256 v)
+	{
+		_mm_storeu_ps(p, _mm256_castps256_ps128(v));
+		_mm_storeu_ps(p + stride, _mm256_extractf128_ps(v, 1));
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(qua<float, Q> const* q, std::size_t i, lane8 a[4])
+	{
+		float const* p = reinterpret_cast<float const*>(q + i);
+		__m256 r0 = lane_load_pair(p, 16);
+		__m256 r1 = lane_load_pair(p + 4, 16);
+		__m256 r2 = lane_load_pair(p + 8, 16);
+		__m256 r3 = lane_load_pair(p + 12, 16);
+		lane_transpose(r0, r1, r2, r3);
+		a[0] = lane8(r0);
+		a[1] = lane8(r1);
+		a[2] = lane8(r2);
+		a[3] = lane8(r3);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane8 const a[4], std::size_t i, qua<float, Q>* q)
+	{
+		float* p = reinterpret_cast<float*>(q + i);
+		__m256 r0 = a[0].data;
+		__m256 r1 = a[1].data;
+		__m256 r2 = a[2].data;
+		__m256 r3 = a[3].data;
+		lane_transpose(r0, r1, r2, r3);
+		lane_store_pair(p, 16, r0);
+		lane_store_pair(p + 4, 16, r1);
+		lane_store_pair(p + 8, 16, r2);
+		lane_store_pair(p + 12, 16, r3);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(mat<3, 3, float, Q> const* m, std::size_t i, lane8 a[3][3])
+	{
+		if(sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9)
+		{
+			float const* p = &m[i][0].x;
+			__m256 r0 = lane_load_pair(p, 36);
+			__m256 r1 = lane_load_pair(p + 9, 36);
+			__m256 r2 = lane_load_pair(p + 18, 36);
+			__m256 r3 = lane_load_pair(p + 27, 36);
+			lane_transpose(r0, r1, r2, r3);
+			__m256 s0 = lane_load_pair(p + 4, 36);
+			__m256 s1 = lane_load_pair(p + 13, 36);
+			__m256 s2 = lane_load_pair(p + 22, 36);
+			__m256 s3 = lane_load_pair(p + 31, 36);
+			lane_transpose(s0, s1, s2, s3);
+			a[0][0] = lane8(r0);
+			a[0][1] = lane8(r1);
+			a[0][2] = lane8(r2);
+			a[1][0] = lane8(r3);
+			a[1][1] = lane8(s0);
+			a[1][2] = lane8(s1);
+			a[2][0] = lane8(s2);
+			a[2][1] = lane8(s3);
+			a[2][2] = lane8(_mm256_setr_ps(p[8], p[17], p[26], p[35], p[44], p[53], p[62], p[71]));
+		}
+		else
+		{
+			for(length_t c = 0; c < 3; ++c)
+			for(length_t r = 0; r < 3; ++r)
+				a[c][r] = lane8(_mm256_setr_ps(
+					m[i][c][r], m[i + 1][c][r], m[i + 2][c][r], m[i + 3][c][r],
+					m[i + 4][c][r], m[i + 5][c][r], m[i + 6][c][r], m[i + 7][c][r]));
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane8 const a[3][3], std::size_t i, mat<3, 3, float, Q>* m)
+	{
+		if(sizeof(mat<3, 3, float, Q>) == sizeof(float) * 9)
+		{
+			float* p = &m[i][0].x;
+			__m256 r0 = a[0][0].data;
+			__m256 r1 = a[0][1].data;
+			__m256 r2 = a[0][2].data;
+			__m256 r3 = a[1][0].data;
+			lane_transpose(r0, r1, r2, r3);
+			__m256 s0 = a[1][1].data;
+			__m256 s1 = a[1][2].data;
+			__m256 s2 = a[2][0].data;
+			__m256 s3 = a[2][1].data;
+			lane_transpose(s0, s1, s2, s3);
+			lane_store_pair(p, 36, r0);
+			lane_store_pair(p + 4, 36, s0);
+			lane_store_pair(p + 9, 36, r1);
+			lane_store_pair(p + 13, 36, s1);
+			lane_store_pair(p + 18, 36, r2);
+			lane_store_pair(p + 22, 36, s2);
+			lane_store_pair(p + 27, 36, r3);
+			lane_store_pair(p + 31, 36, s3);
+			float Last[8];
+			_mm256_storeu_ps(Last, a[2][2].data);
+			for(std::size_t j = 0; j < 8; ++j)
+				p[j * 9 + 8] = Last[j];
+		}
+		else
+		{
+			for(length_t c = 0; c < 3; ++c)
+			for(length_t r = 0; r < 3; ++r)
+			{
+				float Lanes[8];
+				_mm256_storeu_ps(Lanes, a[c][r].data);
+				for(std::size_t j = 0; j < 8; ++j)
+					m[i + j][c][r] = Lanes[j];
+			}
+		}
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load_column(mat<C, 4, float, Q> const* m, std::size_t i, length_t c, lane8 a[4])
+	{
+		float const* p = reinterpret_cast<float const*>(m + i);
+		std::size_t const Stride = 16 * C;
+		__m256 r0 = lane_load_pair(p + 4 * c, Stride);
+		__m256 r1 = lane_load_pair(p + 4 * (C + c), Stride);
+		__m256 r2 = lane_load_pair(p + 4 * (2 * C + c), Stride);
+		__m256 r3 = lane_load_pair(p + 4 * (3 * C + c), Stride);
+		lane_transpose(r0, r1, r2, r3);
+		a[0] = lane8(r0);
+		a[1] = lane8(r1);
+		a[2] = lane8(r2);
+		a[3] = lane8(r3);
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store_column(lane8 const a[4], std::size_t i, length_t c, mat<C, 4, float, Q>* m)
+	{
+		float* p = reinterpret_cast<float*>(m + i);
+		std::size_t const Stride = 16 * C;
+		__m256 r0 = a[0].data;
+		__m256 r1 = a[1].data;
+		__m256 r2 = a[2].data;
+		__m256 r3 = a[3].data;
+		lane_transpose(r0, r1, r2, r3);
+		lane_store_pair(p + 4 * c, Stride, r0);
+		lane_store_pair(p + 4 * (C + c), Stride, r1);
+		lane_store_pair(p + 4 * (2 * C + c), Stride, r2);
+		lane_store_pair(p + 4 * (3 * C + c), Stride, r3);
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_load(mat<C, 4, float, Q> const* m, std::size_t i, lane8 a[C][4])
+	{
+		for(length_t c = 0; c < C; ++c)
+			lane_load_column(m, i, c, a[c]);
+	}
+
+	template<length_t C, qualifier Q>
+	GLM_FUNC_QUALIFIER void lane_store(lane8 const a[C][4], std::size_t i, mat<C, 4, float, Q>* m)
+	{
+		for(length_t c = 0; c < C; ++c)
+			lane_store_column(a[c], i, c, m);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_gather(float const* const p[8], std::size_t offset, lane8 a[4])
+	{
+		__m256 r0 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[0] + offset)), _mm_loadu_ps(p[4] + offset), 1);
+		__m256 r1 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[1] + offset)), _mm_loadu_ps(p[5] + offset), 1);
+		__m256 r2 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[2] + offset)), _mm_loadu_ps(p[6] + offset), 1);
+		__m256 r3 = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(p[3] + offset)), _mm_loadu_ps(p[7] + offset), 1);
+		lane_transpose(r0, r1, r2, r3);
+		a[0] = lane8(r0);
+		a[1] = lane8(r1);
+		a[2] = lane8(r2);
+		a[3] = lane8(r3);
+	}
+
+	GLM_FUNC_QUALIFIER void lane_gather(float const* const p[8], std::size_t offset, lane8& a)
+	{
+		a = lane8(_mm256_setr_ps(
+			p[0][offset], p[1][offset], p[2][offset], p[3][offset],
+			p[4][offset], p[5][offset], p[6][offset], p[7][offset]));
+	}
+
+	GLM_FUNC_QUALIFIER void lane_scatter(lane8 const& a, std::size_t offset, float* const p[8])
+	{
+		float Lanes[8];
+		_mm256_storeu_ps(Lanes, a.data);
+		for(std::size_t j = 0; j < 8; ++j)
+			p[j][offset] = Lanes[j];
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_CONFIG_SIMD == GLM_ENABLE && (GLM_ARCH & GLM_ARCH_SSE2_BIT)
@@ -1,6 +1,27 @@
 /// @ref core
 
-namespace glm
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
 {
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	template<qualifier Q>
+	struct compute_mat4_mul<float, Q, true>
+	{
+		GLM_STATIC_ASSERT(detail::is_aligned<Q>::value, "Specialization requires aligned");
 
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m1, mat<4, 4, float, Q> const& m2)
+		{
+			mat<4, 4, float, Q> Result;
+			glm_mat4_mul(&m1[0].data, &m2[0].data, &Result[0].data);
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
 }//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
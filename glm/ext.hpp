@@ -135,32 +135,40 @@
 #endif
 
 #ifdef GLM_ENABLE_EXPERIMENTAL
+#include "./gtx/affine.hpp"
 #include "./gtx/associated_min_max.hpp"
 #include "./gtx/bit.hpp"
+#include "./gtx/bvh.hpp"
 #include "./gtx/closest_point.hpp"
 #include "./gtx/color_encoding.hpp"
 #include "./gtx/color_space.hpp"
 #include "./gtx/color_space_YCoCg.hpp"
 #include "./gtx/compatibility.hpp"
 #include "./gtx/component_wise.hpp"
+#include "./gtx/covariance.hpp"
 #include "./gtx/dual_quaternion.hpp"
 #include "./gtx/euler_angles.hpp"
+#include "./gtx/euler_angles_batch.hpp"
 #include "./gtx/extend.hpp"
 #include "./gtx/extended_min_max.hpp"
 #include "./gtx/fast_exponential.hpp"
 #include "./gtx/fast_square_root.hpp"
 #include "./gtx/fast_trigonometry.hpp"
+#include "./gtx/frustum.hpp"
 #include "./gtx/functions.hpp"
 #include "./gtx/gradient_paint.hpp"
 #include "./gtx/handed_coordinate_space.hpp"
 #include "./gtx/integer.hpp"
 #include "./gtx/intersect.hpp"
+#include "./gtx/keyframe.hpp"
 #include "./gtx/log_base.hpp"
+#include "./gtx/matrix_batch.hpp"
 #include "./gtx/matrix_cross_product.hpp"
 #include "./gtx/matrix_interpolation.hpp"
 #include "./gtx/matrix_major_storage.hpp"
 #include "./gtx/matrix_operation.hpp"
 #include "./gtx/matrix_query.hpp"
+#include "./gtx/matrix_trs.hpp"
 #include "./gtx/mixed_product.hpp"
 #include "./gtx/norm.hpp"
 #include "./gtx/normal.hpp"
@@ -172,8 +180,10 @@
 #include "./gtx/polar_coordinates.hpp"
 #include "./gtx/projection.hpp"
 #include "./gtx/quaternion.hpp"
+#include "./gtx/quaternion_batch.hpp"
 #include "./gtx/raw_data.hpp"
 #include "./gtx/rotate_vector.hpp"
+#include "./gtx/skinning.hpp"
 #include "./gtx/spline.hpp"
 #include "./gtx/std_based_type.hpp"
 #if !(GLM_COMPILER & GLM_COMPILER_CUDA)
@@ -181,6 +191,7 @@
 #endif
 #include "./gtx/transform.hpp"
 #include "./gtx/transform2.hpp"
+#include "./gtx/transform_hierarchy.hpp"
 #include "./gtx/vec_swizzle.hpp"
 #include "./gtx/vector_angle.hpp"
 #include "./gtx/vector_query.hpp"
@@ -193,4 +204,9 @@
 #if GLM_HAS_RANGE_FOR
 #	include "./gtx/range.hpp"
 #endif
+
+#if GLM_HAS_CXX11_STL
+#	include "./gtx/hash.hpp"
+#	include "./gtx/hash_grid.hpp"
+#endif
 #endif//GLM_ENABLE_EXPERIMENTAL
@@ -20,6 +20,7 @@
 #pragma once
 
 // Dependencies
+#include <cstddef>
 #include "../gtc/constants.hpp"
 #include "../geometric.hpp"
 #include "../trigonometric.hpp"
@@ -143,6 +144,117 @@ namespace glm
 	GLM_FUNC_DECL mat<4, 4, T, Q> pickMatrix(
 		vec<2, T, Q> const& center, vec<2, T, Q> const& delta, vec<4, U, Q> const& viewport);
 
+	/// Cached transformations between object and window coordinates for a given modelview matrix, projection matrix and viewport.
+	/// Building a projector costs a single matrix inverse, each projected or unprojected point then costs one matrix vector product.
+	/// The viewport transformation is folded into the cached matrices, results match project and unProject up to rounding.
+	///
+	/// @tparam T Native type used for the computation. Currently supported: half (not recommended), float or double.
+	///
+	/// @see makeProjectorZO
+	/// @see makeProjectorNO
+	/// @see makeProjector
+	template<typename T, qualifier Q = defaultp>
+	struct projector
+	{
+		typedef T value_type;
+
+		/// Maps homogeneous object coordinates to homogeneous window coordinates.
+		mat<4, 4, T, Q> objectToWindow;
+
+		/// Maps homogeneous window coordinates to homogeneous object coordinates.
+		mat<4, 4, T, Q> windowToObject;
+
+		/// Viewport the window coordinates are expressed in.
+		vec<4, T, Q> viewport;
+	};
+
+	/// Build a projector for the clip volume definition where the near and far clip planes correspond to z normalized device coordinates of 0 and +1 respectively. (Direct3D clip volume definition)
+	///
+	/// @param model Specifies the modelview matrix
+	/// @param proj Specifies the projection matrix
+	/// @param viewport Specifies the viewport
+	/// @tparam T Native type used for the computation. Currently supported: half (not recommended), float or double.
+	/// @tparam U Currently supported: Floating-point types and integer types.
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_DECL projector<T, Q> makeProjectorZO(
+		mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport);
+
+	/// Build a projector for the clip volume definition where the near and far clip planes correspond to z normalized device coordinates of -1 and +1 respectively. (OpenGL clip volume definition)
+	///
+	/// @param model Specifies the modelview matrix
+	/// @param proj Specifies the projection matrix
+	/// @param viewport Specifies the viewport
+	/// @tparam T Native type used for the computation. Currently supported: half (not recommended), float or double.
+	/// @tparam U Currently supported: Floating-point types and integer types.
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_DECL projector<T, Q> makeProjectorNO(
+		mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport);
+
+	/// Build a projector using default near and far clip planes definition.
+	/// To change default near and far clip planes definition use GLM_FORCE_DEPTH_ZERO_TO_ONE.
+	///
+	/// @param model Specifies the modelview matrix
+	/// @param proj Specifies the projection matrix
+	/// @param viewport Specifies the viewport
+	/// @tparam T Native type used for the computation. Currently supported: half (not recommended), float or double.
+	/// @tparam U Currently supported: Floating-point types and integer types.
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_DECL projector<T, Q> makeProjector(
+		mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport);
+
+	/// Map the specified object coordinates (obj.x, obj.y, obj.z) into window coordinates using a projector.
+	///
+	/// @param p Specifies the cached model, projection and viewport transformations
+	/// @param obj Specify the object coordinates.
+	/// @return Return the computed window coordinates.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> project(
+		projector<T, Q> const& p, vec<3, T, Q> const& obj);
+
+	/// Map count object coordinates into window coordinates using a projector.
+	/// Four points are processed at once for float when GLM_FORCE_INTRINSICS is enabled.
+	///
+	/// @param p Specifies the cached model, projection and viewport transformations
+	/// @param obj Specify the array of object coordinates.
+	/// @param win Receives the computed window coordinates, it may alias obj.
+	/// @param count Number of points to project.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void project(
+		projector<T, Q> const& p, vec<3, T, Q> const* obj, vec<3, T, Q>* win, std::size_t count);
+
+	/// Map the specified window coordinates (win.x, win.y, win.z) into object coordinates using a projector.
+	///
+	/// @param p Specifies the cached model, projection and viewport transformations
+	/// @param win Specify the window coordinates to be mapped.
+	/// @return Returns the computed object coordinates.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> unProject(
+		projector<T, Q> const& p, vec<3, T, Q> const& win);
+
+	/// Map count window coordinates into object coordinates using a projector.
+	/// Four points are processed at once for float when GLM_FORCE_INTRINSICS is enabled.
+	///
+	/// @param p Specifies the cached model, projection and viewport transformations
+	/// @param win Specify the array of window coordinates to be mapped.
+	/// @param obj Receives the computed object coordinates, it may alias win.
+	/// @param count Number of points to unproject.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void unProject(
+		projector<T, Q> const& p, vec<3, T, Q> const* win, vec<3, T, Q>* obj, std::size_t count);
+
+	/// Reconstruct the object coordinates of every pixel of a depth buffer covering the viewport.
+	/// Pixel (i, j) is stored at depth[j * width + i] and is located at the window coordinates
+	/// (viewport.x + i + 0.5, viewport.y + j + 0.5, depth[j * width + i]).
+	///
+	/// @param p Specifies the cached model, projection and viewport transformations
+	/// @param depth Specify the depth buffer, values are window depths as unProject expects them.
+	/// @param width Number of pixels per row.
+	/// @param height Number of rows.
+	/// @param obj Receives width * height object coordinates, in the depth buffer order.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void unProjectDepth(
+		projector<T, Q> const& p, T const* depth, std::size_t width, std::size_t height, vec<3, T, Q>* obj);
+
 	/// @}
 }//namespace glm
 
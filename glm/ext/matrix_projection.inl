@@ -1,5 +1,69 @@
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_projector
+	{
+		// Homogeneous transformation of points followed by the perspective division
+		GLM_FUNC_QUALIFIER static void transform(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, vec<3, T, Q>* out, std::size_t count)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<4, T, Q> const h = m * vec<4, T, Q>(in[i], static_cast<T>(1));
+				out[i] = vec<3, T, Q>(h) / h.w;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void depth(mat<4, 4, T, Q> const& m, vec<4, T, Q> const& viewport, T const* depth, std::size_t width, std::size_t height, vec<3, T, Q>* out)
+		{
+			for(std::size_t j = 0; j < height; ++j)
+			{
+				vec<4, T, Q> const Row = m[3] + m[1] * (viewport[1] + static_cast<T>(j) + static_cast<T>(0.5));
+				for(std::size_t i = 0; i < width; ++i)
+				{
+					vec<4, T, Q> const h = Row + m[0] * (viewport[0] + static_cast<T>(i) + static_cast<T>(0.5)) + m[2] * depth[j * width + i];
+					out[j * width + i] = vec<3, T, Q>(h) / h.w;
+				}
+			}
+		}
+	};
+
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_QUALIFIER projector<T, Q> compute_makeProjector(mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport, T DepthScale, T DepthBias)
+	{
+		T const vx = static_cast<T>(viewport[0]);
+		T const vy = static_cast<T>(viewport[1]);
+		T const vw = static_cast<T>(viewport[2]);
+		T const vh = static_cast<T>(viewport[3]);
+
+		// Normalized device coordinates to window coordinates
+		mat<4, 4, T, Q> Window(static_cast<T>(1));
+		Window[0][0] = vw * static_cast<T>(0.5);
+		Window[1][1] = vh * static_cast<T>(0.5);
+		Window[2][2] = DepthScale;
+		Window[3][0] = vx + vw * static_cast<T>(0.5);
+		Window[3][1] = vy + vh * static_cast<T>(0.5);
+		Window[3][2] = DepthBias;
+
+		// Window coordinates to normalized device coordinates
+		mat<4, 4, T, Q> Device(static_cast<T>(1));
+		Device[0][0] = static_cast<T>(2) / vw;
+		Device[1][1] = static_cast<T>(2) / vh;
+		Device[2][2] = static_cast<T>(1) / DepthScale;
+		Device[3][0] = -(static_cast<T>(2) * vx / vw + static_cast<T>(1));
+		Device[3][1] = -(static_cast<T>(2) * vy / vh + static_cast<T>(1));
+		Device[3][2] = -DepthBias / DepthScale;
+
+		mat<4, 4, T, Q> const ProjModel(proj * model);
+
+		projector<T, Q> Result;
+		Result.objectToWindow = Window * ProjModel;
+		Result.windowToObject = inverse(ProjModel) * Device;
+		Result.viewport = vec<4, T, Q>(vx, vy, vw, vh);
+		return Result;
+	}
+}//namespace detail
+
 	template<typename T, typename U, qualifier Q>
 	GLM_FUNC_QUALIFIER vec<3, T, Q> projectZO(vec<3, T, Q> const& obj, mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport)
 	{
@@ -101,4 +165,61 @@ namespace glm
 		Result = translate(Result, Temp);
 		return scale(Result, vec<3, T, Q>(static_cast<T>(viewport[2]) / delta.x, static_cast<T>(viewport[3]) / delta.y, static_cast<T>(1)));
 	}
+
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_QUALIFIER projector<T, Q> makeProjectorZO(mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport)
+	{
+		return detail::compute_makeProjector(model, proj, viewport, static_cast<T>(1), static_cast<T>(0));
+	}
+
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_QUALIFIER projector<T, Q> makeProjectorNO(mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport)
+	{
+		return detail::compute_makeProjector(model, proj, viewport, static_cast<T>(0.5), static_cast<T>(0.5));
+	}
+
+	template<typename T, typename U, qualifier Q>
+	GLM_FUNC_QUALIFIER projector<T, Q> makeProjector(mat<4, 4, T, Q> const& model, mat<4, 4, T, Q> const& proj, vec<4, U, Q> const& viewport)
+	{
+		if(GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			return makeProjectorZO(model, proj, viewport);
+		else
+			return makeProjectorNO(model, proj, viewport);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> project(projector<T, Q> const& p, vec<3, T, Q> const& obj)
+	{
+		vec<4, T, Q> const tmp = p.objectToWindow * vec<4, T, Q>(obj, static_cast<T>(1));
+		return vec<3, T, Q>(tmp) / tmp.w;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void project(projector<T, Q> const& p, vec<3, T, Q> const* obj, vec<3, T, Q>* win, std::size_t count)
+	{
+		detail::compute_projector<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transform(p.objectToWindow, obj, win, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> unProject(projector<T, Q> const& p, vec<3, T, Q> const& win)
+	{
+		vec<4, T, Q> const obj = p.windowToObject * vec<4, T, Q>(win, static_cast<T>(1));
+		return vec<3, T, Q>(obj) / obj.w;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void unProject(projector<T, Q> const& p, vec<3, T, Q> const* win, vec<3, T, Q>* obj, std::size_t count)
+	{
+		detail::compute_projector<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transform(p.windowToObject, win, obj, count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void unProjectDepth(projector<T, Q> const& p, T const* depth, std::size_t width, std::size_t height, vec<3, T, Q>* obj)
+	{
+		detail::compute_projector<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::depth(p.windowToObject, p.viewport, depth, width, height, obj);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_projection_simd.inl"
+#endif
@@ -0,0 +1,118 @@
+/// @ref ext_matrix_projection
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	// Four packed vec3 (x0 y0 z0 x1, y1 z1 x2 y2, z2 x3 y3 z3) to structure of arrays
+	GLM_FUNC_QUALIFIER void glm_vec3x4_load_soa(float const* in, glm_vec4 & x, glm_vec4 & y, glm_vec4 & z)
+	{
+		glm_vec4 const p0 = _mm_loadu_ps(in + 0);
+		glm_vec4 const p1 = _mm_loadu_ps(in + 4);
+		glm_vec4 const p2 = _mm_loadu_ps(in + 8);
+
+		x = _mm_shuffle_ps(p0, _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(1, 1, 2, 2)), _MM_SHUFFLE(2, 0, 3, 0));
+		y = _mm_shuffle_ps(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(0, 0, 1, 1)), _mm_shuffle_ps(p1, p2, _MM_SHUFFLE(2, 2, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+		z = _mm_shuffle_ps(_mm_shuffle_ps(p0, p1, _MM_SHUFFLE(1, 1, 2, 2)), _mm_shuffle_ps(p2, p2, _MM_SHUFFLE(3, 3, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+	}
+
+	// Structure of arrays to four packed vec3
+	GLM_FUNC_QUALIFIER void glm_vec3x4_store_soa(float* out, glm_vec4 x, glm_vec4 y, glm_vec4 z)
+	{
+		glm_vec4 const p0 = _mm_shuffle_ps(_mm_shuffle_ps(x, y, _MM_SHUFFLE(0, 0, 0, 0)), _mm_shuffle_ps(z, x, _MM_SHUFFLE(1, 1, 0, 0)), _MM_SHUFFLE(2, 0, 2, 0));
+		glm_vec4 const p1 = _mm_shuffle_ps(_mm_shuffle_ps(y, z, _MM_SHUFFLE(1, 1, 1, 1)), _mm_shuffle_ps(x, y, _MM_SHUFFLE(2, 2, 2, 2)), _MM_SHUFFLE(2, 0, 2, 0));
+		glm_vec4 const p2 = _mm_shuffle_ps(_mm_shuffle_ps(z, x, _MM_SHUFFLE(3, 3, 2, 2)), _mm_shuffle_ps(y, z, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(2, 0, 2, 0));
+
+		_mm_storeu_ps(out + 0, p0);
+		_mm_storeu_ps(out + 4, p1);
+		_mm_storeu_ps(out + 8, p2);
+	}
+
+	// Broadcast each of the 16 elements of a column major matrix
+	GLM_FUNC_QUALIFIER void glm_mat4_load_broadcast(float const* m, glm_vec4 out[16])
+	{
+		for(length_t i = 0; i < 16; ++i)
+			out[i] = _mm_set1_ps(m[i]);
+	}
+
+	template<qualifier Q>
+	struct compute_projector<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void transform(mat<4, 4, float, Q> const& m, vec<3, float, Q> const* in, vec<3, float, Q>* out, std::size_t count)
+		{
+			std::size_t i = 0;
+
+			if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+			{
+				glm_vec4 M[16];
+				glm_mat4_load_broadcast(&m[0][0], M);
+
+				for(; i + 4 <= count; i += 4)
+				{
+					glm_vec4 x, y, z;
+					glm_vec3x4_load_soa(&in[i].x, x, y, z);
+
+					glm_vec4 const hx = glm_vec4_fma(M[0], x, glm_vec4_fma(M[4], y, glm_vec4_fma(M[8], z, M[12])));
+					glm_vec4 const hy = glm_vec4_fma(M[1], x, glm_vec4_fma(M[5], y, glm_vec4_fma(M[9], z, M[13])));
+					glm_vec4 const hz = glm_vec4_fma(M[2], x, glm_vec4_fma(M[6], y, glm_vec4_fma(M[10], z, M[14])));
+					glm_vec4 const hw = glm_vec4_fma(M[3], x, glm_vec4_fma(M[7], y, glm_vec4_fma(M[11], z, M[15])));
+
+					glm_vec3x4_store_soa(&out[i].x, _mm_div_ps(hx, hw), _mm_div_ps(hy, hw), _mm_div_ps(hz, hw));
+				}
+			}
+
+			compute_projector<float, Q, false>::transform(m, in + i, out + i, count - i);
+		}
+
+		GLM_FUNC_QUALIFIER static void depth(mat<4, 4, float, Q> const& m, vec<4, float, Q> const& viewport, float const* depth, std::size_t width, std::size_t height, vec<3, float, Q>* out)
+		{
+			if(sizeof(vec<3, float, Q>) != sizeof(float) * 3)
+			{
+				compute_projector<float, Q, false>::depth(m, viewport, depth, width, height, out);
+				return;
+			}
+
+			glm_vec4 M[16];
+			glm_mat4_load_broadcast(&m[0][0], M);
+
+			glm_vec4 const Step = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+			for(std::size_t j = 0; j < height; ++j)
+			{
+				glm_vec4 const y = _mm_set1_ps(viewport[1] + static_cast<float>(j) + 0.5f);
+				glm_vec4 const rx = glm_vec4_fma(M[4], y, M[12]);
+				glm_vec4 const ry = glm_vec4_fma(M[5], y, M[13]);
+				glm_vec4 const rz = glm_vec4_fma(M[6], y, M[14]);
+				glm_vec4 const rw = glm_vec4_fma(M[7], y, M[15]);
+
+				float const* DepthRow = depth + j * width;
+				vec<3, float, Q>* OutRow = out + j * width;
+
+				std::size_t i = 0;
+				for(; i + 4 <= width; i += 4)
+				{
+					glm_vec4 const x = _mm_add_ps(_mm_set1_ps(viewport[0] + static_cast<float>(i)), Step);
+					glm_vec4 const z = _mm_loadu_ps(DepthRow + i);
+
+					glm_vec4 const hx = glm_vec4_fma(M[0], x, glm_vec4_fma(M[8], z, rx));
+					glm_vec4 const hy = glm_vec4_fma(M[1], x, glm_vec4_fma(M[9], z, ry));
+					glm_vec4 const hz = glm_vec4_fma(M[2], x, glm_vec4_fma(M[10], z, rz));
+					glm_vec4 const hw = glm_vec4_fma(M[3], x, glm_vec4_fma(M[11], z, rw));
+
+					glm_vec3x4_store_soa(&OutRow[i].x, _mm_div_ps(hx, hw), _mm_div_ps(hy, hw), _mm_div_ps(hz, hw));
+				}
+
+				for(; i < width; ++i)
+				{
+					vec<4, float, Q> const h = m * vec<4, float, Q>(viewport[0] + static_cast<float>(i) + 0.5f, viewport[1] + static_cast<float>(j) + 0.5f, DepthRow[i], 1.0f);
+					OutRow[i] = vec<3, float, Q>(h) / h.w;
+				}
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
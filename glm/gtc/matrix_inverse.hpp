@@ -9,12 +9,15 @@
 /// Include <glm/gtc/matrix_integer.hpp> to use the features of this extension.
 ///
 /// Defines additional matrix inverting functions.
+/// For float, and for double when AVX2 is available, affineInverse, inverseTranspose and normalMatrix of
+/// 3x3 and 4x4 matrices use SIMD instructions when GLM_FORCE_INTRINSICS is enabled.
 
 #pragma once
 
 // Dependencies
 #include "../detail/setup.hpp"
 #include "../matrix.hpp"
+#include "../geometric.hpp"
 #include "../mat2x2.hpp"
 #include "../mat3x3.hpp"
 #include "../mat4x4.hpp"
@@ -44,6 +47,28 @@ namespace glm
 	template<typename genType>
 	GLM_FUNC_DECL genType inverseTranspose(genType const& m);
 
+	/// Compute the matrix transforming the normals of a surface transformed by the upper 3x3 part of m.
+	/// It is the cofactor matrix, inverseTranspose multiplied by the determinant, so no division is performed
+	/// and singular matrices are supported. Transformed normals need to be normalized.
+	/// The normals are flipped by a negative determinant, consistently with normals computed as the cross product of transformed edges.
+	///
+	/// @param m Input matrix, only the upper 3x3 part is used.
+	/// @tparam T Floating-point scalar types: half, float or double.
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> normalMatrix(mat<3, 3, T, Q> const& m);
+
+	/// Compute the matrix transforming the normals of a surface transformed by the upper 3x3 part of m.
+	/// It is the cofactor matrix, inverseTranspose multiplied by the determinant, so no division is performed
+	/// and singular matrices are supported. Transformed normals need to be normalized.
+	/// The normals are flipped by a negative determinant, consistently with normals computed as the cross product of transformed edges.
+	///
+	/// @param m Input matrix, only the upper 3x3 part is used.
+	/// @tparam T Floating-point scalar types: half, float or double.
+	/// @see gtc_matrix_inverse
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> normalMatrix(mat<4, 4, T, Q> const& m);
+
 	/// @}
 }//namespace glm
 
@@ -0,0 +1,332 @@
+/// @ref gtc_matrix_inverse
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/geometric.h"
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	// Cofactor matrix of the linear part with columns a, b and c, w lanes are cleared
+	GLM_FUNC_QUALIFIER void glm_mat3_cofactor(glm_vec4 a, glm_vec4 b, glm_vec4 c, glm_vec4 out[3])
+	{
+		glm_vec4 const MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		out[0] = _mm_and_ps(glm_vec4_cross(b, c), MaskXYZ);
+		out[1] = _mm_and_ps(glm_vec4_cross(c, a), MaskXYZ);
+		out[2] = _mm_and_ps(glm_vec4_cross(a, b), MaskXYZ);
+	}
+
+	// Dot product of the xyz lanes of a with a cofactor column, broadcasted
+	GLM_FUNC_QUALIFIER glm_vec4 glm_mat3_determinant(glm_vec4 a, glm_vec4 Cofactor0)
+	{
+		glm_vec4 const MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+		glm_vec4 const p = _mm_mul_ps(_mm_and_ps(a, MaskXYZ), Cofactor0);
+		glm_vec4 const s = _mm_add_ps(p, _mm_shuffle_ps(p, p, _MM_SHUFFLE(2, 3, 0, 1)));
+		return _mm_add_ps(s, _mm_shuffle_ps(s, s, _MM_SHUFFLE(1, 0, 3, 2)));
+	}
+
+	// Columns of a 3x3 matrix, w lanes are undefined
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void glm_mat3_load(mat<3, 3, float, Q> const& m, glm_vec4 out[3])
+	{
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			// Nine contiguous floats loaded as 4 + 4 + 1 to avoid overlapping accesses
+			glm_vec4 const L0 = _mm_loadu_ps(&m[0].x);
+			glm_vec4 const L1 = _mm_loadu_ps(&m[1].y);
+			glm_vec4 const L2 = _mm_load_ss(&m[2].z);
+			glm_vec4 const t = _mm_shuffle_ps(L0, L1, _MM_SHUFFLE(1, 0, 3, 3));
+			out[0] = L0;
+			out[1] = _mm_shuffle_ps(t, t, _MM_SHUFFLE(3, 3, 2, 0));
+			out[2] = _mm_shuffle_ps(L1, L2, _MM_SHUFFLE(0, 0, 3, 2));
+		}
+		else
+		{
+			out[0] = _mm_loadu_ps(&m[0].x);
+			out[1] = _mm_loadu_ps(&m[1].x);
+			out[2] = _mm_loadu_ps(&m[2].x);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, float, Q> glm_mat3_store(glm_vec4 const in[3])
+	{
+		mat<3, 3, float, Q> Result;
+		if(sizeof(vec<3, float, Q>) == sizeof(float) * 3)
+		{
+			glm_vec4 const t = _mm_shuffle_ps(in[0], in[1], _MM_SHUFFLE(0, 0, 2, 2));
+			_mm_storeu_ps(&Result[0].x, _mm_shuffle_ps(in[0], t, _MM_SHUFFLE(2, 0, 1, 0)));
+			_mm_storeu_ps(&Result[1].y, _mm_shuffle_ps(in[1], in[2], _MM_SHUFFLE(1, 0, 2, 1)));
+			_mm_store_ss(&Result[2].z, _mm_movehl_ps(in[2], in[2]));
+		}
+		else
+		{
+			_mm_storeu_ps(&Result[0].x, in[0]);
+			_mm_storeu_ps(&Result[1].x, in[1]);
+			_mm_storeu_ps(&Result[2].x, in[2]);
+		}
+		return Result;
+	}
+
+	template<qualifier Q>
+	struct compute_affineInverse<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			glm_vec4 const a = _mm_loadu_ps(&m[0].x);
+			glm_vec4 const b = _mm_loadu_ps(&m[1].x);
+			glm_vec4 const c = _mm_loadu_ps(&m[2].x);
+			glm_vec4 const t = _mm_loadu_ps(&m[3].x);
+
+			// Rows of the inverse of the linear part are the cofactor columns divided by the determinant
+			glm_vec4 Cofactor[3];
+			glm_mat3_cofactor(a, b, c, Cofactor);
+			glm_vec4 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), glm_mat3_determinant(a, Cofactor[0]));
+
+			glm_vec4 Rows[4] = {
+				_mm_mul_ps(Cofactor[0], OneOverDeterminant),
+				_mm_mul_ps(Cofactor[1], OneOverDeterminant),
+				_mm_mul_ps(Cofactor[2], OneOverDeterminant),
+				_mm_setzero_ps()};
+			glm_vec4 Columns[4];
+			glm_mat4_transpose(Rows, Columns);
+
+			glm_vec4 Translation = _mm_mul_ps(Columns[0], _mm_shuffle_ps(t, t, _MM_SHUFFLE(0, 0, 0, 0)));
+			Translation = glm_vec4_fma(Columns[1], _mm_shuffle_ps(t, t, _MM_SHUFFLE(1, 1, 1, 1)), Translation);
+			Translation = glm_vec4_fma(Columns[2], _mm_shuffle_ps(t, t, _MM_SHUFFLE(2, 2, 2, 2)), Translation);
+			Translation = _mm_sub_ps(_mm_set_ps(1.0f, 0.0f, 0.0f, 0.0f), Translation);
+
+			mat<4, 4, float, Q> Result;
+			_mm_storeu_ps(&Result[0].x, Columns[0]);
+			_mm_storeu_ps(&Result[1].x, Columns[1]);
+			_mm_storeu_ps(&Result[2].x, Columns[2]);
+			_mm_storeu_ps(&Result[3].x, Translation);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverseTranspose<3, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 Columns[3];
+			glm_mat3_load(m, Columns);
+
+			glm_vec4 Cofactor[3];
+			glm_mat3_cofactor(Columns[0], Columns[1], Columns[2], Cofactor);
+			glm_vec4 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), glm_mat3_determinant(Columns[0], Cofactor[0]));
+
+			Cofactor[0] = _mm_mul_ps(Cofactor[0], OneOverDeterminant);
+			Cofactor[1] = _mm_mul_ps(Cofactor[1], OneOverDeterminant);
+			Cofactor[2] = _mm_mul_ps(Cofactor[2], OneOverDeterminant);
+			return glm_mat3_store<Q>(Cofactor);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverseTranspose<4, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			glm_vec4 const In[4] = {
+				_mm_loadu_ps(&m[0].x),
+				_mm_loadu_ps(&m[1].x),
+				_mm_loadu_ps(&m[2].x),
+				_mm_loadu_ps(&m[3].x)};
+
+			glm_vec4 Inverse[4];
+			glm_mat4_inverse(In, Inverse);
+			glm_vec4 Out[4];
+			glm_mat4_transpose(Inverse, Out);
+
+			mat<4, 4, float, Q> Result;
+			_mm_storeu_ps(&Result[0].x, Out[0]);
+			_mm_storeu_ps(&Result[1].x, Out[1]);
+			_mm_storeu_ps(&Result[2].x, Out[2]);
+			_mm_storeu_ps(&Result[3].x, Out[3]);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_normalMatrix<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<3, 3, float, Q> const& m)
+		{
+			glm_vec4 Columns[3];
+			glm_mat3_load(m, Columns);
+
+			glm_vec4 Cofactor[3];
+			glm_mat3_cofactor(Columns[0], Columns[1], Columns[2], Cofactor);
+			return glm_mat3_store<Q>(Cofactor);
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 3, float, Q> call(mat<4, 4, float, Q> const& m)
+		{
+			glm_vec4 Cofactor[3];
+			glm_mat3_cofactor(_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), Cofactor);
+			return glm_mat3_store<Q>(Cofactor);
+		}
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX2_BIT
+	GLM_FUNC_QUALIFIER __m256d glm_dvec4_cross(__m256d a, __m256d b)
+	{
+		__m256d const a_yzx = _mm256_permute4x64_pd(a, _MM_SHUFFLE(3, 0, 2, 1));
+		__m256d const b_yzx = _mm256_permute4x64_pd(b, _MM_SHUFFLE(3, 0, 2, 1));
+		__m256d const c = _mm256_sub_pd(_mm256_mul_pd(a, b_yzx), _mm256_mul_pd(a_yzx, b));
+		return _mm256_permute4x64_pd(c, _MM_SHUFFLE(3, 0, 2, 1));
+	}
+
+	// Dot product of the xyz lanes of a with a cofactor column, broadcasted
+	GLM_FUNC_QUALIFIER __m256d glm_dmat3_determinant(__m256d a, __m256d Cofactor0)
+	{
+		__m256d const MaskXYZ = _mm256_castsi256_pd(_mm256_set_epi64x(0, -1, -1, -1));
+		__m256d const p = _mm256_mul_pd(_mm256_and_pd(a, MaskXYZ), Cofactor0);
+		__m256d const s = _mm256_add_pd(p, _mm256_permute4x64_pd(p, _MM_SHUFFLE(1, 0, 3, 2)));
+		return _mm256_add_pd(s, _mm256_permute_pd(s, 0x5));
+	}
+
+	GLM_FUNC_QUALIFIER void glm_dmat3_cofactor(__m256d a, __m256d b, __m256d c, __m256d out[3])
+	{
+		__m256d const MaskXYZ = _mm256_castsi256_pd(_mm256_set_epi64x(0, -1, -1, -1));
+		out[0] = _mm256_and_pd(glm_dvec4_cross(b, c), MaskXYZ);
+		out[1] = _mm256_and_pd(glm_dvec4_cross(c, a), MaskXYZ);
+		out[2] = _mm256_and_pd(glm_dvec4_cross(a, b), MaskXYZ);
+	}
+
+	GLM_FUNC_QUALIFIER void glm_dmat4_transpose(__m256d const in[4], __m256d out[4])
+	{
+		__m256d const t0 = _mm256_unpacklo_pd(in[0], in[1]);
+		__m256d const t1 = _mm256_unpackhi_pd(in[0], in[1]);
+		__m256d const t2 = _mm256_unpacklo_pd(in[2], in[3]);
+		__m256d const t3 = _mm256_unpackhi_pd(in[2], in[3]);
+		out[0] = _mm256_permute2f128_pd(t0, t2, 0x20);
+		out[1] = _mm256_permute2f128_pd(t1, t3, 0x20);
+		out[2] = _mm256_permute2f128_pd(t0, t2, 0x31);
+		out[3] = _mm256_permute2f128_pd(t1, t3, 0x31);
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void glm_dmat3_load(mat<3, 3, double, Q> const& m, __m256d out[3])
+	{
+		if(sizeof(vec<3, double, Q>) == sizeof(double) * 3)
+		{
+			__m256d const L0 = _mm256_loadu_pd(&m[0].x);
+			__m256d const L1 = _mm256_loadu_pd(&m[1].y);
+			__m256d const L2 = _mm256_broadcast_sd(&m[2].z);
+			out[0] = L0;
+			out[1] = _mm256_blend_pd(_mm256_permute4x64_pd(L1, _MM_SHUFFLE(2, 1, 0, 0)), _mm256_permute4x64_pd(L0, _MM_SHUFFLE(3, 3, 3, 3)), 0x1);
+			out[2] = _mm256_blend_pd(_mm256_permute4x64_pd(L1, _MM_SHUFFLE(3, 3, 3, 2)), L2, 0x4);
+		}
+		else
+		{
+			out[0] = _mm256_loadu_pd(&m[0].x);
+			out[1] = _mm256_loadu_pd(&m[1].x);
+			out[2] = _mm256_loadu_pd(&m[2].x);
+		}
+	}
+
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, double, Q> glm_dmat3_store(__m256d const in[3])
+	{
+		mat<3, 3, double, Q> Result;
+		if(sizeof(vec<3, double, Q>) == sizeof(double) * 3)
+		{
+			__m256d const v0 = _mm256_blend_pd(in[0], _mm256_permute4x64_pd(in[1], _MM_SHUFFLE(0, 0, 0, 0)), 0x8);
+			__m256d const v1 = _mm256_blend_pd(_mm256_permute4x64_pd(in[1], _MM_SHUFFLE(0, 0, 2, 1)), _mm256_permute4x64_pd(in[2], _MM_SHUFFLE(1, 0, 0, 0)), 0xC);
+			_mm256_storeu_pd(&Result[0].x, v0);
+			_mm256_storeu_pd(&Result[1].y, v1);
+			_mm_store_sd(&Result[2].z, _mm256_extractf128_pd(in[2], 1));
+		}
+		else
+		{
+			_mm256_storeu_pd(&Result[0].x, in[0]);
+			_mm256_storeu_pd(&Result[1].x, in[1]);
+			_mm256_storeu_pd(&Result[2].x, in[2]);
+		}
+		return Result;
+	}
+
+	template<qualifier Q>
+	struct compute_affineInverse<4, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<4, 4, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			__m256d const a = _mm256_loadu_pd(&m[0].x);
+			__m256d const b = _mm256_loadu_pd(&m[1].x);
+			__m256d const c = _mm256_loadu_pd(&m[2].x);
+			__m256d const t = _mm256_loadu_pd(&m[3].x);
+
+			__m256d Cofactor[3];
+			glm_dmat3_cofactor(a, b, c, Cofactor);
+			__m256d const OneOverDeterminant = _mm256_div_pd(_mm256_set1_pd(1.0), glm_dmat3_determinant(a, Cofactor[0]));
+
+			__m256d const Rows[4] = {
+				_mm256_mul_pd(Cofactor[0], OneOverDeterminant),
+				_mm256_mul_pd(Cofactor[1], OneOverDeterminant),
+				_mm256_mul_pd(Cofactor[2], OneOverDeterminant),
+				_mm256_setzero_pd()};
+			__m256d Columns[4];
+			glm_dmat4_transpose(Rows, Columns);
+
+			__m256d Translation = _mm256_mul_pd(Columns[0], _mm256_permute4x64_pd(t, _MM_SHUFFLE(0, 0, 0, 0)));
+			Translation = _mm256_add_pd(Translation, _mm256_mul_pd(Columns[1], _mm256_permute4x64_pd(t, _MM_SHUFFLE(1, 1, 1, 1))));
+			Translation = _mm256_add_pd(Translation, _mm256_mul_pd(Columns[2], _mm256_permute4x64_pd(t, _MM_SHUFFLE(2, 2, 2, 2))));
+			Translation = _mm256_sub_pd(_mm256_set_pd(1.0, 0.0, 0.0, 0.0), Translation);
+
+			mat<4, 4, double, Q> Result;
+			_mm256_storeu_pd(&Result[0].x, Columns[0]);
+			_mm256_storeu_pd(&Result[1].x, Columns[1]);
+			_mm256_storeu_pd(&Result[2].x, Columns[2]);
+			_mm256_storeu_pd(&Result[3].x, Translation);
+			return Result;
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_inverseTranspose<3, double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, double, Q> call(mat<3, 3, double, Q> const& m)
+		{
+			__m256d Columns[3];
+			glm_dmat3_load(m, Columns);
+
+			__m256d Cofactor[3];
+			glm_dmat3_cofactor(Columns[0], Columns[1], Columns[2], Cofactor);
+			__m256d const OneOverDeterminant = _mm256_div_pd(_mm256_set1_pd(1.0), glm_dmat3_determinant(Columns[0], Cofactor[0]));
+
+			Cofactor[0] = _mm256_mul_pd(Cofactor[0], OneOverDeterminant);
+			Cofactor[1] = _mm256_mul_pd(Cofactor[1], OneOverDeterminant);
+			Cofactor[2] = _mm256_mul_pd(Cofactor[2], OneOverDeterminant);
+			return glm_dmat3_store<Q>(Cofactor);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_normalMatrix<double, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static mat<3, 3, double, Q> call(mat<3, 3, double, Q> const& m)
+		{
+			__m256d Columns[3];
+			glm_dmat3_load(m, Columns);
+
+			__m256d Cofactor[3];
+			glm_dmat3_cofactor(Columns[0], Columns[1], Columns[2], Cofactor);
+			return glm_dmat3_store<Q>(Cofactor);
+		}
+
+		GLM_FUNC_QUALIFIER static mat<3, 3, double, Q> call(mat<4, 4, double, Q> const& m)
+		{
+			__m256d Cofactor[3];
+			glm_dmat3_cofactor(_mm256_loadu_pd(&m[0].x), _mm256_loadu_pd(&m[1].x), _mm256_loadu_pd(&m[2].x), Cofactor);
+			return glm_dmat3_store<Q>(Cofactor);
+		}
+	};
+#	endif//GLM_ARCH & GLM_ARCH_AVX2_BIT
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,128 @@
+/// @ref gtx_affine
+/// @file glm/gtx/affine.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_affine GLM_GTX_affine
+/// @ingroup gtx
+///
+/// Include <glm/gtx/affine.hpp> to use the features of this extension.
+///
+/// Affine transformation type storing the three first rows of a 4x4 matrix, the last row is implicitly (0, 0, 0, 1).
+/// Rows are stored like the mat3x4 produced by mat3x4_cast(tdualquat): each row holds the linear part in xyz and the translation in w.
+/// It uses 25% less memory than a mat4 and composition, transformation and inversion skip the work on the constant row.
+
+#pragma once
+
+// Dependency:
+#include "../glm.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_affine is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_affine extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_affine
+	/// @{
+
+	template<typename T, qualifier Q = defaultp>
+	struct affine
+	{
+		// -- Implementation detail --
+
+		typedef T value_type;
+		typedef vec<4, T, Q> row_type;
+
+		// -- Data --
+
+		row_type value[3];
+
+		// -- Accesses --
+
+		typedef length_t length_type;
+		/// Return the count of stored rows
+		GLM_FUNC_DECL static GLM_CONSTEXPR length_type length(){return 3;}
+
+		/// Return the i-th row, the i-th component of the basis vectors in xyz and of the translation in w
+		GLM_FUNC_DECL row_type & operator[](length_type i);
+		GLM_FUNC_DECL row_type const& operator[](length_type i) const;
+
+		// -- Constructors --
+
+		/// Identity transformation
+		GLM_FUNC_DECL affine();
+		/// Uniform scale s
+		GLM_FUNC_DECL explicit affine(T s);
+		GLM_FUNC_DECL affine(row_type const& row0, row_type const& row1, row_type const& row2);
+		/// Linear part m followed by the translation t
+		GLM_FUNC_DECL affine(mat<3, 3, T, Q> const& m, vec<3, T, Q> const& t);
+
+		// -- Conversion constructors --
+
+		/// The columns of m are the rows of the transformation
+		GLM_FUNC_DECL explicit affine(mat<3, 4, T, Q> const& m);
+		/// The last column of m is the translation
+		GLM_FUNC_DECL explicit affine(mat<4, 3, T, Q> const& m);
+		/// The last row of m is discarded
+		GLM_FUNC_DECL explicit affine(mat<4, 4, T, Q> const& m);
+	};
+
+	/// Compose two affine transformations, the result applies b then a.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL affine<T, Q> operator*(affine<T, Q> const& a, affine<T, Q> const& b);
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator==(affine<T, Q> const& a, affine<T, Q> const& b);
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool operator!=(affine<T, Q> const& a, affine<T, Q> const& b);
+
+	/// Transform a point, the translation applies.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformPoint(affine<T, Q> const& m, vec<3, T, Q> const& p);
+
+	/// Transform a direction, the translation is ignored.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> transformVector(affine<T, Q> const& m, vec<3, T, Q> const& v);
+
+	/// Inverse of an affine transformation with an invertible linear part.
+	/// Computed from the cross products of the rows of the linear part and a single division.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL affine<T, Q> inverse(affine<T, Q> const& m);
+
+	/// Return the linear part of an affine transformation.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> mat3_cast(affine<T, Q> const& m);
+
+	/// Return the rows of an affine transformation as the columns of a mat3x4.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 4, T, Q> mat3x4_cast(affine<T, Q> const& m);
+
+	/// Return an affine transformation as a 4x4 matrix with (0, 0, 0, 1) as last row.
+	/// @see gtx_affine
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> mat4_cast(affine<T, Q> const& m);
+
+	/// Affine transformation of single-precision floating-point numbers.
+	/// @see gtx_affine
+	typedef affine<float, defaultp>		faffine;
+
+	/// Affine transformation of double-precision floating-point numbers.
+	/// @see gtx_affine
+	typedef affine<double, defaultp>	daffine;
+
+	/// @}
+}//namespace glm
+
+#include "affine.inl"
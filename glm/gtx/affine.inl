@@ -0,0 +1,189 @@
+/// @ref gtx_affine
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_affine
+	{
+		GLM_FUNC_QUALIFIER static affine<T, Q> mul(affine<T, Q> const& a, affine<T, Q> const& b)
+		{
+			affine<T, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+			{
+				Result[i] = a[i].x * b[0] + a[i].y * b[1] + a[i].z * b[2];
+				Result[i].w += a[i].w;
+			}
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, T, Q> transform(affine<T, Q> const& m, vec<3, T, Q> const& v, T w)
+		{
+			vec<4, T, Q> const h(v, w);
+			return vec<3, T, Q>(dot(m[0], h), dot(m[1], h), dot(m[2], h));
+		}
+
+		GLM_FUNC_QUALIFIER static affine<T, Q> inverse(affine<T, Q> const& m)
+		{
+			vec<3, T, Q> const r0(m[0]);
+			vec<3, T, Q> const r1(m[1]);
+			vec<3, T, Q> const r2(m[2]);
+
+			// Columns of the adjugate of the linear part
+			vec<3, T, Q> const c0(cross(r1, r2));
+			vec<3, T, Q> const c1(cross(r2, r0));
+			vec<3, T, Q> const c2(cross(r0, r1));
+
+			T const OneOverDeterminant = static_cast<T>(1) / dot(r0, c0);
+			vec<3, T, Q> const t(-(c0 * m[0].w + c1 * m[1].w + c2 * m[2].w) * OneOverDeterminant);
+
+			return affine<T, Q>(
+				vec<4, T, Q>(c0.x * OneOverDeterminant, c1.x * OneOverDeterminant, c2.x * OneOverDeterminant, t.x),
+				vec<4, T, Q>(c0.y * OneOverDeterminant, c1.y * OneOverDeterminant, c2.y * OneOverDeterminant, t.y),
+				vec<4, T, Q>(c0.z * OneOverDeterminant, c1.z * OneOverDeterminant, c2.z * OneOverDeterminant, t.z));
+		}
+	};
+}//namespace detail
+
+	// -- Accesses --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename affine<T, Q>::row_type & affine<T, Q>::operator[](typename affine<T, Q>::length_type i)
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER typename affine<T, Q>::row_type const& affine<T, Q>::operator[](typename affine<T, Q>::length_type i) const
+	{
+		assert(i >= 0 && i < this->length());
+		return this->value[i];
+	}
+
+	// -- Constructors --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine()
+	{
+		this->value[0] = row_type(1, 0, 0, 0);
+		this->value[1] = row_type(0, 1, 0, 0);
+		this->value[2] = row_type(0, 0, 1, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine(T s)
+	{
+		this->value[0] = row_type(s, 0, 0, 0);
+		this->value[1] = row_type(0, s, 0, 0);
+		this->value[2] = row_type(0, 0, s, 0);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine(row_type const& row0, row_type const& row1, row_type const& row2)
+	{
+		this->value[0] = row0;
+		this->value[1] = row1;
+		this->value[2] = row2;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine(mat<3, 3, T, Q> const& m, vec<3, T, Q> const& t)
+	{
+		for(length_t i = 0; i < 3; ++i)
+			this->value[i] = row_type(m[0][i], m[1][i], m[2][i], t[i]);
+	}
+
+	// -- Conversion constructors --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine(mat<3, 4, T, Q> const& m)
+	{
+		this->value[0] = m[0];
+		this->value[1] = m[1];
+		this->value[2] = m[2];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine(mat<4, 3, T, Q> const& m)
+	{
+		for(length_t i = 0; i < 3; ++i)
+			this->value[i] = row_type(m[0][i], m[1][i], m[2][i], m[3][i]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q>::affine(mat<4, 4, T, Q> const& m)
+	{
+		for(length_t i = 0; i < 3; ++i)
+			this->value[i] = row_type(m[0][i], m[1][i], m[2][i], m[3][i]);
+	}
+
+	// -- Operators --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q> operator*(affine<T, Q> const& a, affine<T, Q> const& b)
+	{
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(a, b);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator==(affine<T, Q> const& a, affine<T, Q> const& b)
+	{
+		return a[0] == b[0] && a[1] == b[1] && a[2] == b[2];
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool operator!=(affine<T, Q> const& a, affine<T, Q> const& b)
+	{
+		return !(a == b);
+	}
+
+	// -- Functions --
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformPoint(affine<T, Q> const& m, vec<3, T, Q> const& p)
+	{
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, p, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> transformVector(affine<T, Q> const& m, vec<3, T, Q> const& v)
+	{
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::transform(m, v, static_cast<T>(0));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q> inverse(affine<T, Q> const& m)
+	{
+		return detail::compute_affine<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::inverse(m);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> mat3_cast(affine<T, Q> const& m)
+	{
+		return mat<3, 3, T, Q>(
+			m[0].x, m[1].x, m[2].x,
+			m[0].y, m[1].y, m[2].y,
+			m[0].z, m[1].z, m[2].z);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 4, T, Q> mat3x4_cast(affine<T, Q> const& m)
+	{
+		return mat<3, 4, T, Q>(m[0], m[1], m[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> mat4_cast(affine<T, Q> const& m)
+	{
+		return mat<4, 4, T, Q>(
+			m[0].x, m[1].x, m[2].x, static_cast<T>(0),
+			m[0].y, m[1].y, m[2].y, static_cast<T>(0),
+			m[0].z, m[1].z, m[2].z, static_cast<T>(0),
+			m[0].w, m[1].w, m[2].w, static_cast<T>(1));
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "affine_simd.inl"
+#endif
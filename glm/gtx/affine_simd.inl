@@ -0,0 +1,89 @@
+/// @ref gtx_affine
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/geometric.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_affine<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static affine<float, Q> mul(affine<float, Q> const& a, affine<float, Q> const& b)
+		{
+			glm_vec4 const b0 = _mm_loadu_ps(&b[0].x);
+			glm_vec4 const b1 = _mm_loadu_ps(&b[1].x);
+			glm_vec4 const b2 = _mm_loadu_ps(&b[2].x);
+			glm_vec4 const MaskW = _mm_castsi128_ps(_mm_set_epi32(-1, 0, 0, 0));
+
+			affine<float, Q> Result;
+			for(length_t i = 0; i < 3; ++i)
+			{
+				// Row i of a times b, the implicit last row of b only contributes a[i].w to the translation
+				glm_vec4 const ai = _mm_loadu_ps(&a[i].x);
+				glm_vec4 Row = _mm_and_ps(ai, MaskW);
+				Row = glm_vec4_fma(_mm_shuffle_ps(ai, ai, _MM_SHUFFLE(0, 0, 0, 0)), b0, Row);
+				Row = glm_vec4_fma(_mm_shuffle_ps(ai, ai, _MM_SHUFFLE(1, 1, 1, 1)), b1, Row);
+				Row = glm_vec4_fma(_mm_shuffle_ps(ai, ai, _MM_SHUFFLE(2, 2, 2, 2)), b2, Row);
+				_mm_storeu_ps(&Result[i].x, Row);
+			}
+			return Result;
+		}
+
+		GLM_FUNC_QUALIFIER static vec<3, float, Q> transform(affine<float, Q> const& m, vec<3, float, Q> const& v, float w)
+		{
+			glm_vec4 const h = _mm_set_ps(w, v.z, v.y, v.x);
+			glm_vec4 d0 = _mm_mul_ps(_mm_loadu_ps(&m[0].x), h);
+			glm_vec4 d1 = _mm_mul_ps(_mm_loadu_ps(&m[1].x), h);
+			glm_vec4 d2 = _mm_mul_ps(_mm_loadu_ps(&m[2].x), h);
+			glm_vec4 d3 = _mm_setzero_ps();
+
+			// Sum the lanes of the three products at once
+			_MM_TRANSPOSE4_PS(d0, d1, d2, d3);
+			glm_vec4 const Sum = _mm_add_ps(_mm_add_ps(d0, d1), _mm_add_ps(d2, d3));
+
+			float Out[4];
+			_mm_storeu_ps(Out, Sum);
+			return vec<3, float, Q>(Out[0], Out[1], Out[2]);
+		}
+
+		GLM_FUNC_QUALIFIER static affine<float, Q> inverse(affine<float, Q> const& m)
+		{
+			glm_vec4 const r0 = _mm_loadu_ps(&m[0].x);
+			glm_vec4 const r1 = _mm_loadu_ps(&m[1].x);
+			glm_vec4 const r2 = _mm_loadu_ps(&m[2].x);
+			glm_vec4 const MaskXYZ = _mm_castsi128_ps(_mm_set_epi32(0, -1, -1, -1));
+
+			// Columns of the adjugate of the linear part, w lanes are cleared
+			glm_vec4 const c0 = _mm_and_ps(glm_vec4_cross(r1, r2), MaskXYZ);
+			glm_vec4 const c1 = _mm_and_ps(glm_vec4_cross(r2, r0), MaskXYZ);
+			glm_vec4 const c2 = _mm_and_ps(glm_vec4_cross(r0, r1), MaskXYZ);
+
+			glm_vec4 const Det = glm_vec4_dot(_mm_and_ps(r0, MaskXYZ), c0);
+			glm_vec4 const OneOverDeterminant = _mm_div_ps(_mm_set1_ps(1.0f), Det);
+
+			glm_vec4 i0 = _mm_mul_ps(c0, OneOverDeterminant);
+			glm_vec4 i1 = _mm_mul_ps(c1, OneOverDeterminant);
+			glm_vec4 i2 = _mm_mul_ps(c2, OneOverDeterminant);
+
+			// -inverse(linear) * translation
+			glm_vec4 t = _mm_mul_ps(i0, _mm_shuffle_ps(r0, r0, _MM_SHUFFLE(3, 3, 3, 3)));
+			t = glm_vec4_fma(i1, _mm_shuffle_ps(r1, r1, _MM_SHUFFLE(3, 3, 3, 3)), t);
+			t = glm_vec4_fma(i2, _mm_shuffle_ps(r2, r2, _MM_SHUFFLE(3, 3, 3, 3)), t);
+			t = _mm_sub_ps(_mm_setzero_ps(), t);
+
+			// Columns to rows
+			_MM_TRANSPOSE4_PS(i0, i1, i2, t);
+
+			affine<float, Q> Result;
+			_mm_storeu_ps(&Result[0].x, i0);
+			_mm_storeu_ps(&Result[1].x, i1);
+			_mm_storeu_ps(&Result[2].x, i2);
+			return Result;
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
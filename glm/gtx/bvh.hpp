@@ -0,0 +1,97 @@
+/// @ref gtx_bvh
+/// @file glm/gtx/bvh.hpp
+///
+/// @see core (dependence)
+/// @see gtx_intersect (dependence)
+///
+/// @defgroup gtx_bvh GLM_GTX_bvh
+/// @ingroup gtx
+///
+/// Include <glm/gtx/bvh.hpp> to use the features of this extension.
+///
+/// Bounding volume hierarchy over triangle soups for ray queries.
+/// The hierarchy is built with a binned surface area heuristic, in parallel using OpenMP tasks when
+/// OpenMP is enabled, and stored as a flat array of 32 bytes nodes (for float) with siblings stored side by side.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <vector>
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "../gtx/intersect.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_bvh is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_bvh extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_bvh
+	/// @{
+
+	/// Bounding volume hierarchy over a triangle soup.
+	/// Triangles are copied and reordered so that the triangles of a leaf are contiguous in memory.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q = defaultp>
+	struct bvh
+	{
+		typedef T value_type;
+
+		/// Interior nodes store the index of their first child, the second child immediately follows it.
+		/// Leaf nodes store the index of their first triangle and a non-null triangle count.
+		struct node
+		{
+			vec<3, T, Q> boxMin;
+			uint32 first;
+			vec<3, T, Q> boxMax;
+			uint32 count;
+		};
+
+		/// Flattened nodes, the root is the first node.
+		std::vector<node> nodes;
+
+		/// Reordered triangle soup, three vertices per triangle.
+		std::vector<vec<3, T, Q> > vertices;
+
+		/// Index in the input triangle soup of each reordered triangle.
+		std::vector<uint32> triangleIndices;
+	};
+
+	/// Build a bounding volume hierarchy over a triangle soup of triangleCount triangles, three vertices per triangle.
+	/// Subdivision stops when a node holds at most maxLeafSize triangles.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void buildBVH(
+		bvh<T, Q> & tree,
+		vec<3, T, Q> const* vertices, std::size_t triangleCount,
+		length_t maxLeafSize = 4);
+
+	/// Compute the closest intersection of a ray and the triangles of a bounding volume hierarchy.
+	/// Only intersections at a positive distance along dir are reported, dir doesn't need to be unit length.
+	/// triangleIndex is the index of the hit triangle in the triangle soup the hierarchy was built from.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBVH(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<2, T, Q> & baryPosition, T & distance, std::size_t & triangleIndex);
+
+	/// Return whether a ray hits any triangle of a bounding volume hierarchy at a distance in [0, maxDistance].
+	/// Traversal stops at the first intersection found, which makes it the query of choice for shadow rays.
+	/// @see gtx_bvh
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayBVHAny(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		T maxDistance);
+
+	/// @}
+}//namespace glm
+
+#include "bvh.inl"
@@ -0,0 +1,393 @@
+/// @ref gtx_bvh
+
+#include <algorithm>
+#include <limits>
+
+namespace glm{
+namespace detail
+{
+	// Depth bound of the build, also the size of the traversal stacks
+	static length_t const bvh_max_depth = 64;
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T bvh_half_area(vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax)
+	{
+		vec<3, T, Q> const e(boxMax - boxMin);
+		return e.x * e.y + e.y * e.z + e.z * e.x;
+	}
+
+	template<typename T, qualifier Q>
+	struct bvh_builder
+	{
+		typedef typename bvh<T, Q>::node node_type;
+
+		static length_t const BinCount = 16;
+
+		// Subtrees with fewer triangles are built by the thread that created them
+		static uint32 const ParallelThreshold = 4096;
+
+		struct bin
+		{
+			vec<3, T, Q> boxMin;
+			vec<3, T, Q> boxMax;
+			uint32 count;
+		};
+
+		struct centroid_less
+		{
+			centroid_less(std::vector<vec<3, T, Q> > const& c, length_t a) : Centroids(c), Axis(a) {}
+
+			bool operator()(uint32 a, uint32 b) const
+			{
+				return Centroids[a][Axis] < Centroids[b][Axis];
+			}
+
+			std::vector<vec<3, T, Q> > const& Centroids;
+			length_t Axis;
+		};
+
+		bvh_builder(std::vector<node_type> & nodes, length_t maxLeafSize, std::size_t triangleCount)
+			: Nodes(nodes)
+			, BoxMin(triangleCount)
+			, BoxMax(triangleCount)
+			, Centroids(triangleCount)
+			, Indices(triangleCount)
+			, NodeCount(1)
+			, MaxLeafSize(static_cast<uint32>(max(maxLeafSize, static_cast<length_t>(1))))
+		{}
+
+		uint32 allocate()
+		{
+			uint32 Index;
+#			if GLM_HAS_OPENMP >= 31
+#				pragma omp atomic capture
+#			endif
+			{
+				Index = NodeCount;
+				NodeCount += 2;
+			}
+			return Index;
+		}
+
+		void subdivide(uint32 NodeIndex, uint32 First, uint32 Count, length_t Depth)
+		{
+			vec<3, T, Q> NodeMin(std::numeric_limits<T>::max());
+			vec<3, T, Q> NodeMax(-std::numeric_limits<T>::max());
+			vec<3, T, Q> CentroidMin(std::numeric_limits<T>::max());
+			vec<3, T, Q> CentroidMax(-std::numeric_limits<T>::max());
+			for(uint32 i = First; i < First + Count; ++i)
+			{
+				uint32 const Tri = Indices[i];
+				NodeMin = min(NodeMin, BoxMin[Tri]);
+				NodeMax = max(NodeMax, BoxMax[Tri]);
+				CentroidMin = min(CentroidMin, Centroids[Tri]);
+				CentroidMax = max(CentroidMax, Centroids[Tri]);
+			}
+
+			node_type & Node = Nodes[NodeIndex];
+			Node.boxMin = NodeMin;
+			Node.boxMax = NodeMax;
+
+			if(Count <= MaxLeafSize || Depth + 1 >= bvh_max_depth)
+			{
+				Node.first = First;
+				Node.count = Count;
+				return;
+			}
+
+			// Evaluate the surface area heuristic at the bin boundaries of the three axes
+			T BestCost = std::numeric_limits<T>::max();
+			length_t BestAxis = 0;
+			length_t BestSplit = 0;
+			vec<3, T, Q> const Extent(CentroidMax - CentroidMin);
+			for(length_t Axis = 0; Axis < 3; ++Axis)
+			{
+				if(Extent[Axis] <= static_cast<T>(0))
+					continue;
+
+				bin Bins[BinCount];
+				for(length_t b = 0; b < BinCount; ++b)
+				{
+					Bins[b].boxMin = vec<3, T, Q>(std::numeric_limits<T>::max());
+					Bins[b].boxMax = vec<3, T, Q>(-std::numeric_limits<T>::max());
+					Bins[b].count = 0;
+				}
+
+				T const Scale = static_cast<T>(BinCount) / Extent[Axis];
+				for(uint32 i = First; i < First + Count; ++i)
+				{
+					uint32 const Tri = Indices[i];
+					length_t const b = min(static_cast<length_t>((Centroids[Tri][Axis] - CentroidMin[Axis]) * Scale), BinCount - 1);
+					Bins[b].boxMin = min(Bins[b].boxMin, BoxMin[Tri]);
+					Bins[b].boxMax = max(Bins[b].boxMax, BoxMax[Tri]);
+					Bins[b].count += 1;
+				}
+
+				// Right to left sweep stores the cost of the right side of each split
+				T RightCost[BinCount];
+				vec<3, T, Q> SweepMin(std::numeric_limits<T>::max());
+				vec<3, T, Q> SweepMax(-std::numeric_limits<T>::max());
+				uint32 SweepCount = 0;
+				for(length_t b = BinCount - 1; b > 0; --b)
+				{
+					SweepMin = min(SweepMin, Bins[b].boxMin);
+					SweepMax = max(SweepMax, Bins[b].boxMax);
+					SweepCount += Bins[b].count;
+					RightCost[b] = SweepCount > 0 ? static_cast<T>(SweepCount) * bvh_half_area(SweepMin, SweepMax) : static_cast<T>(-1);
+				}
+
+				SweepMin = vec<3, T, Q>(std::numeric_limits<T>::max());
+				SweepMax = vec<3, T, Q>(-std::numeric_limits<T>::max());
+				SweepCount = 0;
+				for(length_t b = 0; b < BinCount - 1; ++b)
+				{
+					SweepMin = min(SweepMin, Bins[b].boxMin);
+					SweepMax = max(SweepMax, Bins[b].boxMax);
+					SweepCount += Bins[b].count;
+					if(SweepCount == 0 || RightCost[b + 1] < static_cast<T>(0))
+						continue;
+
+					T const Cost = static_cast<T>(SweepCount) * bvh_half_area(SweepMin, SweepMax) + RightCost[b + 1];
+					if(Cost < BestCost)
+					{
+						BestCost = Cost;
+						BestAxis = Axis;
+						BestSplit = b;
+					}
+				}
+			}
+
+			uint32 Mid = First + Count / 2;
+			if(BestCost < std::numeric_limits<T>::max())
+			{
+				T const Scale = static_cast<T>(BinCount) / Extent[BestAxis];
+				uint32* Begin = &Indices[0] + First;
+				uint32* Split = Begin;
+				for(uint32* i = Begin; i != Begin + Count; ++i)
+				{
+					length_t const b = min(static_cast<length_t>((Centroids[*i][BestAxis] - CentroidMin[BestAxis]) * Scale), BinCount - 1);
+					if(b <= BestSplit)
+						std::swap(*i, *Split++);
+				}
+				Mid = First + static_cast<uint32>(Split - Begin);
+			}
+			else
+			{
+				// All the centroids are coincident, or binned to a single bin: split at the median of the widest axis
+				length_t const Axis = Extent.x >= Extent.y && Extent.x >= Extent.z ? 0 : (Extent.y >= Extent.z ? 1 : 2);
+				std::nth_element(Indices.begin() + First, Indices.begin() + Mid, Indices.begin() + First + Count, centroid_less(Centroids, Axis));
+			}
+
+			uint32 const Child = allocate();
+			Node.first = Child;
+			Node.count = 0;
+
+#			if GLM_HAS_OPENMP >= 31
+#				pragma omp task if(Count > ParallelThreshold)
+#			endif
+			subdivide(Child, First, Mid - First, Depth + 1);
+			subdivide(Child + 1, Mid, First + Count - Mid, Depth + 1);
+		}
+
+		std::vector<node_type> & Nodes;
+		std::vector<vec<3, T, Q> > BoxMin;
+		std::vector<vec<3, T, Q> > BoxMax;
+		std::vector<vec<3, T, Q> > Centroids;
+		std::vector<uint32> Indices;
+		uint32 NodeCount;
+		uint32 const MaxLeafSize;
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildBVH
+	(
+		bvh<T, Q> & tree,
+		vec<3, T, Q> const* vertices, std::size_t triangleCount,
+		length_t maxLeafSize
+	)
+	{
+		tree.nodes.clear();
+		tree.vertices.clear();
+		tree.triangleIndices.clear();
+		if(triangleCount == 0)
+			return;
+
+		// A binary tree with one triangle per leaf at most has 2 * N - 1 nodes
+		tree.nodes.resize(triangleCount * 2 - 1);
+
+		detail::bvh_builder<T, Q> Builder(tree.nodes, maxLeafSize, triangleCount);
+
+		std::ptrdiff_t const Count = static_cast<std::ptrdiff_t>(triangleCount);
+#		if GLM_HAS_OPENMP >= 31
+#			pragma omp parallel for
+#		endif
+		for(std::ptrdiff_t i = 0; i < Count; ++i)
+		{
+			vec<3, T, Q> const& v0 = vertices[i * 3 + 0];
+			vec<3, T, Q> const& v1 = vertices[i * 3 + 1];
+			vec<3, T, Q> const& v2 = vertices[i * 3 + 2];
+			Builder.BoxMin[i] = min(min(v0, v1), v2);
+			Builder.BoxMax[i] = max(max(v0, v1), v2);
+			Builder.Centroids[i] = (Builder.BoxMin[i] + Builder.BoxMax[i]) * static_cast<T>(0.5);
+			Builder.Indices[i] = static_cast<uint32>(i);
+		}
+
+#		if GLM_HAS_OPENMP >= 31
+#			pragma omp parallel
+#			pragma omp single nowait
+#		endif
+		Builder.subdivide(0, 0, static_cast<uint32>(triangleCount), 0);
+
+		tree.nodes.resize(Builder.NodeCount);
+		tree.vertices.resize(triangleCount * 3);
+		tree.triangleIndices.swap(Builder.Indices);
+
+#		if GLM_HAS_OPENMP >= 31
+#			pragma omp parallel for
+#		endif
+		for(std::ptrdiff_t i = 0; i < Count; ++i)
+		{
+			std::size_t const Tri = tree.triangleIndices[i];
+			tree.vertices[i * 3 + 0] = vertices[Tri * 3 + 0];
+			tree.vertices[i * 3 + 1] = vertices[Tri * 3 + 1];
+			tree.vertices[i * 3 + 2] = vertices[Tri * 3 + 2];
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBVH
+	(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		vec<2, T, Q> & baryPosition, T & distance, std::size_t & triangleIndex
+	)
+	{
+		typedef typename bvh<T, Q>::node node_type;
+
+		if(tree.nodes.empty())
+			return false;
+
+		ray<T, Q> const Ray(orig, dir);
+
+		T Near = static_cast<T>(0), Far = static_cast<T>(0);
+		if(!intersectRayAABB(Ray, tree.nodes[0].boxMin, tree.nodes[0].boxMax, Near, Far))
+			return false;
+
+		struct entry
+		{
+			uint32 node;
+			T nearDistance;
+		};
+
+		entry Stack[detail::bvh_max_depth];
+		length_t StackSize = 0;
+
+		T Closest = std::numeric_limits<T>::infinity();
+		bool Hit = false;
+		uint32 NodeIndex = 0;
+		for(;;)
+		{
+			node_type const& Node = tree.nodes[NodeIndex];
+			if(Node.count > 0)
+			{
+				for(uint32 i = Node.first; i < Node.first + Node.count; ++i)
+				{
+					vec<2, T, Q> Bary;
+					T Distance;
+					if(intersectRayTriangle(orig, dir, tree.vertices[i * 3 + 0], tree.vertices[i * 3 + 1], tree.vertices[i * 3 + 2], Bary, Distance) &&
+						Distance >= static_cast<T>(0) && Distance < Closest)
+					{
+						Closest = Distance;
+						baryPosition = Bary;
+						triangleIndex = tree.triangleIndices[i];
+						Hit = true;
+					}
+				}
+			}
+			else
+			{
+				node_type const& Left = tree.nodes[Node.first];
+				node_type const& Right = tree.nodes[Node.first + 1];
+
+				T NearLeft = static_cast<T>(0), NearRight = static_cast<T>(0);
+				bool const HitLeft = intersectRayAABB(Ray, Left.boxMin, Left.boxMax, NearLeft, Far) && NearLeft < Closest;
+				bool const HitRight = intersectRayAABB(Ray, Right.boxMin, Right.boxMax, NearRight, Far) && NearRight < Closest;
+
+				if(HitLeft && HitRight)
+				{
+					// Visit the nearest child first, the other one may be culled by the hit found meanwhile
+					bool const LeftFirst = NearLeft <= NearRight;
+					entry const Deferred = {LeftFirst ? Node.first + 1 : Node.first, LeftFirst ? NearRight : NearLeft};
+					Stack[StackSize++] = Deferred;
+					NodeIndex = LeftFirst ? Node.first : Node.first + 1;
+					continue;
+				}
+				else if(HitLeft || HitRight)
+				{
+					NodeIndex = HitLeft ? Node.first : Node.first + 1;
+					continue;
+				}
+			}
+
+			// Pop the next node which may still hold a closer intersection
+			while(StackSize > 0 && Stack[StackSize - 1].nearDistance >= Closest)
+				--StackSize;
+			if(StackSize == 0)
+				break;
+			NodeIndex = Stack[--StackSize].node;
+		}
+
+		if(Hit)
+			distance = Closest;
+		return Hit;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayBVHAny
+	(
+		bvh<T, Q> const& tree,
+		vec<3, T, Q> const& orig, vec<3, T, Q> const& dir,
+		T maxDistance
+	)
+	{
+		typedef typename bvh<T, Q>::node node_type;
+
+		if(tree.nodes.empty())
+			return false;
+
+		ray<T, Q> const Ray(orig, dir);
+
+		uint32 Stack[detail::bvh_max_depth];
+		length_t StackSize = 0;
+		Stack[StackSize++] = 0;
+
+		while(StackSize > 0)
+		{
+			node_type const& Node = tree.nodes[Stack[--StackSize]];
+
+			T Near = static_cast<T>(0), Far = static_cast<T>(0);
+			if(!intersectRayAABB(Ray, Node.boxMin, Node.boxMax, Near, Far) || Near > maxDistance)
+				continue;
+
+			if(Node.count > 0)
+			{
+				for(uint32 i = Node.first; i < Node.first + Node.count; ++i)
+				{
+					vec<2, T, Q> Bary;
+					T Distance;
+					if(intersectRayTriangle(orig, dir, tree.vertices[i * 3 + 0], tree.vertices[i * 3 + 1], tree.vertices[i * 3 + 2], Bary, Distance) &&
+						Distance >= static_cast<T>(0) && Distance <= maxDistance)
+						return true;
+				}
+			}
+			else
+			{
+				Stack[StackSize++] = Node.first + 1;
+				Stack[StackSize++] = Node.first;
+			}
+		}
+
+		return false;
+	}
+}//namespace glm
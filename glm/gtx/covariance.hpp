@@ -0,0 +1,91 @@
+/// @ref gtx_covariance
+/// @file glm/gtx/covariance.hpp
+///
+/// @see core (dependence)
+/// @see gtx_matrix_factorisation
+///
+/// @defgroup gtx_covariance GLM_GTX_covariance
+/// @ingroup gtx
+///
+/// Include <glm/gtx/covariance.hpp> to use the features of this extension.
+///
+/// Streaming covariance of 3D points.
+/// The points are accumulated relative to the first one, which avoids the cancellation of the naive sums of squares
+/// for points far from the origin, and accumulators of disjoint point sets can be merged.
+/// The normal of a neighborhood is the last eigenvector returned by eigen_decompose_symmetric for its covariance matrix.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include "../glm.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_covariance is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_covariance extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_covariance
+	/// @{
+
+	/// Sums of a set of points and of their products, relative to origin.
+	/// @see gtx_covariance
+	template<typename T, qualifier Q = defaultp>
+	struct covariance_accumulator
+	{
+		typedef T value_type;
+
+		/// Build an empty accumulator.
+		GLM_FUNC_DECL covariance_accumulator();
+
+		/// Number of accumulated points.
+		std::size_t count;
+
+		/// First accumulated point, subtracted from the next ones.
+		vec<3, T, Q> origin;
+
+		/// Sum of the points minus origin.
+		vec<3, T, Q> sum;
+
+		/// Sums of the squares of the coordinates minus origin: xx, yy and zz.
+		vec<3, T, Q> sumSquares;
+
+		/// Sums of the products of the coordinates minus origin: xy, xz and yz.
+		vec<3, T, Q> sumProducts;
+	};
+
+	/// Add a point to the accumulator.
+	/// @see gtx_covariance
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void accumulateCovariance(covariance_accumulator<T, Q>& accumulator, vec<3, T, Q> const& p);
+
+	/// Add count points to the accumulator.
+	/// The points are summed in blocks to limit the rounding errors of long float streams.
+	/// @see gtx_covariance
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void accumulateCovariance(covariance_accumulator<T, Q>& accumulator, vec<3, T, Q> const* points, std::size_t count);
+
+	/// Add the points of another accumulator, for instance built by another thread.
+	/// @see gtx_covariance
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mergeCovariance(covariance_accumulator<T, Q>& accumulator, covariance_accumulator<T, Q> const& other);
+
+	/// Mean of the accumulated points, the origin when there is none.
+	/// @see gtx_covariance
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, T, Q> covarianceMean(covariance_accumulator<T, Q> const& accumulator);
+
+	/// Population covariance matrix of the accumulated points, the null matrix when there is none.
+	/// @see gtx_covariance
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<3, 3, T, Q> covarianceMatrix(covariance_accumulator<T, Q> const& accumulator);
+
+	/// @}
+}//namespace glm
+
+#include "covariance.inl"
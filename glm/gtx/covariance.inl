@@ -0,0 +1,112 @@
+/// @ref gtx_covariance
+
+namespace glm
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER covariance_accumulator<T, Q>::covariance_accumulator()
+		: count(0)
+		, origin(static_cast<T>(0))
+		, sum(static_cast<T>(0))
+		, sumSquares(static_cast<T>(0))
+		, sumProducts(static_cast<T>(0))
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<T, Q>& accumulator, vec<3, T, Q> const& p)
+	{
+		if(accumulator.count == 0)
+			accumulator.origin = p;
+
+		vec<3, T, Q> const d(p - accumulator.origin);
+		accumulator.count += 1;
+		accumulator.sum += d;
+		accumulator.sumSquares += d * d;
+		accumulator.sumProducts += vec<3, T, Q>(d.x * d.y, d.x * d.z, d.y * d.z);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void accumulateCovariance(covariance_accumulator<T, Q>& accumulator, vec<3, T, Q> const* points, std::size_t count)
+	{
+		if(count == 0)
+			return;
+		if(accumulator.count == 0)
+			accumulator.origin = points[0];
+
+		std::size_t const BlockSize = 1024;
+		T const ox = accumulator.origin.x, oy = accumulator.origin.y, oz = accumulator.origin.z;
+		for(std::size_t First = 0; First < count; First += BlockSize)
+		{
+			std::size_t const Last = count - First < BlockSize ? count : First + BlockSize;
+
+			// Scalar sums the compiler keeps in registers
+			T sx(0), sy(0), sz(0), sxx(0), syy(0), szz(0), sxy(0), sxz(0), syz(0);
+			for(std::size_t i = First; i < Last; ++i)
+			{
+				T const x = points[i].x - ox, y = points[i].y - oy, z = points[i].z - oz;
+				sx += x;
+				sy += y;
+				sz += z;
+				sxx += x * x;
+				syy += y * y;
+				szz += z * z;
+				sxy += x * y;
+				sxz += x * z;
+				syz += y * z;
+			}
+
+			accumulator.sum += vec<3, T, Q>(sx, sy, sz);
+			accumulator.sumSquares += vec<3, T, Q>(sxx, syy, szz);
+			accumulator.sumProducts += vec<3, T, Q>(sxy, sxz, syz);
+		}
+		accumulator.count += count;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mergeCovariance(covariance_accumulator<T, Q>& accumulator, covariance_accumulator<T, Q> const& other)
+	{
+		if(other.count == 0)
+			return;
+		if(accumulator.count == 0)
+		{
+			accumulator = other;
+			return;
+		}
+
+		// Move the sums of other to the origin of accumulator, with d' = d + Shift
+		vec<3, T, Q> const Shift(other.origin - accumulator.origin);
+		T const n = static_cast<T>(other.count);
+		vec<3, T, Q> const s(other.sum);
+		accumulator.count += other.count;
+		accumulator.sum += s + n * Shift;
+		accumulator.sumSquares += other.sumSquares + static_cast<T>(2) * Shift * s + n * Shift * Shift;
+		accumulator.sumProducts += other.sumProducts
+			+ vec<3, T, Q>(Shift.x * s.y + s.x * Shift.y, Shift.x * s.z + s.x * Shift.z, Shift.y * s.z + s.y * Shift.z)
+			+ n * vec<3, T, Q>(Shift.x * Shift.y, Shift.x * Shift.z, Shift.y * Shift.z);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, T, Q> covarianceMean(covariance_accumulator<T, Q> const& accumulator)
+	{
+		if(accumulator.count == 0)
+			return accumulator.origin;
+		return accumulator.origin + accumulator.sum / static_cast<T>(accumulator.count);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<3, 3, T, Q> covarianceMatrix(covariance_accumulator<T, Q> const& accumulator)
+	{
+		if(accumulator.count == 0)
+			return mat<3, 3, T, Q>(static_cast<T>(0));
+
+		// E[d d^T] - E[d] E[d]^T, the shift does not change the covariance
+		T const InverseCount = static_cast<T>(1) / static_cast<T>(accumulator.count);
+		vec<3, T, Q> const Mean(accumulator.sum * InverseCount);
+		vec<3, T, Q> const Squares(accumulator.sumSquares * InverseCount - Mean * Mean);
+		vec<3, T, Q> const Products(accumulator.sumProducts * InverseCount - vec<3, T, Q>(Mean.x * Mean.y, Mean.x * Mean.z, Mean.y * Mean.z));
+
+		return mat<3, 3, T, Q>(
+			Squares.x, Products.x, Products.y,
+			Products.x, Squares.y, Products.z,
+			Products.y, Products.z, Squares.z);
+	}
+}//namespace glm
@@ -20,6 +20,8 @@
 #include "../glm.hpp"
 #include "../gtc/constants.hpp"
 #include "../detail/qualifier.hpp"
+#include "../detail/compute_lane.hpp"
+#include <cstddef>
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -213,6 +215,127 @@ namespace glm{
 	template <typename genType>
 	GLM_FUNC_DECL genType bounceEaseInOut(genType const& a);
 
+	/// The easing functions evaluated by easingBatch
+	/// @see gtx_easing
+	enum easing_function
+	{
+		easing_linear_interpolation,
+		easing_quadratic_in,
+		easing_quadratic_out,
+		easing_quadratic_in_out,
+		easing_cubic_in,
+		easing_cubic_out,
+		easing_cubic_in_out,
+		easing_quartic_in,
+		easing_quartic_out,
+		easing_quartic_in_out,
+		easing_quintic_in,
+		easing_quintic_out,
+		easing_quintic_in_out,
+		easing_sine_in,
+		easing_sine_out,
+		easing_sine_in_out,
+		easing_circular_in,
+		easing_circular_out,
+		easing_circular_in_out,
+		easing_exponential_in,
+		easing_exponential_out,
+		easing_exponential_in_out,
+		easing_elastic_in,
+		easing_elastic_out,
+		easing_elastic_in_out,
+		easing_back_in,
+		easing_back_out,
+		easing_back_in_out,
+		easing_bounce_in,
+		easing_bounce_out,
+		easing_bounce_in_out
+	};
+
+	/// Component-wise easing functions of vectors, the vectors of floats are eased in SIMD lanes without branches, like easingBatch
+	/// @see gtx_easing
+	/// @{
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> linearInterpolation(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quadraticEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quadraticEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quadraticEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> cubicEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> cubicEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> cubicEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quarticEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quarticEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quarticEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quinticEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quinticEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> quinticEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sineEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sineEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sineEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> circularEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> circularEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> circularEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> exponentialEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> exponentialEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> exponentialEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> elasticEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> elasticEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> elasticEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a, T const& o);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a, T const& o);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a, T const& o);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> bounceEaseIn(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> bounceEaseOut(vec<L, T, Q> const& a);
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> bounceEaseInOut(vec<L, T, Q> const& a);
+	/// @}
+
+	/// Eases the count parameters a with function into out, in SIMD lanes for floats.
+	/// The piecewise functions select their pieces without branches.
+	/// @see gtx_easing
+	template<typename T>
+	GLM_FUNC_DECL void easingBatch(easing_function function, T const* a, std::size_t count, T* out);
+
+	/// Eases the count parameters a with function into out, with the overshoot o of the back functions.
+	/// @see gtx_easing
+	template<typename T>
+	GLM_FUNC_DECL void easingBatch(easing_function function, T const* a, std::size_t count, T* out, T o);
+
 	/// @}
 }//namespace glm
 
@@ -433,4 +433,756 @@ namespace glm{
 		}
 	}
 
+namespace detail
+{
+	// The easing functions as kernels: scalar() evaluates the function of the extension, lanes() evaluates it without
+	// branches on SIMD lanes, both pieces of the piecewise functions are computed and selected per lane.
+	struct ease_linear_interpolation
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return linearInterpolation(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&) { return a; }
+	};
+
+	struct ease_quadratic_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quadraticEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&) { return a * a; }
+	};
+
+	struct ease_quadratic_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quadraticEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&) { return a * (V(2) - a); }
+	};
+
+	struct ease_quadratic_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quadraticEaseInOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V const In = V(2) * a * a;
+			V const Out = (V(4) - V(2) * a) * a - V(1);
+			return lane_select(a < V(0.5), In, Out);
+		}
+	};
+
+	struct ease_cubic_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return cubicEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&) { return a * a * a; }
+	};
+
+	struct ease_cubic_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return cubicEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V const f = a - V(1);
+			return f * f * f + V(1);
+		}
+	};
+
+	struct ease_cubic_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return cubicEaseInOut(a); }
+
+		// (1/2)(2x)^3 and (1/2)(2x-2)^3 + 1
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V const f = lane_select(In, V(2) * a, V(2) * a - V(2));
+			return V(0.5) * f * f * f + lane_select(In, V(0), V(1));
+		}
+	};
+
+	struct ease_quartic_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quarticEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V const a2 = a * a;
+			return a2 * a2;
+		}
+	};
+
+	struct ease_quartic_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quarticEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V const f = a - V(1);
+			V const f2 = f * f;
+			return V(1) - f2 * f2;
+		}
+	};
+
+	struct ease_quartic_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quarticEaseInOut(a); }
+
+		// 8x^4 and 1 - 8(x-1)^4
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V const f = lane_select(In, a, a - V(1));
+			V const f2 = f * f;
+			V const p = V(8) * f2 * f2;
+			return lane_select(In, p, V(1) - p);
+		}
+	};
+
+	struct ease_quintic_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quinticEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V const a2 = a * a;
+			return a2 * a2 * a;
+		}
+	};
+
+	struct ease_quintic_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quinticEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V const f = a - V(1);
+			V const f2 = f * f;
+			return f2 * f2 * f + V(1);
+		}
+	};
+
+	struct ease_quintic_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return quinticEaseInOut(a); }
+
+		// (1/2)(2x)^5 and (1/2)(2x-2)^5 + 1
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V const f = lane_select(In, V(2) * a, V(2) * a - V(2));
+			V const f2 = f * f;
+			return V(0.5) * f2 * f2 * f + lane_select(In, V(0), V(1));
+		}
+	};
+
+	struct ease_sine_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return sineEaseIn(a); }
+
+		// sin((x - 1)pi/2) + 1 is 1 - cos(x pi/2)
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V s, c;
+			lane_sincos(a * V(1.57079632679489661923), s, c);
+			return V(1) - c;
+		}
+	};
+
+	struct ease_sine_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return sineEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V s, c;
+			lane_sincos(a * V(1.57079632679489661923), s, c);
+			return s;
+		}
+	};
+
+	struct ease_sine_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return sineEaseInOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V s, c;
+			lane_sincos(a * V(3.14159265358979323846), s, c);
+			return V(0.5) * (V(1) - c);
+		}
+	};
+
+	struct ease_circular_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return circularEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			return V(1) - lane_sqrt(lane_max(V(1) - a * a, V(0)));
+		}
+	};
+
+	struct ease_circular_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return circularEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			return lane_sqrt(lane_max((V(2) - a) * a, V(0)));
+		}
+	};
+
+	struct ease_circular_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return circularEaseInOut(a); }
+
+		// (1/2)(1 - sqrt(1 - 4x^2)) and (1/2)(sqrt(-(2x - 3)(2x - 1)) + 1), one square root of the selected piece
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V const b = V(2) * a;
+			V const Root = lane_sqrt(lane_max(lane_select(In, V(1) - b * b, (V(3) - b) * (b - V(1))), V(0)));
+			return V(0.5) * (lane_select(In, -Root, Root) + V(1));
+		}
+	};
+
+	struct ease_exponential_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return exponentialEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			return lane_select(a > V(0), lane_exp2(V(10) * (a - V(1))), a);
+		}
+	};
+
+	struct ease_exponential_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return exponentialEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			return lane_select(a < V(1), V(1) - lane_exp2(V(-10) * a), a);
+		}
+	};
+
+	struct ease_exponential_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return exponentialEaseInOut(a); }
+
+		// (1/2)2^(20x - 10) and 1 - (1/2)2^(10 - 20x), one power of the selected piece
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V const e = V(20) * a - V(10);
+			V const p = V(0.5) * lane_exp2(lane_select(In, e, -e));
+			return lane_select(In, p, V(1) - p);
+		}
+	};
+
+	struct ease_elastic_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return elasticEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V s, c;
+			lane_sincos(V(20.420352248333656) * a, s, c);
+			return s * lane_exp2(V(10) * (a - V(1)));
+		}
+	};
+
+	struct ease_elastic_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return elasticEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			V s, c;
+			lane_sincos(V(-20.420352248333656) * (a + V(1)), s, c);
+			return s * lane_exp2(V(-10) * a) + V(1);
+		}
+	};
+
+	struct ease_elastic_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return elasticEaseInOut(a); }
+
+		// Both pieces are (1/2)sin(13pi x)2^(20x - 10) and 1 - (1/2)sin(13pi x)2^(10 - 20x), one sine and one power
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V s, c;
+			lane_sincos(V(40.840704496667312) * a, s, c);
+			V const e = V(20) * a - V(10);
+			V const p = V(0.5) * s * lane_exp2(lane_select(In, e, -e));
+			return lane_select(In, p, V(1) - p);
+		}
+	};
+
+	struct ease_back_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T o) { return backEaseIn(a, o); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const& o)
+		{
+			return a * a * ((o + V(1)) * a - o);
+		}
+	};
+
+	struct ease_back_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T o) { return backEaseOut(a, o); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const& o)
+		{
+			V const n = a - V(1);
+			return n * n * ((o + V(1)) * n + o) + V(1);
+		}
+	};
+
+	struct ease_back_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T o) { return backEaseInOut(a, o); }
+
+		// (1/2)n^2((s + 1)n - s) and (1/2)(m^2((s + 1)m + s) + 2) with n = 2x, m = 2x - 2 and s = 1.525o
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const& o)
+		{
+			V const s = o * V(1.525);
+			V const n = V(2) * a;
+			M const In = n < V(1);
+			V const m = lane_select(In, n, n - V(2));
+			return V(0.5) * (m * m * ((s + V(1)) * m + lane_select(In, -s, s))) + lane_select(In, V(0), V(1));
+		}
+	};
+
+	// The four parabolas of bounceEaseOut as Ax^2 + Bx + C, their coefficients selected from the last piece down to the first
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER V lane_bounce_out(V const& a)
+	{
+		M const Piece3 = a < V(9.0 / 10.0);
+		M const Piece2 = a < V(8.0 / 11.0);
+		M const Piece1 = a < V(4.0 / 11.0);
+
+		V A = lane_select(Piece3, V(4356.0 / 361.0), V(54.0 / 5.0));
+		V B = lane_select(Piece3, V(-35442.0 / 1805.0), V(-513.0 / 25.0));
+		V C = lane_select(Piece3, V(16061.0 / 1805.0), V(268.0 / 25.0));
+		A = lane_select(Piece2, V(363.0 / 40.0), A);
+		B = lane_select(Piece2, V(-99.0 / 10.0), B);
+		C = lane_select(Piece2, V(17.0 / 5.0), C);
+		A = lane_select(Piece1, V(121.0 / 16.0), A);
+		B = lane_select(Piece1, V(0), B);
+		C = lane_select(Piece1, V(0), C);
+
+		return (A * a + B) * a + C;
+	}
+
+	struct ease_bounce_in
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return bounceEaseIn(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			return V(1) - lane_bounce_out<V, M>(V(1) - a);
+		}
+	};
+
+	struct ease_bounce_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return bounceEaseOut(a); }
+
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			return lane_bounce_out<V, M>(a);
+		}
+	};
+
+	struct ease_bounce_in_out
+	{
+		template<typename T>
+		GLM_FUNC_QUALIFIER static T scalar(T a, T) { return bounceEaseInOut(a); }
+
+		// (1/2)(1 - bounceEaseOut(2x)) and (1/2)bounceEaseOut(2x - 1) + 1/2, one bounce of the selected piece
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static V lanes(V const& a, V const&)
+		{
+			M const In = a < V(0.5);
+			V const b = V(0.5) * lane_bounce_out<V, M>(lane_select(In, V(2) * a, V(2) * a - V(1)));
+			return lane_select(In, V(0.5) - b, b + V(0.5));
+		}
+	};
+
+	template<typename Kernel, length_t L, typename T, qualifier Q, bool UseSimd>
+	struct compute_easing_vec
+	{
+		GLM_FUNC_QUALIFIER static vec<L, T, Q> call(vec<L, T, Q> const& a, T o)
+		{
+			vec<L, T, Q> Result;
+			for(length_t c = 0; c < L; ++c)
+				Result[c] = Kernel::scalar(a[c], o);
+			return Result;
+		}
+	};
+
+	template<typename Kernel, typename T, bool UseSimd>
+	struct compute_easing_batch
+	{
+		GLM_FUNC_QUALIFIER static void call(T const* a, std::size_t count, T o, T* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = Kernel::scalar(a[i], o);
+		}
+	};
+
+	template<typename Kernel, typename T>
+	GLM_FUNC_QUALIFIER void easing_batch(T const* a, std::size_t count, T o, T* out)
+	{
+		compute_easing_batch<Kernel, T, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, count, o, out);
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> linearInterpolation(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_linear_interpolation, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quadraticEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quadratic_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quadraticEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quadratic_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quadraticEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quadratic_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> cubicEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_cubic_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> cubicEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_cubic_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> cubicEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_cubic_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quarticEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quartic_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quarticEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quartic_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quarticEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quartic_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quinticEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quintic_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quinticEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quintic_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> quinticEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_quintic_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sineEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_sine_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sineEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_sine_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sineEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_sine_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> circularEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_circular_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> circularEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_circular_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> circularEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_circular_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> exponentialEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_exponential_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> exponentialEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_exponential_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> exponentialEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_exponential_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> elasticEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_elastic_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> elasticEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_elastic_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> elasticEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_elastic_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_back_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(1.70158));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseIn(vec<L, T, Q> const& a, T const& o)
+	{
+		return detail::compute_easing_vec<detail::ease_back_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, o);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_back_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(1.70158));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseOut(vec<L, T, Q> const& a, T const& o)
+	{
+		return detail::compute_easing_vec<detail::ease_back_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, o);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_back_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(1.70158));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> backEaseInOut(vec<L, T, Q> const& a, T const& o)
+	{
+		return detail::compute_easing_vec<detail::ease_back_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, o);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> bounceEaseIn(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_bounce_in, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> bounceEaseOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_bounce_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> bounceEaseInOut(vec<L, T, Q> const& a)
+	{
+		return detail::compute_easing_vec<detail::ease_bounce_in_out, L, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, static_cast<T>(0));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void easingBatch(easing_function function, T const* a, std::size_t count, T* out)
+	{
+		easingBatch(function, a, count, out, static_cast<T>(1.70158));
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER void easingBatch(easing_function function, T const* a, std::size_t count, T* out, T o)
+	{
+		switch(function)
+		{
+		case easing_linear_interpolation:
+			return detail::easing_batch<detail::ease_linear_interpolation>(a, count, o, out);
+		case easing_quadratic_in:
+			return detail::easing_batch<detail::ease_quadratic_in>(a, count, o, out);
+		case easing_quadratic_out:
+			return detail::easing_batch<detail::ease_quadratic_out>(a, count, o, out);
+		case easing_quadratic_in_out:
+			return detail::easing_batch<detail::ease_quadratic_in_out>(a, count, o, out);
+		case easing_cubic_in:
+			return detail::easing_batch<detail::ease_cubic_in>(a, count, o, out);
+		case easing_cubic_out:
+			return detail::easing_batch<detail::ease_cubic_out>(a, count, o, out);
+		case easing_cubic_in_out:
+			return detail::easing_batch<detail::ease_cubic_in_out>(a, count, o, out);
+		case easing_quartic_in:
+			return detail::easing_batch<detail::ease_quartic_in>(a, count, o, out);
+		case easing_quartic_out:
+			return detail::easing_batch<detail::ease_quartic_out>(a, count, o, out);
+		case easing_quartic_in_out:
+			return detail::easing_batch<detail::ease_quartic_in_out>(a, count, o, out);
+		case easing_quintic_in:
+			return detail::easing_batch<detail::ease_quintic_in>(a, count, o, out);
+		case easing_quintic_out:
+			return detail::easing_batch<detail::ease_quintic_out>(a, count, o, out);
+		case easing_quintic_in_out:
+			return detail::easing_batch<detail::ease_quintic_in_out>(a, count, o, out);
+		case easing_sine_in:
+			return detail::easing_batch<detail::ease_sine_in>(a, count, o, out);
+		case easing_sine_out:
+			return detail::easing_batch<detail::ease_sine_out>(a, count, o, out);
+		case easing_sine_in_out:
+			return detail::easing_batch<detail::ease_sine_in_out>(a, count, o, out);
+		case easing_circular_in:
+			return detail::easing_batch<detail::ease_circular_in>(a, count, o, out);
+		case easing_circular_out:
+			return detail::easing_batch<detail::ease_circular_out>(a, count, o, out);
+		case easing_circular_in_out:
+			return detail::easing_batch<detail::ease_circular_in_out>(a, count, o, out);
+		case easing_exponential_in:
+			return detail::easing_batch<detail::ease_exponential_in>(a, count, o, out);
+		case easing_exponential_out:
+			return detail::easing_batch<detail::ease_exponential_out>(a, count, o, out);
+		case easing_exponential_in_out:
+			return detail::easing_batch<detail::ease_exponential_in_out>(a, count, o, out);
+		case easing_elastic_in:
+			return detail::easing_batch<detail::ease_elastic_in>(a, count, o, out);
+		case easing_elastic_out:
+			return detail::easing_batch<detail::ease_elastic_out>(a, count, o, out);
+		case easing_elastic_in_out:
+			return detail::easing_batch<detail::ease_elastic_in_out>(a, count, o, out);
+		case easing_back_in:
+			return detail::easing_batch<detail::ease_back_in>(a, count, o, out);
+		case easing_back_out:
+			return detail::easing_batch<detail::ease_back_out>(a, count, o, out);
+		case easing_back_in_out:
+			return detail::easing_batch<detail::ease_back_in_out>(a, count, o, out);
+		case easing_bounce_in:
+			return detail::easing_batch<detail::ease_bounce_in>(a, count, o, out);
+		case easing_bounce_out:
+			return detail::easing_batch<detail::ease_bounce_out>(a, count, o, out);
+		case easing_bounce_in_out:
+			return detail::easing_batch<detail::ease_bounce_in_out>(a, count, o, out);
+		}
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "easing_simd.inl"
+#endif
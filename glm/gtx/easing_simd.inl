@@ -0,0 +1,76 @@
+/// @ref gtx_easing
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The components of a vector are eased in the lanes of a lane4, the lanes past L repeat the first component
+	template<typename Kernel, length_t L, qualifier Q>
+	struct compute_easing_vec<Kernel, L, float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static vec<L, float, Q> call(vec<L, float, Q> const& a, float o)
+		{
+			float In[4] = {a[0], a[0], a[0], a[0]};
+			for(length_t c = 1; c < L; ++c)
+				In[c] = a[c];
+
+			lane4 x;
+			lane_load(In, 0, x);
+
+			float Out[4];
+			lane_store(Kernel::template lanes<lane4, lane_mask4>(x, lane4(static_cast<double>(o))), 0, Out);
+
+			vec<L, float, Q> Result;
+			for(length_t c = 0; c < L; ++c)
+				Result[c] = Out[c];
+			return Result;
+		}
+	};
+
+	// The parameters are eased Width at a time
+	template<typename Kernel>
+	struct compute_easing_batch<Kernel, float, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			typedef lane_mask8 lane_mask;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			typedef lane_mask4 lane_mask;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static void call(float const* a, std::size_t count, float o, float* out)
+		{
+			lane const Overshoot(static_cast<double>(o));
+
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane x;
+				lane_load(a, i, x);
+				lane_store(Kernel::template lanes<lane, lane_mask>(x, Overshoot), i, out);
+			}
+			if(i == count)
+				return;
+
+			// The tail goes through the same lanes, so that a parameter is eased alike at any index
+			float In[Width];
+			for(std::size_t j = 0; j < Width; ++j)
+				In[j] = a[i + j < count ? i + j : i];
+
+			lane x;
+			lane_load(In, 0, x);
+
+			float Out[Width];
+			lane_store(Kernel::template lanes<lane, lane_mask>(x, Overshoot), 0, Out);
+			for(std::size_t j = 0; i + j < count; ++j)
+				out[i + j] = Out[j];
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,98 @@
+/// @ref gtx_euler_angles_batch
+/// @file glm/gtx/euler_angles_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtx_euler_angles (dependence)
+/// @see gtx_quaternion_batch (dependence)
+///
+/// @defgroup gtx_euler_angles_batch GLM_GTX_euler_angles_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/euler_angles_batch.hpp> to use the features of this extension.
+///
+/// Convert arrays of Euler angles to rotation matrices or quaternions and back in a single call, for instance to import motion capture.
+/// The angles are stored as three arrays t1, t2 and t3, the rotation of the order ABC is eulerAngleA(t1) * eulerAngleB(t2) * eulerAngleC(t3)
+/// like eulerAngleABC(t1, t2, t3), and the extracted angles are those of extractEulerAngleABC.
+/// Quaternions are built from the half angles and decomposed from their rotation matrix elements without building a matrix.
+///
+/// For float and GLM_FORCE_INTRINSICS, four or eight elements are processed at once without branches, depending on SSE2 or AVX support.
+/// sin, cos and atan2 are then evaluated with polynomials, the results differ from the scalar functions by less than 1e-6 for angles in [-100, 100].
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <limits>
+#include "../glm.hpp"
+#include "../gtx/euler_angles.hpp"
+#include "../gtx/quaternion_batch.hpp"
+#include "../detail/compute_lane.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_euler_angles_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_euler_angles_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_euler_angles_batch
+	/// @{
+
+	/// Order of the three rotations, the six Tait-Bryan orders then the six proper Euler orders.
+	/// @see gtx_euler_angles_batch
+	enum euler_order
+	{
+		euler_xyz,
+		euler_xzy,
+		euler_yxz,
+		euler_yzx,
+		euler_zxy,
+		euler_zyx,
+		euler_xyx,
+		euler_xzx,
+		euler_yxy,
+		euler_yzy,
+		euler_zxz,
+		euler_zyz
+	};
+
+	/// Compute the rotations of count triples of Euler angles, out[i] = eulerAngleXYZ(t1[i], t2[i], t3[i]) for euler_xyz.
+	/// @see gtx_euler_angles_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void eulerAngleBatch(euler_order order, T const* t1, T const* t2, T const* t3, std::size_t count, mat<3, 3, T, Q>* out);
+
+	/// Compute the homogeneous rotations of count triples of Euler angles.
+	/// @see eulerAngleBatch(euler_order, T const*, T const*, T const*, std::size_t, mat<3, 3, T, Q>*)
+	/// @see gtx_euler_angles_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void eulerAngleBatch(euler_order order, T const* t1, T const* t2, T const* t3, std::size_t count, mat<4, 4, T, Q>* out);
+
+	/// Compute the unit quaternions of count triples of Euler angles, out[i] = angleAxis(t1[i], A) * angleAxis(t2[i], B) * angleAxis(t3[i], C) for the order ABC.
+	/// @see gtx_euler_angles_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void eulerAngleBatch(euler_order order, T const* t1, T const* t2, T const* t3, std::size_t count, qua<T, Q>* out);
+
+	/// Extract the Euler angles of count rotation matrices, extractEulerAngleXYZ(m[i], t1[i], t2[i], t3[i]) for euler_xyz.
+	/// @see gtx_euler_angles_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void extractEulerAngleBatch(euler_order order, mat<3, 3, T, Q> const* m, std::size_t count, T* t1, T* t2, T* t3);
+
+	/// Extract the Euler angles of count matrices whose upper left 3x3 part is a rotation.
+	/// @see extractEulerAngleBatch(euler_order, mat<3, 3, T, Q> const*, std::size_t, T*, T*, T*)
+	/// @see gtx_euler_angles_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void extractEulerAngleBatch(euler_order order, mat<4, 4, T, Q> const* m, std::size_t count, T* t1, T* t2, T* t3);
+
+	/// Extract the Euler angles of count unit quaternions, those of their rotation matrices.
+	/// @see extractEulerAngleBatch(euler_order, mat<3, 3, T, Q> const*, std::size_t, T*, T*, T*)
+	/// @see gtx_euler_angles_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void extractEulerAngleBatch(euler_order order, qua<T, Q> const* q, std::size_t count, T* t1, T* t2, T* t3);
+
+	/// @}
+}//namespace glm
+
+#include "euler_angles_batch.inl"
@@ -0,0 +1,258 @@
+/// @ref gtx_euler_angles_batch
+
+namespace glm{
+namespace detail
+{
+	// Axes i, j and k of an order, k is the axis missing from the proper orders.
+	// The rotations of an odd order are those of the even order with the same axes by the opposite angles.
+	struct euler_axes
+	{
+		length_t i, j, k;
+		bool proper;
+		float parity;
+	};
+
+	GLM_FUNC_QUALIFIER euler_axes euler_axes_of(euler_order Order)
+	{
+		static length_t const Axes[12][2] = {
+			{0, 1}, {0, 2}, {1, 0}, {1, 2}, {2, 0}, {2, 1},
+			{0, 1}, {0, 2}, {1, 0}, {1, 2}, {2, 0}, {2, 1}};
+
+		euler_axes Result;
+		Result.i = Axes[Order][0];
+		Result.j = Axes[Order][1];
+		Result.k = 3 - Result.i - Result.j;
+		Result.proper = Order >= euler_xyx;
+		Result.parity = Result.j == (Result.i + 1) % 3 ? 1.0f : -1.0f;
+		return Result;
+	}
+
+	// Rotation matrix m[c][r] of lanes of Euler angles
+	template<typename V>
+	GLM_FUNC_QUALIFIER void lane_euler_mat3(euler_axes const& Axes, V const& t1, V const& t2, V const& t3, V m[3][3])
+	{
+		length_t const i = Axes.i;
+		length_t const j = Axes.j;
+		length_t const k = Axes.k;
+		V const Parity(Axes.parity);
+
+		V s1, c1, s2, c2, s3, c3;
+		lane_sincos(t1, s1, c1);
+		lane_sincos(t2, s2, c2);
+		lane_sincos(t3, s3, c3);
+		s1 = s1 * Parity;
+		s2 = s2 * Parity;
+		s3 = s3 * Parity;
+
+		if(Axes.proper)
+		{
+			m[i][i] = c2;
+			m[j][i] = s2 * s3;
+			m[k][i] = s2 * c3;
+			m[i][j] = s1 * s2;
+			m[j][j] = c1 * c3 - s1 * c2 * s3;
+			m[k][j] = -(c1 * s3 + s1 * c2 * c3);
+			m[i][k] = -(c1 * s2);
+			m[j][k] = s1 * c3 + c1 * c2 * s3;
+			m[k][k] = c1 * c2 * c3 - s1 * s3;
+		}
+		else
+		{
+			m[i][i] = c2 * c3;
+			m[j][i] = -(c2 * s3);
+			m[k][i] = s2;
+			m[i][j] = c1 * s3 + s1 * s2 * c3;
+			m[j][j] = c1 * c3 - s1 * s2 * s3;
+			m[k][j] = -(s1 * c2);
+			m[i][k] = s1 * s3 - c1 * s2 * c3;
+			m[j][k] = s1 * c3 + c1 * s2 * s3;
+			m[k][k] = c1 * c2;
+		}
+	}
+
+	// Quaternion components x, y, z, w of lanes of Euler angles, the product of the rotations by the half angles
+	template<typename V>
+	GLM_FUNC_QUALIFIER void lane_euler_quat(euler_axes const& Axes, V const& t1, V const& t2, V const& t3, V q[4])
+	{
+		V const Parity(Axes.parity);
+
+		V s1, c1, s2, c2, s3, c3;
+		lane_sincos(t1 * V(0.5), s1, c1);
+		lane_sincos(t2 * V(0.5), s2, c2);
+		lane_sincos(t3 * V(0.5), s3, c3);
+		s1 = s1 * Parity;
+		s2 = s2 * Parity;
+		s3 = s3 * Parity;
+
+		if(Axes.proper)
+		{
+			q[3] = c2 * (c1 * c3 - s1 * s3);
+			q[Axes.i] = c2 * (c1 * s3 + s1 * c3) * Parity;
+			q[Axes.j] = s2 * (c1 * c3 + s1 * s3) * Parity;
+			q[Axes.k] = s2 * (s1 * c3 - c1 * s3) * Parity;
+		}
+		else
+		{
+			q[3] = c1 * c2 * c3 - s1 * s2 * s3;
+			q[Axes.i] = (s1 * c2 * c3 + c1 * s2 * s3) * Parity;
+			q[Axes.j] = (c1 * s2 * c3 - s1 * c2 * s3) * Parity;
+			q[Axes.k] = (c1 * c2 * s3 + s1 * s2 * c3) * Parity;
+		}
+	}
+
+	// Euler angles of lanes of rotation matrices m[c][r], with the method of Mike Day as extractEulerAngleXYZ:
+	// the third angle is computed from the elements rotated back by the first angle, which stay accurate in gimbal lock.
+	template<typename V>
+	GLM_FUNC_QUALIFIER void lane_extract_euler(euler_axes const& Axes, V const m[3][3], V& t1, V& t2, V& t3)
+	{
+		length_t const i = Axes.i;
+		length_t const j = Axes.j;
+		length_t const k = Axes.k;
+		V const Parity(Axes.parity);
+
+		if(Axes.proper)
+		{
+			t1 = lane_atan2(m[i][j], -(m[i][k] * Parity));
+			t2 = lane_atan2(lane_sqrt(m[j][i] * m[j][i] + m[k][i] * m[k][i]), m[i][i]);
+		}
+		else
+		{
+			t1 = lane_atan2(-(m[k][j] * Parity), m[k][k]);
+			t2 = lane_atan2(m[k][i] * Parity, lane_sqrt(m[i][i] * m[i][i] + m[j][i] * m[j][i]));
+		}
+
+		V s1, c1;
+		lane_sincos(t1, s1, c1);
+		s1 = s1 * Parity;
+
+		V const Cos3 = c1 * m[j][j] + s1 * m[j][k];
+		if(Axes.proper)
+			t3 = lane_atan2(-((c1 * m[k][j] + s1 * m[k][k]) * Parity), Cos3);
+		else
+			t3 = lane_atan2((c1 * m[i][j] + s1 * m[i][k]) * Parity, Cos3);
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_euler_angles_batch
+	{
+		GLM_FUNC_QUALIFIER static void euler_mat3(euler_axes const& Axes, T const* t1, T const* t2, T const* t3, std::size_t count, mat<3, 3, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Rotation[3][3];
+				lane_euler_mat3(Axes, t1[i], t2[i], t3[i], Rotation);
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					out[i][c][r] = Rotation[c][r];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void euler_mat4(euler_axes const& Axes, T const* t1, T const* t2, T const* t3, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Rotation[3][3];
+				lane_euler_mat3(Axes, t1[i], t2[i], t3[i], Rotation);
+				for(length_t c = 0; c < 3; ++c)
+				{
+					for(length_t r = 0; r < 3; ++r)
+						out[i][c][r] = Rotation[c][r];
+					out[i][c][3] = static_cast<T>(0);
+				}
+				out[i][3] = vec<4, T, Q>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void euler_quat(euler_axes const& Axes, T const* t1, T const* t2, T const* t3, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Quat[4];
+				lane_euler_quat(Axes, t1[i], t2[i], t3[i], Quat);
+				lane_store(Quat, i, out);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void extract(euler_axes const& Axes, mat<3, 3, T, Q> const* m, std::size_t count, T* t1, T* t2, T* t3)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Rotation[3][3];
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					Rotation[c][r] = m[i][c][r];
+				lane_extract_euler(Axes, Rotation, t1[i], t2[i], t3[i]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void extract(euler_axes const& Axes, mat<4, 4, T, Q> const* m, std::size_t count, T* t1, T* t2, T* t3)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Rotation[3][3];
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					Rotation[c][r] = m[i][c][r];
+				lane_extract_euler(Axes, Rotation, t1[i], t2[i], t3[i]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void extract(euler_axes const& Axes, qua<T, Q> const* q, std::size_t count, T* t1, T* t2, T* t3)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				lane_extract_euler(Axes, Rotation, t1[i], t2[i], t3[i]);
+			}
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void eulerAngleBatch(euler_order order, T const* t1, T const* t2, T const* t3, std::size_t count, mat<3, 3, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'eulerAngleBatch' only accept floating-point inputs");
+		detail::compute_euler_angles_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::euler_mat3(detail::euler_axes_of(order), t1, t2, t3, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void eulerAngleBatch(euler_order order, T const* t1, T const* t2, T const* t3, std::size_t count, mat<4, 4, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'eulerAngleBatch' only accept floating-point inputs");
+		detail::compute_euler_angles_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::euler_mat4(detail::euler_axes_of(order), t1, t2, t3, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void eulerAngleBatch(euler_order order, T const* t1, T const* t2, T const* t3, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'eulerAngleBatch' only accept floating-point inputs");
+		detail::compute_euler_angles_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::euler_quat(detail::euler_axes_of(order), t1, t2, t3, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractEulerAngleBatch(euler_order order, mat<3, 3, T, Q> const* m, std::size_t count, T* t1, T* t2, T* t3)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'extractEulerAngleBatch' only accept floating-point inputs");
+		detail::compute_euler_angles_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::extract(detail::euler_axes_of(order), m, count, t1, t2, t3);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractEulerAngleBatch(euler_order order, mat<4, 4, T, Q> const* m, std::size_t count, T* t1, T* t2, T* t3)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'extractEulerAngleBatch' only accept floating-point inputs");
+		detail::compute_euler_angles_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::extract(detail::euler_axes_of(order), m, count, t1, t2, t3);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void extractEulerAngleBatch(euler_order order, qua<T, Q> const* q, std::size_t count, T* t1, T* t2, T* t3)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'extractEulerAngleBatch' only accept floating-point inputs");
+		detail::compute_euler_angles_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::extract(detail::euler_axes_of(order), q, count, t1, t2, t3);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "euler_angles_batch_simd.inl"
+#endif
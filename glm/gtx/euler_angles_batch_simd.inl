@@ -0,0 +1,125 @@
+/// @ref gtx_euler_angles_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The remaining elements are converted by the generic path, which runs the same kernels on floats
+	template<qualifier Q>
+	struct compute_euler_angles_batch<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static void euler_mat3(euler_axes const& Axes, float const* t1, float const* t2, float const* t3, std::size_t count, mat<3, 3, float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane T1, T2, T3, Rotation[3][3];
+				lane_load(t1, i, T1);
+				lane_load(t2, i, T2);
+				lane_load(t3, i, T3);
+				lane_euler_mat3(Axes, T1, T2, T3, Rotation);
+				lane_store(Rotation, i, out);
+			}
+			compute_euler_angles_batch<float, Q, false>::euler_mat3(Axes, t1 + i, t2 + i, t3 + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void euler_mat4(euler_axes const& Axes, float const* t1, float const* t2, float const* t3, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane T1, T2, T3, Rotation[3][3];
+				lane_load(t1, i, T1);
+				lane_load(t2, i, T2);
+				lane_load(t3, i, T3);
+				lane_euler_mat3(Axes, T1, T2, T3, Rotation);
+				for(length_t c = 0; c < 3; ++c)
+				{
+					lane const Column[4] = {Rotation[c][0], Rotation[c][1], Rotation[c][2], lane(0.0)};
+					lane_store_column(Column, i, c, out);
+				}
+				lane const Translation[4] = {lane(0.0), lane(0.0), lane(0.0), lane(1.0)};
+				lane_store_column(Translation, i, 3, out);
+			}
+			compute_euler_angles_batch<float, Q, false>::euler_mat4(Axes, t1 + i, t2 + i, t3 + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void euler_quat(euler_axes const& Axes, float const* t1, float const* t2, float const* t3, std::size_t count, qua<float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane T1, T2, T3, Quat[4];
+				lane_load(t1, i, T1);
+				lane_load(t2, i, T2);
+				lane_load(t3, i, T3);
+				lane_euler_quat(Axes, T1, T2, T3, Quat);
+				lane_store(Quat, i, out);
+			}
+			compute_euler_angles_batch<float, Q, false>::euler_quat(Axes, t1 + i, t2 + i, t3 + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void extract(euler_axes const& Axes, mat<3, 3, float, Q> const* m, std::size_t count, float* t1, float* t2, float* t3)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Rotation[3][3], T1, T2, T3;
+				lane_load(m, i, Rotation);
+				lane_extract_euler(Axes, Rotation, T1, T2, T3);
+				lane_store(T1, i, t1);
+				lane_store(T2, i, t2);
+				lane_store(T3, i, t3);
+			}
+			compute_euler_angles_batch<float, Q, false>::extract(Axes, m + i, count - i, t1 + i, t2 + i, t3 + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void extract(euler_axes const& Axes, mat<4, 4, float, Q> const* m, std::size_t count, float* t1, float* t2, float* t3)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Columns[3][4], Rotation[3][3], T1, T2, T3;
+				for(length_t c = 0; c < 3; ++c)
+				{
+					lane_load_column(m, i, c, Columns[c]);
+					for(length_t r = 0; r < 3; ++r)
+						Rotation[c][r] = Columns[c][r];
+				}
+				lane_extract_euler(Axes, Rotation, T1, T2, T3);
+				lane_store(T1, i, t1);
+				lane_store(T2, i, t2);
+				lane_store(T3, i, t3);
+			}
+			compute_euler_angles_batch<float, Q, false>::extract(Axes, m + i, count - i, t1 + i, t2 + i, t3 + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void extract(euler_axes const& Axes, qua<float, Q> const* q, std::size_t count, float* t1, float* t2, float* t3)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Quat[4], Rotation[3][3], T1, T2, T3;
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				lane_extract_euler(Axes, Rotation, T1, T2, T3);
+				lane_store(T1, i, t1);
+				lane_store(T2, i, t2);
+				lane_store(T3, i, t3);
+			}
+			compute_euler_angles_batch<float, Q, false>::extract(Axes, q + i, count - i, t1 + i, t2 + i, t3 + i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,80 @@
+/// @ref gtx_frustum
+/// @file glm/gtx/frustum.hpp
+///
+/// @see core (dependence)
+/// @see ext_matrix_clip_space (dependence)
+///
+/// @defgroup gtx_frustum GLM_GTX_frustum
+/// @ingroup gtx
+///
+/// Include <glm/gtx/frustum.hpp> to use the features of this extension.
+///
+/// Extract the planes of a view frustum from a projection matrix and cull arrays of bounding volumes against them.
+/// Planes are stored as vec4(normal, distance) with normals pointing inside the frustum.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_frustum is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_frustum extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_frustum
+	/// @{
+
+	/// Extract the normalized left, right, bottom, top, near and far planes of the frustum of a projection * view matrix
+	/// built for a clip space depth between 0 and 1. The planes are expressed in the space the matrix transforms from.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Extract the normalized left, right, bottom, top, near and far planes of the frustum of a projection * view matrix
+	/// built for a clip space depth between -1 and 1. The planes are expressed in the space the matrix transforms from.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Extract the normalized left, right, bottom, top, near and far planes of the frustum of a projection * view matrix
+	/// built with the default clip space depth: between 0 and 1 if GLM_FORCE_DEPTH_ZERO_TO_ONE is defined, between -1 and 1 otherwise.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6]);
+
+	/// Cull count spheres stored as structure of arrays against six frustum planes.
+	/// Bit i % 32 of visibility[i / 32] is set when sphere i intersects or is inside the frustum,
+	/// visibility must hold (count + 31) / 32 words and the bits past count are cleared.
+	/// Four or eight spheres are tested at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumCullSpheres(
+		vec<4, T, Q> const planes[6],
+		T const* centerX, T const* centerY, T const* centerZ, T const* radius,
+		std::size_t count, uint32* visibility);
+
+	/// Cull count axis aligned boxes, stored as structure of arrays of centers and half extents, against six frustum planes.
+	/// The test is conservative: a box outside the frustum but not entirely outside one of its planes is reported visible.
+	/// Bit i % 32 of visibility[i / 32] is set when box i is visible, visibility must hold (count + 31) / 32 words
+	/// and the bits past count are cleared.
+	/// Four or eight boxes are tested at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_frustum
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void frustumCullBoxes(
+		vec<4, T, Q> const planes[6],
+		T const* centerX, T const* centerY, T const* centerZ,
+		T const* extentX, T const* extentY, T const* extentZ,
+		std::size_t count, uint32* visibility);
+
+	/// @}
+}//namespace glm
+
+#include "frustum.inl"
@@ -0,0 +1,122 @@
+/// @ref gtx_frustum
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<4, T, Q> normalize_plane(vec<4, T, Q> const& p)
+	{
+		T const l = length(vec<3, T, Q>(p));
+		return l > static_cast<T>(0) ? p / l : p;
+	}
+
+	template<typename T, bool UseSimd>
+	struct compute_frustumCull
+	{
+		// Test the objects [first, count) and set their visibility bits, visibility must be cleared
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void spheres(
+			vec<4, T, Q> const planes[6],
+			T const* centerX, T const* centerY, T const* centerZ, T const* radius,
+			std::size_t first, std::size_t count, uint32* visibility)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				uint32 Visible = 1;
+				for(length_t p = 0; p < 6; ++p)
+				{
+					T const Distance = planes[p].x * centerX[i] + planes[p].y * centerY[i] + planes[p].z * centerZ[i] + planes[p].w;
+					Visible &= Distance >= -radius[i] ? 1u : 0u;
+				}
+				visibility[i >> 5] |= Visible << (i & 31);
+			}
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void boxes(
+			vec<4, T, Q> const planes[6],
+			T const* centerX, T const* centerY, T const* centerZ,
+			T const* extentX, T const* extentY, T const* extentZ,
+			std::size_t first, std::size_t count, uint32* visibility)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				uint32 Visible = 1;
+				for(length_t p = 0; p < 6; ++p)
+				{
+					T const Distance = planes[p].x * centerX[i] + planes[p].y * centerY[i] + planes[p].z * centerZ[i] + planes[p].w;
+					T const Radius = abs(planes[p].x) * extentX[i] + abs(planes[p].y) * extentY[i] + abs(planes[p].z) * extentZ[i];
+					Visible &= Distance + Radius >= static_cast<T>(0) ? 1u : 0u;
+				}
+				visibility[i >> 5] |= Visible << (i & 31);
+			}
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesZO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		mat<4, 4, T, Q> const t(transpose(m));
+		planes[0] = detail::normalize_plane(t[3] + t[0]);
+		planes[1] = detail::normalize_plane(t[3] - t[0]);
+		planes[2] = detail::normalize_plane(t[3] + t[1]);
+		planes[3] = detail::normalize_plane(t[3] - t[1]);
+		planes[4] = detail::normalize_plane(t[2]);
+		planes[5] = detail::normalize_plane(t[3] - t[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanesNO(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		mat<4, 4, T, Q> const t(transpose(m));
+		planes[0] = detail::normalize_plane(t[3] + t[0]);
+		planes[1] = detail::normalize_plane(t[3] - t[0]);
+		planes[2] = detail::normalize_plane(t[3] + t[1]);
+		planes[3] = detail::normalize_plane(t[3] - t[1]);
+		planes[4] = detail::normalize_plane(t[3] + t[2]);
+		planes[5] = detail::normalize_plane(t[3] - t[2]);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumPlanes(mat<4, 4, T, Q> const& m, vec<4, T, Q> planes[6])
+	{
+		if(GLM_CONFIG_CLIP_CONTROL & GLM_CLIP_CONTROL_ZO_BIT)
+			frustumPlanesZO(m, planes);
+		else
+			frustumPlanesNO(m, planes);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumCullSpheres
+	(
+		vec<4, T, Q> const planes[6],
+		T const* centerX, T const* centerY, T const* centerZ, T const* radius,
+		std::size_t count, uint32* visibility
+	)
+	{
+		for(std::size_t i = 0, n = (count + 31) / 32; i < n; ++i)
+			visibility[i] = 0;
+
+		detail::compute_frustumCull<T, GLM_CONFIG_SIMD == GLM_ENABLE>::spheres(planes, centerX, centerY, centerZ, radius, 0, count, visibility);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void frustumCullBoxes
+	(
+		vec<4, T, Q> const planes[6],
+		T const* centerX, T const* centerY, T const* centerZ,
+		T const* extentX, T const* extentY, T const* extentZ,
+		std::size_t count, uint32* visibility
+	)
+	{
+		for(std::size_t i = 0, n = (count + 31) / 32; i < n; ++i)
+			visibility[i] = 0;
+
+		detail::compute_frustumCull<T, GLM_CONFIG_SIMD == GLM_ENABLE>::boxes(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, 0, count, visibility);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "frustum_simd.inl"
+#endif
@@ -0,0 +1,141 @@
+/// @ref gtx_frustum
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER __m256 glm_frustum_fma8(__m256 a, __m256 b, __m256 c)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return _mm256_fmadd_ps(a, b, c);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#		endif
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template<>
+	struct compute_frustumCull<float, true>
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void spheres(
+			vec<4, float, Q> const planes[6],
+			float const* centerX, float const* centerY, float const* centerZ, float const* radius,
+			std::size_t first, std::size_t count, uint32* visibility)
+		{
+			std::size_t i = first;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					__m256 const x = _mm256_loadu_ps(centerX + i);
+					__m256 const y = _mm256_loadu_ps(centerY + i);
+					__m256 const z = _mm256_loadu_ps(centerZ + i);
+					__m256 const r = _mm256_sub_ps(_mm256_setzero_ps(), _mm256_loadu_ps(radius + i));
+
+					__m256 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+					for(length_t p = 0; p < 6; ++p)
+					{
+						__m256 Distance = _mm256_set1_ps(planes[p].w);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(planes[p].z), z, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(planes[p].y), y, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(planes[p].x), x, Distance);
+						Visible = _mm256_and_ps(Visible, _mm256_cmp_ps(Distance, r, _CMP_GE_OQ));
+					}
+					visibility[i >> 5] |= static_cast<uint32>(_mm256_movemask_ps(Visible)) << (i & 31);
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 const x = _mm_loadu_ps(centerX + i);
+				glm_vec4 const y = _mm_loadu_ps(centerY + i);
+				glm_vec4 const z = _mm_loadu_ps(centerZ + i);
+				glm_vec4 const r = _mm_sub_ps(_mm_setzero_ps(), _mm_loadu_ps(radius + i));
+
+				glm_vec4 Visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for(length_t p = 0; p < 6; ++p)
+				{
+					glm_vec4 Distance = _mm_set1_ps(planes[p].w);
+					Distance = glm_vec4_fma(_mm_set1_ps(planes[p].z), z, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(planes[p].y), y, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(planes[p].x), x, Distance);
+					Visible = _mm_and_ps(Visible, _mm_cmpge_ps(Distance, r));
+				}
+				visibility[i >> 5] |= static_cast<uint32>(_mm_movemask_ps(Visible)) << (i & 31);
+			}
+
+			compute_frustumCull<float, false>::spheres(planes, centerX, centerY, centerZ, radius, i, count, visibility);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void boxes(
+			vec<4, float, Q> const planes[6],
+			float const* centerX, float const* centerY, float const* centerZ,
+			float const* extentX, float const* extentY, float const* extentZ,
+			std::size_t first, std::size_t count, uint32* visibility)
+		{
+			std::size_t i = first;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				for(; i + 8 <= count; i += 8)
+				{
+					__m256 const x = _mm256_loadu_ps(centerX + i);
+					__m256 const y = _mm256_loadu_ps(centerY + i);
+					__m256 const z = _mm256_loadu_ps(centerZ + i);
+					__m256 const ex = _mm256_loadu_ps(extentX + i);
+					__m256 const ey = _mm256_loadu_ps(extentY + i);
+					__m256 const ez = _mm256_loadu_ps(extentZ + i);
+
+					__m256 Visible = _mm256_castsi256_ps(_mm256_set1_epi32(-1));
+					for(length_t p = 0; p < 6; ++p)
+					{
+						// Distance + |n|.e >= 0
+						__m256 Distance = _mm256_set1_ps(planes[p].w);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(planes[p].z), z, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(planes[p].y), y, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(planes[p].x), x, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(abs(planes[p].z)), ez, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(abs(planes[p].y)), ey, Distance);
+						Distance = glm_frustum_fma8(_mm256_set1_ps(abs(planes[p].x)), ex, Distance);
+						Visible = _mm256_and_ps(Visible, _mm256_cmp_ps(Distance, _mm256_setzero_ps(), _CMP_GE_OQ));
+					}
+					visibility[i >> 5] |= static_cast<uint32>(_mm256_movemask_ps(Visible)) << (i & 31);
+				}
+#			endif
+
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 const x = _mm_loadu_ps(centerX + i);
+				glm_vec4 const y = _mm_loadu_ps(centerY + i);
+				glm_vec4 const z = _mm_loadu_ps(centerZ + i);
+				glm_vec4 const ex = _mm_loadu_ps(extentX + i);
+				glm_vec4 const ey = _mm_loadu_ps(extentY + i);
+				glm_vec4 const ez = _mm_loadu_ps(extentZ + i);
+
+				glm_vec4 Visible = _mm_castsi128_ps(_mm_set1_epi32(-1));
+				for(length_t p = 0; p < 6; ++p)
+				{
+					glm_vec4 Distance = _mm_set1_ps(planes[p].w);
+					Distance = glm_vec4_fma(_mm_set1_ps(planes[p].z), z, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(planes[p].y), y, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(planes[p].x), x, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(abs(planes[p].z)), ez, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(abs(planes[p].y)), ey, Distance);
+					Distance = glm_vec4_fma(_mm_set1_ps(abs(planes[p].x)), ex, Distance);
+					Visible = _mm_and_ps(Visible, _mm_cmpge_ps(Distance, _mm_setzero_ps()));
+				}
+				visibility[i >> 5] |= static_cast<uint32>(_mm_movemask_ps(Visible)) << (i & 31);
+			}
+
+			compute_frustumCull<float, false>::boxes(planes, centerX, centerY, centerZ, extentX, extentY, extentZ, i, count, visibility);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
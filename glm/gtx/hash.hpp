@@ -8,7 +8,9 @@
 ///
 /// Include <glm/gtx/hash.hpp> to use the features of this extension.
 ///
-/// Add std::hash support for glm types
+/// Add std::hash support for glm types.
+/// Vectors and quaternions are hashed with hashMix, which mixes the bit patterns of all the components
+/// with a multiplicative finalizer instead of combining std::hash of each component.
 
 #pragma once
 
@@ -26,6 +28,7 @@
 #include "../vec3.hpp"
 #include "../vec4.hpp"
 #include "../gtc/vec1.hpp"
+#include "../ext/scalar_uint_sized.hpp"
 
 #include "../gtc/quaternion.hpp"
 #include "../gtx/dual_quaternion.hpp"
@@ -46,6 +49,22 @@
 #	error "GLM_GTX_hash requires C++11 standard library support"
 #endif
 
+namespace glm
+{
+	/// @addtogroup gtx_hash
+	/// @{
+
+	/// Hash the bit patterns of the components of a vector.
+	/// Components are multiplied by distinct odd constants and summed, the sum is then avalanched
+	/// with the 64 bits MurmurHash3 finalizer. Floating-point -0 and +0 hash to the same value,
+	/// long double components are hashed by their significand and exponent, without their padding bytes.
+	/// @see gtx_hash
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL uint64 hashMix(vec<L, T, Q> const& v);
+
+	/// @}
+}//namespace glm
+
 namespace std
 {
 	template<typename T, glm::qualifier Q>
@@ -9,6 +9,9 @@
 ///
 /// <glm/gtx/hash.inl> need to be included to use the features of this extension.
 
+#include <cmath>
+#include <limits>
+
 namespace glm {
 namespace detail
 {
@@ -17,60 +20,114 @@ namespace detail
 		hash += 0x9e3779b9 + (seed << 6) + (seed >> 2);
 		seed ^= hash;
 	}
-}}
+
+	template<typename T, bool isFloat = std::numeric_limits<T>::is_iec559>
+	struct compute_hash_bits
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(T x)
+		{
+			return static_cast<uint64>(x);
+		}
+	};
+
+	template<>
+	struct compute_hash_bits<float, true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(float x)
+		{
+			union { float f; uint32 u; } Bits;
+			Bits.f = x;
+			return x == 0.0f ? 0 : Bits.u;
+		}
+	};
+
+	template<>
+	struct compute_hash_bits<double, true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(double x)
+		{
+			union { double f; uint64 u; } Bits;
+			Bits.f = x;
+			return x == 0.0 ? 0 : Bits.u;
+		}
+	};
+
+	// The extended formats have padding bytes and more than 64 bits, the significand and the exponent are extracted with frexp.
+	// Significands longer than 64 bits are truncated.
+	template<>
+	struct compute_hash_bits<long double, true>
+	{
+		GLM_FUNC_QUALIFIER static uint64 call(long double x)
+		{
+			if(x == 0.0L)
+				return 0;
+			if(x != x)
+				return 0x7ff8000000000000ull;
+			if(x - x != x - x)
+				return x > 0.0L ? 0x7ff0000000000000ull : 0xfff0000000000000ull;
+
+			int Exponent = 0;
+			long double const Significand = std::frexp(x < 0.0L ? -x : x, &Exponent);
+			uint64 const Bits = static_cast<uint64>(std::ldexp(Significand, 64));
+			uint64 const Sign = x < 0.0L ? 1u : 0u;
+			return Bits ^ ((static_cast<uint64>(static_cast<uint32>(Exponent)) << 1 | Sign) * 0x9e3779b97f4a7c15ull);
+		}
+	};
+
+	GLM_FUNC_QUALIFIER uint64 hash_fmix64(uint64 h)
+	{
+		h ^= h >> 33;
+		h *= 0xff51afd7ed558ccdull;
+		h ^= h >> 33;
+		h *= 0xc4ceb9fe1a85ec53ull;
+		h ^= h >> 33;
+		return h;
+	}
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER uint64 hashMix(vec<L, T, Q> const& v)
+	{
+		// Odd constants, the sum is independent across components
+		static uint64 const Multipliers[4] = {0x9e3779b97f4a7c15ull, 0xc2b2ae3d27d4eb4full, 0x165667b19e3779f9ull, 0xd6e8feb86659fd93ull};
+
+		uint64 Sum = static_cast<uint64>(L);
+		for(length_t i = 0; i < L; ++i)
+			Sum += detail::compute_hash_bits<T>::call(v[i]) * Multipliers[i];
+		return detail::hash_fmix64(Sum);
+	}
+}//namespace glm
 
 namespace std
 {
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<1, T, Q>>::operator()(glm::vec<1, T, Q> const& v) const
 	{
-		hash<T> hasher;
-		return hasher(v.x);
+		return static_cast<size_t>(glm::hashMix(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<2, T, Q>>::operator()(glm::vec<2, T, Q> const& v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		return seed;
+		return static_cast<size_t>(glm::hashMix(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<3, T, Q>>::operator()(glm::vec<3, T, Q> const& v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		return seed;
+		return static_cast<size_t>(glm::hashMix(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::vec<4, T, Q>>::operator()(glm::vec<4, T, Q> const& v) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(v.x));
-		glm::detail::hash_combine(seed, hasher(v.y));
-		glm::detail::hash_combine(seed, hasher(v.z));
-		glm::detail::hash_combine(seed, hasher(v.w));
-		return seed;
+		return static_cast<size_t>(glm::hashMix(v));
 	}
 
 	template<typename T, glm::qualifier Q>
 	GLM_FUNC_QUALIFIER size_t hash<glm::tquat<T, Q>>::operator()(glm::tquat<T,Q> const& q) const
 	{
-		size_t seed = 0;
-		hash<T> hasher;
-		glm::detail::hash_combine(seed, hasher(q.x));
-		glm::detail::hash_combine(seed, hasher(q.y));
-		glm::detail::hash_combine(seed, hasher(q.z));
-		glm::detail::hash_combine(seed, hasher(q.w));
-		return seed;
+		return static_cast<size_t>(glm::hashMix(glm::vec<4, T, Q>(q.x, q.y, q.z, q.w)));
 	}
 
 	template<typename T, glm::qualifier Q>
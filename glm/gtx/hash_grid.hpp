@@ -0,0 +1,89 @@
+/// @ref gtx_hash_grid
+/// @file glm/gtx/hash_grid.hpp
+///
+/// @see core (dependence)
+/// @see gtx_hash (dependence)
+///
+/// @defgroup gtx_hash_grid GLM_GTX_hash_grid
+/// @ingroup gtx
+///
+/// Include <glm/gtx/hash_grid.hpp> to use the features of this extension.
+///
+/// Spatial hash grid over points for fixed radius neighbor queries.
+/// Points are bucketed by the integer coordinates of the cubic cell containing them, the cells are stored
+/// in a flat open addressing table and the points are sorted by cell so that each cell is a contiguous range.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <vector>
+#include "../glm.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "../gtx/hash.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_hash_grid is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_hash_grid extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_hash_grid
+	/// @{
+
+	/// Spatial hash grid over a set of points.
+	/// The cell table uses linear probing and is kept at most half full.
+	/// @see gtx_hash_grid
+	template<typename T, qualifier Q = defaultp>
+	struct hash_grid
+	{
+		typedef T value_type;
+
+		/// Occupied cells have a non-null count, points [first, first + count) belong to the cell.
+		struct cell
+		{
+			vec<3, int, Q> key;
+			uint32 first;
+			uint32 count;
+		};
+
+		/// Edge length of the cubic cells.
+		T cellSize;
+
+		/// Open addressing table of cells, its size is a power of two.
+		std::vector<cell> cells;
+
+		/// Points sorted by cell.
+		std::vector<vec<3, T, Q> > points;
+
+		/// Index in the input array of each sorted point.
+		std::vector<uint32> pointIndices;
+	};
+
+	/// Compute the integer coordinates of the cell containing a point.
+	/// @see gtx_hash_grid
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL vec<3, int, Q> hashGridCell(hash_grid<T, Q> const& grid, vec<3, T, Q> const& p);
+
+	/// Build a spatial hash grid from count points, previous content of the grid is discarded.
+	/// Queries are the most efficient when cellSize is close to the query radius.
+	/// Cell coordinates must fit in an int and count must fit in an uint32.
+	/// @see gtx_hash_grid
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void buildHashGrid(hash_grid<T, Q>& grid, vec<3, T, Q> const* points, std::size_t count, T cellSize);
+
+	/// Append to neighbors the input indices of the points within radius of center, boundary included.
+	/// Indices are appended cell by cell, in no particular order.
+	/// @return The number of indices appended.
+	/// @see gtx_hash_grid
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t findNeighbors(hash_grid<T, Q> const& grid, vec<3, T, Q> const& center, T radius, std::vector<uint32>& neighbors);
+
+	/// @}
+}//namespace glm
+
+#include "hash_grid.inl"
@@ -0,0 +1,119 @@
+/// @ref gtx_hash_grid
+
+namespace glm{
+namespace detail
+{
+	// Slot of the cell with the given key, or the empty slot where it would be inserted
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t hash_grid_probe(hash_grid<T, Q> const& grid, vec<3, int, Q> const& key)
+	{
+		std::size_t const Mask = grid.cells.size() - 1;
+		std::size_t Slot = static_cast<std::size_t>(hashMix(key)) & Mask;
+		while(grid.cells[Slot].count != 0 && grid.cells[Slot].key != key)
+			Slot = (Slot + 1) & Mask;
+		return Slot;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hash_grid_gather(hash_grid<T, Q> const& grid, typename hash_grid<T, Q>::cell const& Cell, vec<3, T, Q> const& center, T radius2, std::vector<uint32>& neighbors, std::size_t& Found)
+	{
+		for(uint32 i = Cell.first, n = Cell.first + Cell.count; i < n; ++i)
+		{
+			vec<3, T, Q> const d(grid.points[i] - center);
+			if(dot(d, d) <= radius2)
+			{
+				neighbors.push_back(grid.pointIndices[i]);
+				++Found;
+			}
+		}
+	}
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<3, int, Q> hashGridCell(hash_grid<T, Q> const& grid, vec<3, T, Q> const& p)
+	{
+		return vec<3, int, Q>(floor(p / grid.cellSize));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildHashGrid(hash_grid<T, Q>& grid, vec<3, T, Q> const* points, std::size_t count, T cellSize)
+	{
+		typedef typename hash_grid<T, Q>::cell cell;
+
+		std::size_t Capacity = 16;
+		while(Capacity < count * 2)
+			Capacity <<= 1;
+
+		cell Empty;
+		Empty.key = vec<3, int, Q>(0);
+		Empty.first = 0;
+		Empty.count = 0;
+
+		grid.cellSize = cellSize;
+		grid.cells.assign(Capacity, Empty);
+		grid.points.resize(count);
+		grid.pointIndices.resize(count);
+
+		// Count the points of each cell
+		std::vector<uint32> PointSlots(count);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			vec<3, int, Q> const Key(hashGridCell(grid, points[i]));
+			std::size_t const Slot = detail::hash_grid_probe(grid, Key);
+			grid.cells[Slot].key = Key;
+			++grid.cells[Slot].count;
+			PointSlots[i] = static_cast<uint32>(Slot);
+		}
+
+		// Cells first point past their range, then scatter backward to keep the input order within a cell
+		uint32 Offset = 0;
+		for(std::size_t i = 0; i < Capacity; ++i)
+		{
+			Offset += grid.cells[i].count;
+			grid.cells[i].first = Offset;
+		}
+
+		for(std::size_t i = count; i-- > 0;)
+		{
+			uint32 const Index = --grid.cells[PointSlots[i]].first;
+			grid.points[Index] = points[i];
+			grid.pointIndices[Index] = static_cast<uint32>(i);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t findNeighbors(hash_grid<T, Q> const& grid, vec<3, T, Q> const& center, T radius, std::vector<uint32>& neighbors)
+	{
+		std::size_t Found = 0;
+		if(grid.points.empty())
+			return Found;
+
+		T const Radius2 = radius * radius;
+		vec<3, int, Q> const Min(hashGridCell(grid, center - radius));
+		vec<3, int, Q> const Max(hashGridCell(grid, center + radius));
+		vec<3, T, Q> const Range(vec<3, T, Q>(Max - Min) + static_cast<T>(1));
+
+		// Large radii cover more cells than the table holds, scan the table instead
+		if(Range.x * Range.y * Range.z > static_cast<T>(grid.cells.size()))
+		{
+			for(std::size_t i = 0, n = grid.cells.size(); i < n; ++i)
+			{
+				typename hash_grid<T, Q>::cell const& Cell = grid.cells[i];
+				if(Cell.count != 0 && all(greaterThanEqual(Cell.key, Min)) && all(lessThanEqual(Cell.key, Max)))
+					detail::hash_grid_gather(grid, Cell, center, Radius2, neighbors, Found);
+			}
+			return Found;
+		}
+
+		for(int z = Min.z; z <= Max.z; ++z)
+		for(int y = Min.y; y <= Max.y; ++y)
+		for(int x = Min.x; x <= Max.x; ++x)
+		{
+			typename hash_grid<T, Q>::cell const& Cell = grid.cells[detail::hash_grid_probe(grid, vec<3, int, Q>(x, y, z))];
+			if(Cell.count != 0)
+				detail::hash_grid_gather(grid, Cell, center, Radius2, neighbors, Found);
+		}
+
+		return Found;
+	}
+}//namespace glm
@@ -34,6 +34,51 @@ namespace glm
 	/// @addtogroup gtx_intersect
 	/// @{
 
+	//! Ray with a precomputed reciprocal direction and direction sign bits, used by the slab tests.
+	//! A sign is 1 when the direction component is negative, including -0.
+	//! Null direction components produce infinite reciprocals on purpose: the slab tests handle them.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q = defaultp>
+	struct ray
+	{
+		typedef T value_type;
+
+		vec<3, T, Q> origin;
+		vec<3, T, Q> direction;
+		vec<3, T, Q> invDirection;
+		vec<3, int, Q> sign;
+
+		GLM_FUNC_DECL ray();
+		GLM_FUNC_DECL ray(vec<3, T, Q> const& origin, vec<3, T, Q> const& direction);
+	};
+
+	//! Structure of arrays of L rays, typically 4 or 8, tested together against a single box.
+	//! From GLM_GTX_intersect extension.
+	template<length_t L, typename T>
+	struct ray_packet
+	{
+		T origin[3][L];
+		T invDirection[3][L];
+
+		template<qualifier Q>
+		GLM_FUNC_DECL void set(length_t lane, ray<T, Q> const& r);
+	};
+
+	//! Structure of arrays of L axis aligned boxes, typically 4 or 8, tested together against a single ray.
+	//! Default construction fills every lane with an empty box that is never hit.
+	//! From GLM_GTX_intersect extension.
+	template<length_t L, typename T>
+	struct aabb_packet
+	{
+		T boxMin[3][L];
+		T boxMax[3][L];
+
+		GLM_FUNC_DECL aabb_packet();
+
+		template<qualifier Q>
+		GLM_FUNC_DECL void set(length_t lane, vec<3, T, Q> const& lower, vec<3, T, Q> const& upper);
+	};
+
 	//! Compute the intersection of a ray and a plane.
 	//! Ray direction and plane normal must be unit length.
 	//! From GLM_GTX_intersect extension.
@@ -86,6 +131,36 @@ namespace glm
 		genType & intersectionPosition1, genType & intersectionNormal1,
 		genType & intersectionPosition2 = genType(), genType & intersectionNormal2 = genType());
 
+	//! Compute the intersection of a ray and an axis aligned box using the slab test.
+	//! tNear and tFar receive the entry and exit distances, tNear is clamped to 0 when the origin is inside the box.
+	//! Axis aligned rays are supported: a ray starting on a slab plane is considered inside that slab.
+	//! From GLM_GTX_intersect extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool intersectRayAABB(
+		ray<T, Q> const& r,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T & tNear, T & tFar);
+
+	//! Branchless slab test of one ray against L boxes for the distance range [0, tMax].
+	//! Returns a bitmask where bit i is set when box i is hit, tNear[i] receives its entry distance.
+	//! SSE2 and AVX implementations are used for 4 and 8 floats when GLM_FORCE_INTRINSICS is enabled.
+	//! From GLM_GTX_intersect extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL int intersectRayAABB(
+		ray<T, Q> const& r,
+		aabb_packet<L, T> const& boxes,
+		T tMax, T tNear[L]);
+
+	//! Branchless slab test of L rays against one box, ray i being tested for the distance range [0, tMax[i]].
+	//! Returns a bitmask where bit i is set when ray i hits the box, tNear[i] receives its entry distance.
+	//! SSE2 and AVX implementations are used for 4 and 8 floats when GLM_FORCE_INTRINSICS is enabled.
+	//! From GLM_GTX_intersect extension.
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL int intersectRayAABB(
+		ray_packet<L, T> const& rays,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T const tMax[L], T tNear[L]);
+
 	/// @}
 }//namespace glm
 
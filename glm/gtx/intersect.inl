@@ -1,7 +1,129 @@
 /// @ref gtx_intersect
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	// Same operand ordering as minps / maxps: when either operand is NaN, the second operand is returned.
+	// Accumulating with the running bound as the second operand discards the NaN produced by 0 * inf when
+	// an axis aligned ray starts on a slab plane.
+	template<typename T>
+	GLM_FUNC_QUALIFIER T slabMin(T a, T b)
+	{
+		return a < b ? a : b;
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T slabMax(T a, T b)
+	{
+		return a > b ? a : b;
+	}
+
+	template<length_t L, typename T>
+	struct compute_intersectRayAABB
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static int call(ray<T, Q> const& r, aabb_packet<L, T> const& boxes, T tMax, T tNear[L])
+		{
+			T const* NearX = r.sign.x ? boxes.boxMax[0] : boxes.boxMin[0];
+			T const* NearY = r.sign.y ? boxes.boxMax[1] : boxes.boxMin[1];
+			T const* NearZ = r.sign.z ? boxes.boxMax[2] : boxes.boxMin[2];
+			T const* FarX = r.sign.x ? boxes.boxMin[0] : boxes.boxMax[0];
+			T const* FarY = r.sign.y ? boxes.boxMin[1] : boxes.boxMax[1];
+			T const* FarZ = r.sign.z ? boxes.boxMin[2] : boxes.boxMax[2];
+
+			int Mask = 0;
+			for(length_t i = 0; i < L; ++i)
+			{
+				T Near = slabMax((NearX[i] - r.origin.x) * r.invDirection.x, static_cast<T>(0));
+				Near = slabMax((NearY[i] - r.origin.y) * r.invDirection.y, Near);
+				Near = slabMax((NearZ[i] - r.origin.z) * r.invDirection.z, Near);
+				T Far = slabMin((FarX[i] - r.origin.x) * r.invDirection.x, tMax);
+				Far = slabMin((FarY[i] - r.origin.y) * r.invDirection.y, Far);
+				Far = slabMin((FarZ[i] - r.origin.z) * r.invDirection.z, Far);
+
+				tNear[i] = Near;
+				Mask |= (Near <= Far ? 1 : 0) << i;
+			}
+			return Mask;
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static int call(ray_packet<L, T> const& rays, vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax, T const tMax[L], T tNear[L])
+		{
+			int Mask = 0;
+			for(length_t i = 0; i < L; ++i)
+			{
+				T Near = static_cast<T>(0);
+				T Far = tMax[i];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					T const Inv = rays.invDirection[c][i];
+					bool const Negative = Inv < static_cast<T>(0);
+					Near = slabMax(((Negative ? boxMax[c] : boxMin[c]) - rays.origin[c][i]) * Inv, Near);
+					Far = slabMin(((Negative ? boxMin[c] : boxMax[c]) - rays.origin[c][i]) * Inv, Far);
+				}
+
+				tNear[i] = Near;
+				Mask |= (Near <= Far ? 1 : 0) << i;
+			}
+			return Mask;
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ray<T, Q>::ray()
+		: origin(static_cast<T>(0))
+		, direction(static_cast<T>(0), static_cast<T>(0), static_cast<T>(1))
+		, invDirection(std::numeric_limits<T>::infinity(), std::numeric_limits<T>::infinity(), static_cast<T>(1))
+		, sign(0)
+	{}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER ray<T, Q>::ray(vec<3, T, Q> const& o, vec<3, T, Q> const& d)
+		: origin(o)
+		, direction(d)
+		, invDirection(static_cast<T>(1) / d)
+		, sign(
+			invDirection.x < static_cast<T>(0) ? 1 : 0,
+			invDirection.y < static_cast<T>(0) ? 1 : 0,
+			invDirection.z < static_cast<T>(0) ? 1 : 0)
+	{}
+
+	template<length_t L, typename T>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void ray_packet<L, T>::set(length_t lane, ray<T, Q> const& r)
+	{
+		assert(lane >= 0 && lane < L);
+		for(length_t c = 0; c < 3; ++c)
+		{
+			origin[c][lane] = r.origin[c];
+			invDirection[c][lane] = r.invDirection[c];
+		}
+	}
+
+	template<length_t L, typename T>
+	GLM_FUNC_QUALIFIER aabb_packet<L, T>::aabb_packet()
+	{
+		for(length_t c = 0; c < 3; ++c)
+		for(length_t i = 0; i < L; ++i)
+		{
+			boxMin[c][i] = std::numeric_limits<T>::infinity();
+			boxMax[c][i] = -std::numeric_limits<T>::infinity();
+		}
+	}
+
+	template<length_t L, typename T>
+	template<qualifier Q>
+	GLM_FUNC_QUALIFIER void aabb_packet<L, T>::set(length_t lane, vec<3, T, Q> const& lower, vec<3, T, Q> const& upper)
+	{
+		assert(lane >= 0 && lane < L);
+		for(length_t c = 0; c < 3; ++c)
+		{
+			boxMin[c][lane] = lower[c];
+			boxMax[c][lane] = upper[c];
+		}
+	}
 	template<typename genType>
 	GLM_FUNC_QUALIFIER bool intersectRayPlane
 	(
@@ -194,4 +316,52 @@ namespace glm
 		intersectionNormal2 = (intersectionPoint2 - sphereCenter) / sphereRadius;
 		return true;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool intersectRayAABB
+	(
+		ray<T, Q> const& r,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T & tNear, T & tFar
+	)
+	{
+		vec<3, T, Q> const Bounds[2] = {boxMin, boxMax};
+
+		T Near = detail::slabMax((Bounds[r.sign.x].x - r.origin.x) * r.invDirection.x, static_cast<T>(0));
+		Near = detail::slabMax((Bounds[r.sign.y].y - r.origin.y) * r.invDirection.y, Near);
+		Near = detail::slabMax((Bounds[r.sign.z].z - r.origin.z) * r.invDirection.z, Near);
+		T Far = detail::slabMin((Bounds[1 - r.sign.x].x - r.origin.x) * r.invDirection.x, std::numeric_limits<T>::infinity());
+		Far = detail::slabMin((Bounds[1 - r.sign.y].y - r.origin.y) * r.invDirection.y, Far);
+		Far = detail::slabMin((Bounds[1 - r.sign.z].z - r.origin.z) * r.invDirection.z, Far);
+
+		tNear = Near;
+		tFar = Far;
+		return Near <= Far;
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectRayAABB
+	(
+		ray<T, Q> const& r,
+		aabb_packet<L, T> const& boxes,
+		T tMax, T tNear[L]
+	)
+	{
+		return detail::compute_intersectRayAABB<L, T>::call(r, boxes, tMax, tNear);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER int intersectRayAABB
+	(
+		ray_packet<L, T> const& rays,
+		vec<3, T, Q> const& boxMin, vec<3, T, Q> const& boxMax,
+		T const tMax[L], T tNear[L]
+	)
+	{
+		return detail::compute_intersectRayAABB<L, T>::call(rays, boxMin, boxMax, tMax, tNear);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "intersect_simd.inl"
+#endif
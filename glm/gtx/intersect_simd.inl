@@ -0,0 +1,138 @@
+/// @ref gtx_intersect
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	// The slab distances are computed by selecting the near and far planes with the direction sign, so that a NaN
+	// can only appear on the plane the ray starts on. minps / maxps return their second operand when one operand
+	// is NaN, which keeps the running bound unchanged.
+	GLM_FUNC_QUALIFIER void glm_slab4(
+		glm_vec4 boxMin, glm_vec4 boxMax, glm_vec4 origin, glm_vec4 invDir,
+		glm_vec4 & tNear, glm_vec4 & tFar)
+	{
+		glm_vec4 const Negative = _mm_cmplt_ps(invDir, _mm_setzero_ps());
+		glm_vec4 const NearPlane = glm_vec4_select(Negative, boxMax, boxMin);
+		glm_vec4 const FarPlane = glm_vec4_select(Negative, boxMin, boxMax);
+		tNear = _mm_max_ps(_mm_mul_ps(_mm_sub_ps(NearPlane, origin), invDir), tNear);
+		tFar = _mm_min_ps(_mm_mul_ps(_mm_sub_ps(FarPlane, origin), invDir), tFar);
+	}
+
+	GLM_FUNC_QUALIFIER int glm_ray_aabb4(
+		float const Origin[3], float const InvDir[3], float const* const BoxMin[3], float const* const BoxMax[3],
+		glm_vec4 tMax, float* tNear)
+	{
+		glm_vec4 Near = _mm_setzero_ps();
+		glm_vec4 Far = tMax;
+		for(length_t c = 0; c < 3; ++c)
+			glm_slab4(_mm_loadu_ps(BoxMin[c]), _mm_loadu_ps(BoxMax[c]), _mm_set1_ps(Origin[c]), _mm_set1_ps(InvDir[c]), Near, Far);
+		_mm_storeu_ps(tNear, Near);
+		return _mm_movemask_ps(_mm_cmple_ps(Near, Far));
+	}
+
+	GLM_FUNC_QUALIFIER int glm_ray_packet4_aabb(
+		float const* const Origin[3], float const* const InvDir[3], float const BoxMin[3], float const BoxMax[3],
+		float const* tMax, float* tNear)
+	{
+		glm_vec4 Near = _mm_setzero_ps();
+		glm_vec4 Far = _mm_loadu_ps(tMax);
+		for(length_t c = 0; c < 3; ++c)
+			glm_slab4(_mm_set1_ps(BoxMin[c]), _mm_set1_ps(BoxMax[c]), _mm_loadu_ps(Origin[c]), _mm_loadu_ps(InvDir[c]), Near, Far);
+		_mm_storeu_ps(tNear, Near);
+		return _mm_movemask_ps(_mm_cmple_ps(Near, Far));
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER void glm_slab8(
+		__m256 boxMin, __m256 boxMax, __m256 origin, __m256 invDir,
+		__m256 & tNear, __m256 & tFar)
+	{
+		__m256 const Negative = _mm256_cmp_ps(invDir, _mm256_setzero_ps(), _CMP_LT_OQ);
+		__m256 const NearPlane = _mm256_blendv_ps(boxMin, boxMax, Negative);
+		__m256 const FarPlane = _mm256_blendv_ps(boxMax, boxMin, Negative);
+		tNear = _mm256_max_ps(_mm256_mul_ps(_mm256_sub_ps(NearPlane, origin), invDir), tNear);
+		tFar = _mm256_min_ps(_mm256_mul_ps(_mm256_sub_ps(FarPlane, origin), invDir), tFar);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template<>
+	struct compute_intersectRayAABB<4, float>
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static int call(ray<float, Q> const& r, aabb_packet<4, float> const& boxes, float tMax, float tNear[4])
+		{
+			float const Origin[3] = {r.origin.x, r.origin.y, r.origin.z};
+			float const InvDir[3] = {r.invDirection.x, r.invDirection.y, r.invDirection.z};
+			float const* const BoxMin[3] = {boxes.boxMin[0], boxes.boxMin[1], boxes.boxMin[2]};
+			float const* const BoxMax[3] = {boxes.boxMax[0], boxes.boxMax[1], boxes.boxMax[2]};
+			return glm_ray_aabb4(Origin, InvDir, BoxMin, BoxMax, _mm_set1_ps(tMax), tNear);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static int call(ray_packet<4, float> const& rays, vec<3, float, Q> const& boxMin, vec<3, float, Q> const& boxMax, float const tMax[4], float tNear[4])
+		{
+			float const* const Origin[3] = {rays.origin[0], rays.origin[1], rays.origin[2]};
+			float const* const InvDir[3] = {rays.invDirection[0], rays.invDirection[1], rays.invDirection[2]};
+			float const BoxMin[3] = {boxMin.x, boxMin.y, boxMin.z};
+			float const BoxMax[3] = {boxMax.x, boxMax.y, boxMax.z};
+			return glm_ray_packet4_aabb(Origin, InvDir, BoxMin, BoxMax, tMax, tNear);
+		}
+	};
+
+	template<>
+	struct compute_intersectRayAABB<8, float>
+	{
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static int call(ray<float, Q> const& r, aabb_packet<8, float> const& boxes, float tMax, float tNear[8])
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				__m256 Near = _mm256_setzero_ps();
+				__m256 Far = _mm256_set1_ps(tMax);
+				for(length_t c = 0; c < 3; ++c)
+					glm_slab8(_mm256_loadu_ps(boxes.boxMin[c]), _mm256_loadu_ps(boxes.boxMax[c]), _mm256_set1_ps(r.origin[c]), _mm256_set1_ps(r.invDirection[c]), Near, Far);
+				_mm256_storeu_ps(tNear, Near);
+				return _mm256_movemask_ps(_mm256_cmp_ps(Near, Far, _CMP_LE_OQ));
+#			else
+				float const Origin[3] = {r.origin.x, r.origin.y, r.origin.z};
+				float const InvDir[3] = {r.invDirection.x, r.invDirection.y, r.invDirection.z};
+				float const* const BoxMinLo[3] = {boxes.boxMin[0], boxes.boxMin[1], boxes.boxMin[2]};
+				float const* const BoxMaxLo[3] = {boxes.boxMax[0], boxes.boxMax[1], boxes.boxMax[2]};
+				float const* const BoxMinHi[3] = {boxes.boxMin[0] + 4, boxes.boxMin[1] + 4, boxes.boxMin[2] + 4};
+				float const* const BoxMaxHi[3] = {boxes.boxMax[0] + 4, boxes.boxMax[1] + 4, boxes.boxMax[2] + 4};
+				glm_vec4 const Far = _mm_set1_ps(tMax);
+				int const Lo = glm_ray_aabb4(Origin, InvDir, BoxMinLo, BoxMaxLo, Far, tNear);
+				int const Hi = glm_ray_aabb4(Origin, InvDir, BoxMinHi, BoxMaxHi, Far, tNear + 4);
+				return Lo | (Hi << 4);
+#			endif
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static int call(ray_packet<8, float> const& rays, vec<3, float, Q> const& boxMin, vec<3, float, Q> const& boxMax, float const tMax[8], float tNear[8])
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				__m256 Near = _mm256_setzero_ps();
+				__m256 Far = _mm256_loadu_ps(tMax);
+				for(length_t c = 0; c < 3; ++c)
+					glm_slab8(_mm256_set1_ps(boxMin[c]), _mm256_set1_ps(boxMax[c]), _mm256_loadu_ps(rays.origin[c]), _mm256_loadu_ps(rays.invDirection[c]), Near, Far);
+				_mm256_storeu_ps(tNear, Near);
+				return _mm256_movemask_ps(_mm256_cmp_ps(Near, Far, _CMP_LE_OQ));
+#			else
+				float const* const OriginLo[3] = {rays.origin[0], rays.origin[1], rays.origin[2]};
+				float const* const InvDirLo[3] = {rays.invDirection[0], rays.invDirection[1], rays.invDirection[2]};
+				float const* const OriginHi[3] = {rays.origin[0] + 4, rays.origin[1] + 4, rays.origin[2] + 4};
+				float const* const InvDirHi[3] = {rays.invDirection[0] + 4, rays.invDirection[1] + 4, rays.invDirection[2] + 4};
+				float const BoxMin[3] = {boxMin.x, boxMin.y, boxMin.z};
+				float const BoxMax[3] = {boxMax.x, boxMax.y, boxMax.z};
+				int const Lo = glm_ray_packet4_aabb(OriginLo, InvDirLo, BoxMin, BoxMax, tMax, tNear);
+				int const Hi = glm_ray_packet4_aabb(OriginHi, InvDirHi, BoxMin, BoxMax, tMax + 4, tNear + 4);
+				return Lo | (Hi << 4);
+#			endif
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,136 @@
+/// @ref gtx_keyframe
+/// @file glm/gtx/keyframe.hpp
+///
+/// @see core (dependence)
+/// @see gtx_spline (dependence)
+/// @see gtx_quaternion (dependence)
+/// @see gtx_quaternion_batch (dependence)
+///
+/// @defgroup gtx_keyframe GLM_GTX_keyframe
+/// @ingroup gtx
+///
+/// Include <glm/gtx/keyframe.hpp> to use the features of this extension.
+///
+/// Animation tracks of vector or quaternion keys, sampled with step, linear or cubic Hermite interpolation.
+/// Key times are stored in an array and key values in an array per component.
+/// Each playback cursor keeps the segment last sampled on each track, so that finding the keys around the
+/// time is a comparison or two when the time moves forward or backward by less than a segment.
+///
+/// Vector tracks are interpolated with mix or hermite, quaternion tracks with slerp or squad.
+/// For float and GLM_FORCE_INTRINSICS, sampleTracks interpolates four or eight quaternion tracks at once, depending on SSE2 or AVX support,
+/// with the polynomial slerp of slerpBatch. Vector tracks are interpolated one at a time, gathering their keys costs more than mix or hermite.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <limits>
+#include <vector>
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/quaternion.hpp"
+#include "../gtx/quaternion_batch.hpp"
+#include "../gtx/spline.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_keyframe is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_keyframe extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_keyframe
+	/// @{
+
+	/// Interpolation between two keys of a track.
+	/// @see gtx_keyframe
+	enum keyframe_interpolation
+	{
+		keyframe_step,		///< Value of the previous key
+		keyframe_linear,	///< mix for vectors, shortest path slerp for quaternions
+		keyframe_hermite	///< hermite with the key tangents for vectors, squad with the intermediate quaternions of the keys for quaternions
+	};
+
+	/// Track of keys of L components.
+	/// @see gtx_keyframe
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct keyframe_track
+	{
+		typedef T value_type;
+
+		keyframe_interpolation interpolation;
+
+		/// Increasing key times.
+		std::vector<T> times;
+
+		/// Component c of the keys.
+		std::vector<T> values[L];
+
+		/// Component c of the derivatives of the keys by time, empty unless interpolation is keyframe_hermite.
+		std::vector<T> tangents[L];
+	};
+
+	/// Track of unit quaternion keys, each key in the hemisphere of the previous one.
+	/// @see gtx_keyframe
+	template<typename T, qualifier Q = defaultp>
+	struct keyframe_quat_track
+	{
+		typedef T value_type;
+
+		keyframe_interpolation interpolation;
+
+		/// Increasing key times.
+		std::vector<T> times;
+
+		/// Component x, y, z or w of the keys.
+		std::vector<T> values[4];
+
+		/// Component x, y, z or w of the squad control points of the keys, empty unless interpolation is keyframe_hermite.
+		std::vector<T> controls[4];
+	};
+
+	/// Build a track from count keys with increasing times, previous content of the track is discarded.
+	/// For keyframe_hermite, tangents are the derivatives of the keys by time, when null they are computed by finite differences
+	/// of the neighbor keys, as Catmull-Rom splines do for uniform times.
+	/// @see gtx_keyframe
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildKeyframeTrack(keyframe_track<L, T, Q>& track, keyframe_interpolation interpolation, T const* times, vec<L, T, Q> const* values, vec<L, T, Q> const* tangents, std::size_t count);
+
+	/// Build a track from count unit quaternion keys with increasing times, previous content of the track is discarded.
+	/// Keys are negated as needed to be in the hemisphere of the previous key.
+	/// For keyframe_hermite, the control points of the keys are those of intermediate, the first and last keys are their own control points.
+	/// @see gtx_keyframe
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void buildKeyframeTrack(keyframe_quat_track<T, Q>& track, keyframe_interpolation interpolation, T const* times, qua<T, Q> const* values, std::size_t count);
+
+	/// Sample a track at time, the first or last key before or after the keys.
+	/// segment is the cache of the playback cursor, the index of the first key of the segment last sampled, start it at 0.
+	/// @see gtx_keyframe
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<L, T, Q> sampleTrack(keyframe_track<L, T, Q> const& track, T time, std::size_t& segment);
+
+	/// Sample a quaternion track at time.
+	/// @see sampleTrack(keyframe_track<L, T, Q> const&, T, std::size_t&)
+	/// @see gtx_keyframe
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL qua<T, Q> sampleTrack(keyframe_quat_track<T, Q> const& track, T time, std::size_t& segment);
+
+	/// Sample count tracks at the same time, out[i] = sampleTrack(tracks[i], time, segments[i]).
+	/// segments is the cache of the playback cursor, one segment per track.
+	/// @see gtx_keyframe
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void sampleTracks(keyframe_track<L, T, Q> const* tracks, std::size_t count, T time, std::size_t* segments, vec<L, T, Q>* out);
+
+	/// Sample count quaternion tracks at the same time.
+	/// @see sampleTracks(keyframe_track<L, T, Q> const*, std::size_t, T, std::size_t*, vec<L, T, Q>*)
+	/// @see gtx_keyframe
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void sampleTracks(keyframe_quat_track<T, Q> const* tracks, std::size_t count, T time, std::size_t* segments, qua<T, Q>* out);
+
+	/// @}
+}//namespace glm
+
+#include "keyframe.inl"
@@ -0,0 +1,215 @@
+/// @ref gtx_keyframe
+
+#include <algorithm>
+
+namespace glm{
+namespace detail
+{
+	// First key of the segment containing time: the cached segment, one of the next two or the previous one, else a binary search.
+	// The segment of the last key is the last key alone.
+	template<typename T>
+	GLM_FUNC_QUALIFIER std::size_t keyframe_segment(std::vector<T> const& Times, T Time, std::size_t Segment)
+	{
+		std::size_t const Last = Times.size() - 1;
+		if(Segment <= Last)
+		{
+			if(Times[Segment] <= Time)
+			{
+				for(int Step = 0; Step < 3; ++Step, ++Segment)
+					if(Segment == Last || Time < Times[Segment + 1])
+						return Segment;
+			}
+			else if(Segment > 0 && Times[Segment - 1] <= Time)
+				return Segment - 1;
+		}
+
+		std::size_t const Upper = static_cast<std::size_t>(std::upper_bound(Times.begin(), Times.end(), Time) - Times.begin());
+		return Upper > 0 ? Upper - 1 : 0;
+	}
+
+	// Parameter in [0, 1] of time between the first key of the segment and the next one, the same key after the last key
+	template<typename T>
+	GLM_FUNC_QUALIFIER T keyframe_parameter(std::vector<T> const& Times, T Time, std::size_t Segment, std::size_t& Next, T& Duration)
+	{
+		if(Segment + 1 == Times.size())
+		{
+			Next = Segment;
+			Duration = static_cast<T>(0);
+			return static_cast<T>(0);
+		}
+
+		Next = Segment + 1;
+		Duration = Times[Next] - Times[Segment];
+		return clamp((Time - Times[Segment]) / Duration, static_cast<T>(0), static_cast<T>(1));
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> keyframe_key(std::vector<T> const Components[L], std::size_t Key)
+	{
+		vec<L, T, Q> Result;
+		for(length_t c = 0; c < L; ++c)
+			Result[c] = Components[c][Key];
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> keyframe_quat_key(std::vector<T> const Components[4], std::size_t Key)
+	{
+		return qua<T, Q>(Components[3][Key], Components[0][Key], Components[1][Key], Components[2][Key]);
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_keyframe
+	{
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void sample(keyframe_track<L, T, Q> const* tracks, std::size_t count, T time, std::size_t* segments, vec<L, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = sampleTrack(tracks[i], time, segments[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void sample(keyframe_quat_track<T, Q> const* tracks, std::size_t count, T time, std::size_t* segments, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = sampleTrack(tracks[i], time, segments[i]);
+		}
+	};
+}//namespace detail
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildKeyframeTrack(keyframe_track<L, T, Q>& track, keyframe_interpolation interpolation, T const* times, vec<L, T, Q> const* values, vec<L, T, Q> const* tangents, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildKeyframeTrack' only accept floating-point inputs");
+		assert(count > 0);
+
+		track.interpolation = interpolation;
+		track.times.assign(times, times + count);
+		for(length_t c = 0; c < L; ++c)
+		{
+			track.values[c].resize(count);
+			track.tangents[c].clear();
+			for(std::size_t k = 0; k < count; ++k)
+				track.values[c][k] = values[k][c];
+		}
+
+		if(interpolation != keyframe_hermite)
+			return;
+
+		for(length_t c = 0; c < L; ++c)
+			track.tangents[c].resize(count);
+		for(std::size_t k = 0; k < count; ++k)
+		{
+			vec<L, T, Q> Tangent(static_cast<T>(0));
+			if(tangents)
+				Tangent = tangents[k];
+			else if(count > 1)
+			{
+				std::size_t const Prev = k > 0 ? k - 1 : k;
+				std::size_t const Next = k + 1 < count ? k + 1 : k;
+				Tangent = (values[Next] - values[Prev]) / (times[Next] - times[Prev]);
+			}
+			for(length_t c = 0; c < L; ++c)
+				track.tangents[c][k] = Tangent[c];
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildKeyframeTrack(keyframe_quat_track<T, Q>& track, keyframe_interpolation interpolation, T const* times, qua<T, Q> const* values, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildKeyframeTrack' only accept floating-point inputs");
+		assert(count > 0);
+
+		std::vector<qua<T, Q> > Keys(values, values + count);
+		for(std::size_t k = 1; k < count; ++k)
+			if(dot(Keys[k - 1], Keys[k]) < static_cast<T>(0))
+				Keys[k] = -Keys[k];
+
+		track.interpolation = interpolation;
+		track.times.assign(times, times + count);
+		for(length_t c = 0; c < 4; ++c)
+		{
+			track.values[c].resize(count);
+			track.controls[c].clear();
+			for(std::size_t k = 0; k < count; ++k)
+				track.values[c][k] = Keys[k][c];
+		}
+
+		if(interpolation != keyframe_hermite)
+			return;
+
+		for(length_t c = 0; c < 4; ++c)
+			track.controls[c].resize(count);
+		for(std::size_t k = 0; k < count; ++k)
+		{
+			qua<T, Q> const Control = k > 0 && k + 1 < count ? intermediate(Keys[k - 1], Keys[k], Keys[k + 1]) : Keys[k];
+			for(length_t c = 0; c < 4; ++c)
+				track.controls[c][k] = Control[c];
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<L, T, Q> sampleTrack(keyframe_track<L, T, Q> const& track, T time, std::size_t& segment)
+	{
+		assert(!track.times.empty());
+		segment = detail::keyframe_segment(track.times, time, segment);
+
+		std::size_t Next;
+		T Duration;
+		T const s = detail::keyframe_parameter(track.times, time, segment, Next, Duration);
+
+		vec<L, T, Q> const v0(detail::keyframe_key<L, T, Q>(track.values, segment));
+		switch(track.interpolation)
+		{
+		case keyframe_step:
+			return v0;
+		case keyframe_linear:
+			return mix(v0, detail::keyframe_key<L, T, Q>(track.values, Next), s);
+		default:
+			return hermite(
+				v0, detail::keyframe_key<L, T, Q>(track.tangents, segment) * Duration,
+				detail::keyframe_key<L, T, Q>(track.values, Next), detail::keyframe_key<L, T, Q>(track.tangents, Next) * Duration, s);
+		}
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> sampleTrack(keyframe_quat_track<T, Q> const& track, T time, std::size_t& segment)
+	{
+		assert(!track.times.empty());
+		segment = detail::keyframe_segment(track.times, time, segment);
+
+		std::size_t Next;
+		T Duration;
+		T const s = detail::keyframe_parameter(track.times, time, segment, Next, Duration);
+
+		qua<T, Q> const q0(detail::keyframe_quat_key<T, Q>(track.values, segment));
+		switch(track.interpolation)
+		{
+		case keyframe_step:
+			return q0;
+		case keyframe_linear:
+			return slerp(q0, detail::keyframe_quat_key<T, Q>(track.values, Next), s);
+		default:
+			return squad(
+				q0, detail::keyframe_quat_key<T, Q>(track.values, Next),
+				detail::keyframe_quat_key<T, Q>(track.controls, segment), detail::keyframe_quat_key<T, Q>(track.controls, Next), s);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sampleTracks(keyframe_track<L, T, Q> const* tracks, std::size_t count, T time, std::size_t* segments, vec<L, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sampleTracks' only accept floating-point inputs");
+		detail::compute_keyframe<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::sample(tracks, count, time, segments, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sampleTracks(keyframe_quat_track<T, Q> const* tracks, std::size_t count, T time, std::size_t* segments, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sampleTracks' only accept floating-point inputs");
+		detail::compute_keyframe<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::sample(tracks, count, time, segments, out);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "keyframe_simd.inl"
+#endif
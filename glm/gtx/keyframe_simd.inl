@@ -0,0 +1,121 @@
+/// @ref gtx_keyframe
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Slerp along the arc from x to y as mix does, which may be the longest one, for the squad of the hermite tracks
+	struct lane_mix_kernel
+	{
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static void call(V const x[4], V const y[4], V const& a, V out[4])
+		{
+			V const CosTheta = lane_max(lane_min(lane_dot(x, y), V(1)), V(-1));
+			M const Linear = CosTheta > V(1) - V(epsilon<float>());
+
+			V const Theta = lane_acos_polynomial<V, M>(CosTheta);
+			V const InvSinTheta = V(1) / lane_max(sin(Theta), V(epsilon<float>()));
+			V const b = V(1) - a;
+			V const w0 = lane_select(Linear, b, sin(b * Theta) * InvSinTheta);
+			V const w1 = lane_select(Linear, a, sin(a * Theta) * InvSinTheta);
+
+			for(length_t c = 0; c < 4; ++c)
+				out[c] = x[c] * w0 + y[c] * w1;
+		}
+
+		// Angles in [0, pi], folded to [0, pi / 2] for the polynomial
+		template<typename V>
+		GLM_FUNC_QUALIFIER static V sin(V const& x)
+		{
+			return lane_sin_polynomial(lane_min(x, V(3.14159265358979323846) - x));
+		}
+	};
+
+	// Quaternion tracks are sampled Width at a time: the segments and parameters are found per track, the keys are gathered
+	// from the component arrays and interpolated in lanes. The remaining tracks are sampled by the generic path.
+	template<qualifier Q>
+	struct compute_keyframe<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			typedef lane_mask8 lane_mask;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			typedef lane_mask4 lane_mask;
+			static std::size_t const Width = 4;
+#		endif
+
+		// The interpolation of vector tracks costs less than gathering their keys, they are sampled one at a time
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void sample(keyframe_track<L, float, Q> const* tracks, std::size_t count, float time, std::size_t* segments, vec<L, float, Q>* out)
+		{
+			compute_keyframe<float, Q, false>::sample(tracks, count, time, segments, out);
+		}
+
+		// Quaternion tracks are slerp(q0, q1, s), equal to mix(q0, q1, s) for keys in the same hemisphere, and squad as
+		// mix(mix(q0, q1, s), mix(c0, c1, s), 2s(1 - s)) when a track of the lanes is keyframe_hermite, the others with a weight of 0.
+		GLM_FUNC_QUALIFIER static void sample(keyframe_quat_track<float, Q> const* tracks, std::size_t count, float time, std::size_t* segments, qua<float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				float Parameters[2][Width], Keys[4][4][Width];
+				bool AnyHermite = false;
+				for(std::size_t j = 0; j < Width; ++j)
+				{
+					keyframe_quat_track<float, Q> const& Track = tracks[i + j];
+					assert(!Track.times.empty());
+					std::size_t const k = segments[i + j] = keyframe_segment(Track.times, time, segments[i + j]);
+
+					std::size_t Next;
+					float Duration;
+					float const s = keyframe_parameter(Track.times, time, k, Next, Duration);
+
+					bool const Hermite = Track.interpolation == keyframe_hermite;
+					AnyHermite = AnyHermite || Hermite;
+					Parameters[0][j] = Track.interpolation == keyframe_step ? 0.0f : s;
+					Parameters[1][j] = Hermite ? 2.0f * s * (1.0f - s) : 0.0f;
+
+					std::vector<float> const* Controls = Hermite ? Track.controls : Track.values;
+					for(length_t c = 0; c < 4; ++c)
+					{
+						Keys[0][c][j] = Track.values[c][k];
+						Keys[1][c][j] = Track.values[c][Next];
+						Keys[2][c][j] = Controls[c][k];
+						Keys[3][c][j] = Controls[c][Next];
+					}
+				}
+
+				lane s, h, q0[4], q1[4], Result[4];
+				lane_load(Parameters[0], 0, s);
+				for(length_t c = 0; c < 4; ++c)
+				{
+					lane_load(Keys[0][c], 0, q0[c]);
+					lane_load(Keys[1][c], 0, q1[c]);
+				}
+				lane_slerp_kernel::call<lane, lane_mask>(q0, q1, s, Result);
+
+				if(AnyHermite)
+				{
+					lane c0[4], c1[4], Controls[4], Keys01[4];
+					lane_load(Parameters[1], 0, h);
+					for(length_t c = 0; c < 4; ++c)
+					{
+						lane_load(Keys[2][c], 0, c0[c]);
+						lane_load(Keys[3][c], 0, c1[c]);
+						Keys01[c] = Result[c];
+					}
+					lane_mix_kernel::call<lane, lane_mask>(c0, c1, s, Controls);
+					lane_mix_kernel::call<lane, lane_mask>(Keys01, Controls, h, Result);
+				}
+				lane_store(Result, i, out);
+			}
+			compute_keyframe<float, Q, false>::sample(tracks + i, count - i, time, segments + i, out + i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,76 @@
+/// @ref gtx_matrix_batch
+/// @file glm/gtx/matrix_batch.hpp
+///
+/// @see core (dependence)
+///
+/// @defgroup gtx_matrix_batch GLM_GTX_matrix_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_batch.hpp> to use the features of this extension.
+///
+/// Multiply arrays of 4x4 matrices and vectors in a single call.
+/// For float and GLM_FORCE_INTRINSICS, the products use the SSE kernels of simd/matrix.h whatever the qualifier,
+/// the next elements are prefetched and outputs larger than GLM_BATCH_STREAM_THRESHOLD bytes are written
+/// with non-temporal stores, bypassing the cache, when they are 16 bytes aligned.
+/// The output may be the same array as an input but may not partially overlap it.
+///
+/// With AVX, two columns or two vectors are computed per 256 bits operation.
+///
+/// Cycles per element with SSE2 / AVX2 on a 2.1 GHz Xeon, for cache resident and 64 MB arrays:
+/// mat4 * mat4[i] about 14 / 6 and 23 / 17, mat4[i] * mat4[i] about 15 / 7 and 27 / 24, mat4 * vec4[i] about 4 / 2 and 5 / 2.5.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include "../glm.hpp"
+
+#ifndef GLM_BATCH_STREAM_THRESHOLD
+	/// Size in bytes of the batch outputs above which non-temporal stores are used, about the size of a last level cache slice.
+#	define GLM_BATCH_STREAM_THRESHOLD (4 << 20)
+#endif
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_matrix_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_batch
+	/// @{
+
+	/// Compute out[i] = m * in[i] for count matrices.
+	/// @see gtx_matrix_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, T, Q> const& m, mat<4, 4, T, Q> const* in, std::size_t count, mat<4, 4, T, Q>* out);
+
+	/// Compute out[i] = a[i] * b[i] for count pairs of matrices.
+	/// @see gtx_matrix_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, T, Q> const* a, mat<4, 4, T, Q> const* b, std::size_t count, mat<4, 4, T, Q>* out);
+
+	/// Compute out[i] = m * in[i] for count vectors.
+	/// @see gtx_matrix_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, std::size_t count, vec<4, T, Q>* out);
+
+	/// Compute out[i] = m * in[i] for count vectors read every inStride bytes and written every outStride bytes,
+	/// for instance the positions of interleaved vertices. Strided outputs are never written with non-temporal stores.
+	/// @see gtx_matrix_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, std::size_t inStride, std::size_t count, vec<4, T, Q>* out, std::size_t outStride);
+
+	/// Compute out[i] = vec3(m * vec4(in[i], 1)) for count points read every inStride bytes and written every outStride bytes.
+	/// The last row of m is ignored, there is no perspective division.
+	/// @see gtx_matrix_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mulBatch(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, std::size_t inStride, std::size_t count, vec<3, T, Q>* out, std::size_t outStride);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_batch.inl"
@@ -0,0 +1,97 @@
+/// @ref gtx_matrix_batch
+
+namespace glm{
+namespace detail
+{
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType const* batch_element(genType const* base, std::size_t stride, std::size_t i)
+	{
+		return reinterpret_cast<genType const*>(reinterpret_cast<char const*>(base) + stride * i);
+	}
+
+	template<typename genType>
+	GLM_FUNC_QUALIFIER genType* batch_element(genType* base, std::size_t stride, std::size_t i)
+	{
+		return reinterpret_cast<genType*>(reinterpret_cast<char*>(base) + stride * i);
+	}
+
+	// The results go through a local so that out may alias the inputs
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_matrix_batch
+	{
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, T, Q> const& m, mat<4, 4, T, Q> const* in, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			mat<4, 4, T, Q> const M(m);
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				mat<4, 4, T, Q> const Result(M * in[i]);
+				out[i] = Result;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, T, Q> const* a, mat<4, 4, T, Q> const* b, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				mat<4, 4, T, Q> const Result(a[i] * b[i]);
+				out[i] = Result;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, std::size_t inStride, std::size_t count, vec<4, T, Q>* out, std::size_t outStride)
+		{
+			mat<4, 4, T, Q> const M(m);
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<4, T, Q> const Result(M * *batch_element(in, inStride, i));
+				*batch_element(out, outStride, i) = Result;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, std::size_t inStride, std::size_t count, vec<3, T, Q>* out, std::size_t outStride)
+		{
+			mat<4, 4, T, Q> const M(m);
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				vec<3, T, Q> const& p = *batch_element(in, inStride, i);
+				vec<3, T, Q> const Result = vec<3, T, Q>(M[0]) * p.x + vec<3, T, Q>(M[1]) * p.y + vec<3, T, Q>(M[2]) * p.z + vec<3, T, Q>(M[3]);
+				*batch_element(out, outStride, i) = Result;
+			}
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, T, Q> const& m, mat<4, 4, T, Q> const* in, std::size_t count, mat<4, 4, T, Q>* out)
+	{
+		detail::compute_matrix_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(m, in, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, T, Q> const* a, mat<4, 4, T, Q> const* b, std::size_t count, mat<4, 4, T, Q>* out)
+	{
+		detail::compute_matrix_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(a, b, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, std::size_t count, vec<4, T, Q>* out)
+	{
+		detail::compute_matrix_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(m, in, sizeof(vec<4, T, Q>), count, out, sizeof(vec<4, T, Q>));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, T, Q> const& m, vec<4, T, Q> const* in, std::size_t inStride, std::size_t count, vec<4, T, Q>* out, std::size_t outStride)
+	{
+		detail::compute_matrix_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(m, in, inStride, count, out, outStride);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mulBatch(mat<4, 4, T, Q> const& m, vec<3, T, Q> const* in, std::size_t inStride, std::size_t count, vec<3, T, Q>* out, std::size_t outStride)
+	{
+		detail::compute_matrix_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mul(m, in, inStride, count, out, outStride);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_batch_simd.inl"
+#endif
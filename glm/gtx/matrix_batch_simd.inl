@@ -0,0 +1,251 @@
+/// @ref gtx_matrix_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template<bool Stream>
+	struct glm_batch_store
+	{
+		GLM_FUNC_QUALIFIER static void call(float* out, glm_vec4 v)
+		{
+			_mm_storeu_ps(out, v);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			GLM_FUNC_QUALIFIER static void call(float* out, __m256 v)
+			{
+				_mm256_storeu_ps(out, v);
+			}
+#		endif
+	};
+
+	// Non-temporal store, out must be 16 bytes aligned
+	template<>
+	struct glm_batch_store<true>
+	{
+		GLM_FUNC_QUALIFIER static void call(float* out, glm_vec4 v)
+		{
+			_mm_stream_ps(out, v);
+		}
+
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			// Two 128 bits stores to only require 16 bytes alignment
+			GLM_FUNC_QUALIFIER static void call(float* out, __m256 v)
+			{
+				_mm_stream_ps(out, _mm256_castps256_ps128(v));
+				_mm_stream_ps(out + 4, _mm256_extractf128_ps(v, 1));
+			}
+#		endif
+	};
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER __m256 glm_batch_fma8(__m256 a, __m256 b, __m256 c)
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX2_BIT
+			return _mm256_fmadd_ps(a, b, c);
+#		else
+			return _mm256_add_ps(_mm256_mul_ps(a, b), c);
+#		endif
+	}
+
+	// Two columns at once: each 128 bits lane of in holds a column whose components are broadcast within the lane
+	GLM_FUNC_QUALIFIER __m256 glm_batch_mat4_mul_columns(__m256 const m[4], __m256 in)
+	{
+		__m256 r = _mm256_mul_ps(m[0], _mm256_permute_ps(in, _MM_SHUFFLE(0, 0, 0, 0)));
+		r = glm_batch_fma8(m[1], _mm256_permute_ps(in, _MM_SHUFFLE(1, 1, 1, 1)), r);
+		r = glm_batch_fma8(m[2], _mm256_permute_ps(in, _MM_SHUFFLE(2, 2, 2, 2)), r);
+		return glm_batch_fma8(m[3], _mm256_permute_ps(in, _MM_SHUFFLE(3, 3, 3, 3)), r);
+	}
+
+	GLM_FUNC_QUALIFIER void glm_batch_mat4_load_columns(float const* m, __m256 out[4])
+	{
+		out[0] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 0));
+		out[1] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 4));
+		out[2] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 8));
+		out[3] = _mm256_broadcast_ps(reinterpret_cast<__m128 const*>(m + 12));
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	GLM_FUNC_QUALIFIER bool glm_batch_stream(void const* out, std::size_t size)
+	{
+		return size > static_cast<std::size_t>(GLM_BATCH_STREAM_THRESHOLD) && (reinterpret_cast<std::size_t>(out) & 15) == 0;
+	}
+
+	GLM_FUNC_QUALIFIER void glm_batch_prefetch(void const* p)
+	{
+		_mm_prefetch(static_cast<char const*>(p), _MM_HINT_T0);
+	}
+
+	template<qualifier Q>
+	struct compute_matrix_batch<float, Q, true>
+	{
+		// Elements prefetched ahead of the current one
+		static std::size_t const MatrixDistance = 8;
+		static std::size_t const VectorDistance = 16;
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void mul_loop(mat<4, 4, float, Q> const& m, mat<4, 4, float, Q> const* in, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				__m256 M[4];
+				glm_batch_mat4_load_columns(&m[0].x, M);
+
+				for(std::size_t i = 0; i < count; ++i)
+				{
+					if(i + MatrixDistance < count)
+						glm_batch_prefetch(&in[i + MatrixDistance]);
+
+					__m256 const O01 = glm_batch_mat4_mul_columns(M, _mm256_loadu_ps(&in[i][0].x));
+					__m256 const O23 = glm_batch_mat4_mul_columns(M, _mm256_loadu_ps(&in[i][2].x));
+					glm_batch_store<Stream>::call(&out[i][0].x, O01);
+					glm_batch_store<Stream>::call(&out[i][2].x, O23);
+				}
+#			else
+				glm_vec4 const M[4] = {_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+
+				for(std::size_t i = 0; i < count; ++i)
+				{
+					if(i + MatrixDistance < count)
+						glm_batch_prefetch(&in[i + MatrixDistance]);
+
+					glm_vec4 const I[4] = {_mm_loadu_ps(&in[i][0].x), _mm_loadu_ps(&in[i][1].x), _mm_loadu_ps(&in[i][2].x), _mm_loadu_ps(&in[i][3].x)};
+					glm_vec4 O[4];
+					glm_mat4_mul(M, I, O);
+					glm_batch_store<Stream>::call(&out[i][0].x, O[0]);
+					glm_batch_store<Stream>::call(&out[i][1].x, O[1]);
+					glm_batch_store<Stream>::call(&out[i][2].x, O[2]);
+					glm_batch_store<Stream>::call(&out[i][3].x, O[3]);
+				}
+#			endif
+		}
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void mul_loop(mat<4, 4, float, Q> const* a, mat<4, 4, float, Q> const* b, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(i + MatrixDistance < count)
+				{
+					glm_batch_prefetch(&a[i + MatrixDistance]);
+					glm_batch_prefetch(&b[i + MatrixDistance]);
+				}
+
+#				if GLM_ARCH & GLM_ARCH_AVX_BIT
+					__m256 A[4];
+					glm_batch_mat4_load_columns(&a[i][0].x, A);
+					__m256 const O01 = glm_batch_mat4_mul_columns(A, _mm256_loadu_ps(&b[i][0].x));
+					__m256 const O23 = glm_batch_mat4_mul_columns(A, _mm256_loadu_ps(&b[i][2].x));
+					glm_batch_store<Stream>::call(&out[i][0].x, O01);
+					glm_batch_store<Stream>::call(&out[i][2].x, O23);
+#				else
+					glm_vec4 const A[4] = {_mm_loadu_ps(&a[i][0].x), _mm_loadu_ps(&a[i][1].x), _mm_loadu_ps(&a[i][2].x), _mm_loadu_ps(&a[i][3].x)};
+					glm_vec4 const B[4] = {_mm_loadu_ps(&b[i][0].x), _mm_loadu_ps(&b[i][1].x), _mm_loadu_ps(&b[i][2].x), _mm_loadu_ps(&b[i][3].x)};
+					glm_vec4 O[4];
+					glm_mat4_mul(A, B, O);
+					glm_batch_store<Stream>::call(&out[i][0].x, O[0]);
+					glm_batch_store<Stream>::call(&out[i][1].x, O[1]);
+					glm_batch_store<Stream>::call(&out[i][2].x, O[2]);
+					glm_batch_store<Stream>::call(&out[i][3].x, O[3]);
+#				endif
+			}
+		}
+
+		template<bool Stream>
+		GLM_FUNC_QUALIFIER static void mul_loop(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, std::size_t inStride, std::size_t count, vec<4, float, Q>* out, std::size_t outStride)
+		{
+			glm_vec4 const M[4] = {_mm_loadu_ps(&m[0].x), _mm_loadu_ps(&m[1].x), _mm_loadu_ps(&m[2].x), _mm_loadu_ps(&m[3].x)};
+			std::size_t i = 0;
+
+#			if GLM_ARCH & GLM_ARCH_AVX_BIT
+				// Two vectors at once, one per 128 bits lane
+				__m256 M2[4];
+				glm_batch_mat4_load_columns(&m[0].x, M2);
+
+				for(; i + 2 <= count; i += 2)
+				{
+					if(i + VectorDistance < count)
+					{
+						glm_batch_prefetch(batch_element(in, inStride, i + VectorDistance));
+						glm_batch_prefetch(batch_element(in, inStride, i + VectorDistance + 1));
+					}
+
+					__m256 const v = _mm256_insertf128_ps(_mm256_castps128_ps256(_mm_loadu_ps(&batch_element(in, inStride, i)->x)), _mm_loadu_ps(&batch_element(in, inStride, i + 1)->x), 1);
+					__m256 const r = glm_batch_mat4_mul_columns(M2, v);
+					glm_batch_store<Stream>::call(&batch_element(out, outStride, i)->x, _mm256_castps256_ps128(r));
+					glm_batch_store<Stream>::call(&batch_element(out, outStride, i + 1)->x, _mm256_extractf128_ps(r, 1));
+				}
+#			endif
+
+			for(; i < count; ++i)
+			{
+				if(i + VectorDistance < count)
+					glm_batch_prefetch(batch_element(in, inStride, i + VectorDistance));
+
+				glm_vec4 const v = _mm_loadu_ps(&batch_element(in, inStride, i)->x);
+				glm_batch_store<Stream>::call(&batch_element(out, outStride, i)->x, glm_mat4_mul_vec4(M, v));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, float, Q> const& m, mat<4, 4, float, Q> const* in, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+			if(glm_batch_stream(out, count * sizeof(mat<4, 4, float, Q>)))
+			{
+				mul_loop<true>(m, in, count, out);
+				_mm_sfence();
+			}
+			else
+				mul_loop<false>(m, in, count, out);
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, float, Q> const* a, mat<4, 4, float, Q> const* b, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+			if(glm_batch_stream(out, count * sizeof(mat<4, 4, float, Q>)))
+			{
+				mul_loop<true>(a, b, count, out);
+				_mm_sfence();
+			}
+			else
+				mul_loop<false>(a, b, count, out);
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, float, Q> const& m, vec<4, float, Q> const* in, std::size_t inStride, std::size_t count, vec<4, float, Q>* out, std::size_t outStride)
+		{
+			if(outStride == sizeof(vec<4, float, Q>) && glm_batch_stream(out, count * outStride))
+			{
+				mul_loop<true>(m, in, inStride, count, out, outStride);
+				_mm_sfence();
+			}
+			else
+				mul_loop<false>(m, in, inStride, count, out, outStride);
+		}
+
+		GLM_FUNC_QUALIFIER static void mul(mat<4, 4, float, Q> const& m, vec<3, float, Q> const* in, std::size_t inStride, std::size_t count, vec<3, float, Q>* out, std::size_t outStride)
+		{
+			glm_vec4 const M0 = _mm_loadu_ps(&m[0].x);
+			glm_vec4 const M1 = _mm_loadu_ps(&m[1].x);
+			glm_vec4 const M2 = _mm_loadu_ps(&m[2].x);
+			glm_vec4 const M3 = _mm_loadu_ps(&m[3].x);
+
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				if(i + VectorDistance < count)
+					glm_batch_prefetch(batch_element(in, inStride, i + VectorDistance));
+
+				vec<3, float, Q> const& p = *batch_element(in, inStride, i);
+				glm_vec4 const r = glm_vec4_fma(M0, _mm_set1_ps(p.x), glm_vec4_fma(M1, _mm_set1_ps(p.y), glm_vec4_fma(M2, _mm_set1_ps(p.z), M3)));
+
+				// Write x and y as a pair then z, the fourth lane may belong to the next element
+				float* Out = &batch_element(out, outStride, i)->x;
+				_mm_storel_pi(reinterpret_cast<__m64*>(Out), r);
+				_mm_store_ss(Out + 2, _mm_movehl_ps(r, r));
+			}
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -9,15 +9,18 @@
 /// Include <glm/gtx/matrix_decompose.hpp> to use the features of this extension.
 ///
 /// Decomposes a model matrix to translations, rotation and scale components
+/// decomposeAffine and decomposePolar skip the perspective terms of affine matrices and have batch versions over arrays.
 
 #pragma once
 
 // Dependencies
+#include <cstddef>
 #include "../mat4x4.hpp"
 #include "../vec3.hpp"
 #include "../vec4.hpp"
 #include "../geometric.hpp"
 #include "../gtc/quaternion.hpp"
+#include "../gtc/matrix_inverse.hpp"
 #include "../gtc/matrix_transform.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
@@ -40,6 +43,51 @@ namespace glm
 		mat<4, 4, T, Q> const& modelMatrix,
 		vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation, vec<3, T, Q> & skew, vec<4, T, Q> & perspective);
 
+	/// Decompose an affine matrix without shear, translate(translation) * mat4_cast(orientation) * scale(scale), into its components.
+	/// The last row of m is ignored and the scale is the length of the columns, negated when the linear part is a reflection.
+	/// Faster than decompose which handles perspective and shear.
+	/// Return false if the linear part is singular.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool decomposeAffine(mat<4, 4, T, Q> const& m, vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation);
+
+	/// Decompose an affine matrix with the polar decomposition of its linear part, the product of the closest rotation and a symmetric stretch matrix.
+	/// Unlike decomposeAffine, the orientation remains a rotation when the matrix has shear.
+	/// The last row of m is ignored and the stretch is negated when the linear part is a reflection.
+	/// Return false if the linear part is singular.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool decomposePolar(mat<4, 4, T, Q> const& m, mat<3, 3, T, Q> & stretch, qua<T, Q> & orientation, vec<3, T, Q> & translation);
+
+	/// Decompose an affine matrix with the polar decomposition of its linear part, scale is the diagonal of the stretch matrix.
+	/// Without shear, the result is the same as decomposeAffine.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool decomposePolar(mat<4, 4, T, Q> const& m, vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation);
+
+	/// Decompose count affine matrices without shear with decomposeAffine into translations, orientations and scales stored as structure of arrays.
+	/// The orientation of a matrix with a singular linear part is the identity.
+	/// Four matrices are decomposed at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// Return the number of matrices with a non singular linear part.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t decomposeAffine(
+		mat<4, 4, T, Q> const* m, std::size_t count,
+		T* translationX, T* translationY, T* translationZ,
+		T* rotationX, T* rotationY, T* rotationZ, T* rotationW,
+		T* scaleX, T* scaleY, T* scaleZ);
+
+	/// Decompose count affine matrices with decomposePolar into translations, orientations and scales stored as structure of arrays.
+	/// The orientation of a matrix with a singular linear part is the identity.
+	/// Return the number of matrices with a non singular linear part.
+	/// @see gtx_matrix_decompose
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t decomposePolar(
+		mat<4, 4, T, Q> const* m, std::size_t count,
+		T* translationX, T* translationY, T* translationZ,
+		T* rotationX, T* rotationY, T* rotationZ, T* rotationW,
+		T* scaleX, T* scaleY, T* scaleZ);
+
 	/// @}
 }//namespace glm
 
@@ -22,6 +22,73 @@ namespace detail
 	{
 		return v * desiredLength / length(v);
 	}
+
+	// Quaternion of a rotation matrix, the case is picked from the signs of the diagonal so that the square root is taken of a value of at least 1
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> rotation_to_quat(mat<3, 3, T, Q> const& r)
+	{
+		T const One = static_cast<T>(1);
+		T t;
+		vec<4, T, Q> q;
+		if(r[2][2] < static_cast<T>(0))
+		{
+			if(r[0][0] > r[1][1])
+			{
+				t = One + r[0][0] - r[1][1] - r[2][2];
+				q = vec<4, T, Q>(t, r[0][1] + r[1][0], r[2][0] + r[0][2], r[1][2] - r[2][1]);
+			}
+			else
+			{
+				t = One - r[0][0] + r[1][1] - r[2][2];
+				q = vec<4, T, Q>(r[0][1] + r[1][0], t, r[1][2] + r[2][1], r[2][0] - r[0][2]);
+			}
+		}
+		else
+		{
+			if(r[0][0] < -r[1][1])
+			{
+				t = One - r[0][0] - r[1][1] + r[2][2];
+				q = vec<4, T, Q>(r[2][0] + r[0][2], r[1][2] + r[2][1], t, r[0][1] - r[1][0]);
+			}
+			else
+			{
+				t = One + r[0][0] + r[1][1] + r[2][2];
+				q = vec<4, T, Q>(r[1][2] - r[2][1], r[2][0] - r[0][2], r[0][1] - r[1][0], t);
+			}
+		}
+
+		q *= static_cast<T>(0.5) / sqrt(t);
+		return qua<T, Q>(q.w, q.x, q.y, q.z);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T frobenius_length2(mat<3, 3, T, Q> const& m)
+	{
+		return dot(m[0], m[0]) + dot(m[1], m[1]) + dot(m[2], m[2]);
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_decompose
+	{
+		// Decompose the matrices [first, count)
+		GLM_FUNC_QUALIFIER static std::size_t affine(
+			mat<4, 4, T, Q> const* m, std::size_t first, std::size_t count,
+			T* tx, T* ty, T* tz, T* rx, T* ry, T* rz, T* rw, T* sx, T* sy, T* sz)
+		{
+			std::size_t Decomposed = 0;
+			for(std::size_t i = first; i < count; ++i)
+			{
+				vec<3, T, Q> Scale, Translation;
+				qua<T, Q> Orientation;
+				Decomposed += decomposeAffine(m[i], Scale, Orientation, Translation) ? 1 : 0;
+
+				tx[i] = Translation.x; ty[i] = Translation.y; tz[i] = Translation.z;
+				rx[i] = Orientation.x; ry[i] = Orientation.y; rz[i] = Orientation.z; rw[i] = Orientation.w;
+				sx[i] = Scale.x; sy[i] = Scale.y; sz[i] = Scale.z;
+			}
+			return Decomposed;
+		}
+	};
 }//namespace detail
 
 	// Matrix decompose
@@ -183,4 +250,115 @@ namespace detail
 
 		return true;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposeAffine(mat<4, 4, T, Q> const& m, vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation)
+	{
+		vec<3, T, Q> const Column0(m[0]);
+		vec<3, T, Q> const Column1(m[1]);
+		vec<3, T, Q> const Column2(m[2]);
+		T const Determinant = dot(Column0, cross(Column1, Column2));
+
+		translation = vec<3, T, Q>(m[3]);
+		scale = vec<3, T, Q>(length(Column0), length(Column1), length(Column2));
+		if(Determinant == static_cast<T>(0))
+		{
+			orientation = qua<T, Q>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+			return false;
+		}
+
+		// A reflection is folded into negative scales
+		if(Determinant < static_cast<T>(0))
+			scale = -scale;
+
+		orientation = detail::rotation_to_quat(mat<3, 3, T, Q>(Column0 / scale.x, Column1 / scale.y, Column2 / scale.z));
+		return true;
+	}
+
+	// Newton iteration R = (gamma * R + inverseTranspose(R) / gamma) / 2 with the Frobenius norm scaling of Higham
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposePolar(mat<4, 4, T, Q> const& m, mat<3, 3, T, Q> & stretch, qua<T, Q> & orientation, vec<3, T, Q> & translation)
+	{
+		mat<3, 3, T, Q> const Linear(m);
+		T const Determinant = determinant(Linear);
+
+		translation = vec<3, T, Q>(m[3]);
+		if(Determinant == static_cast<T>(0))
+		{
+			stretch = Linear;
+			orientation = qua<T, Q>(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0));
+			return false;
+		}
+
+		T const Tolerance = static_cast<T>(64) * epsilon<T>() * epsilon<T>();
+		mat<3, 3, T, Q> Rotation(Linear);
+		for(int Iteration = 0; Iteration < 16; ++Iteration)
+		{
+			mat<3, 3, T, Q> const InverseTranspose(inverseTranspose(Rotation));
+			T const Gamma = sqrt(sqrt(detail::frobenius_length2(InverseTranspose) / detail::frobenius_length2(Rotation)));
+			mat<3, 3, T, Q> const Next((Rotation * Gamma + InverseTranspose / Gamma) * static_cast<T>(0.5));
+			T const Delta = detail::frobenius_length2(Next - Rotation);
+
+			Rotation = Next;
+			if(Delta <= Tolerance * detail::frobenius_length2(Rotation))
+				break;
+		}
+
+		// The iteration converges to a reflection when the determinant is negative, it is folded into the stretch
+		if(Determinant < static_cast<T>(0))
+			Rotation = -Rotation;
+
+		stretch = transpose(Rotation) * Linear;
+		orientation = detail::rotation_to_quat(Rotation);
+		return true;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool decomposePolar(mat<4, 4, T, Q> const& m, vec<3, T, Q> & scale, qua<T, Q> & orientation, vec<3, T, Q> & translation)
+	{
+		mat<3, 3, T, Q> Stretch;
+		bool const Result = decomposePolar(m, Stretch, orientation, translation);
+		scale = vec<3, T, Q>(Stretch[0][0], Stretch[1][1], Stretch[2][2]);
+		return Result;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t decomposeAffine
+	(
+		mat<4, 4, T, Q> const* m, std::size_t count,
+		T* translationX, T* translationY, T* translationZ,
+		T* rotationX, T* rotationY, T* rotationZ, T* rotationW,
+		T* scaleX, T* scaleY, T* scaleZ
+	)
+	{
+		return detail::compute_decompose<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::affine(
+			m, 0, count, translationX, translationY, translationZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t decomposePolar
+	(
+		mat<4, 4, T, Q> const* m, std::size_t count,
+		T* translationX, T* translationY, T* translationZ,
+		T* rotationX, T* rotationY, T* rotationZ, T* rotationW,
+		T* scaleX, T* scaleY, T* scaleZ
+	)
+	{
+		std::size_t Decomposed = 0;
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			vec<3, T, Q> Scale, Translation;
+			qua<T, Q> Orientation;
+			Decomposed += decomposePolar(m[i], Scale, Orientation, Translation) ? 1 : 0;
+
+			translationX[i] = Translation.x; translationY[i] = Translation.y; translationZ[i] = Translation.z;
+			rotationX[i] = Orientation.x; rotationY[i] = Orientation.y; rotationZ[i] = Orientation.z; rotationW[i] = Orientation.w;
+			scaleX[i] = Scale.x; scaleY[i] = Scale.y; scaleZ[i] = Scale.z;
+		}
+		return Decomposed;
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_decompose_simd.inl"
+#endif
@@ -0,0 +1,112 @@
+/// @ref gtx_matrix_decompose
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_decompose<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static std::size_t affine(
+			mat<4, 4, float, Q> const* m, std::size_t first, std::size_t count,
+			float* tx, float* ty, float* tz, float* rx, float* ry, float* rz, float* rw, float* sx, float* sy, float* sz)
+		{
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 const One = _mm_set1_ps(1.0f);
+			glm_vec4 const Half = _mm_set1_ps(0.5f);
+			glm_vec4 const SignMask = _mm_set1_ps(-0.0f);
+
+			std::size_t Decomposed = 0;
+			std::size_t i = first;
+			for(; i + 4 <= count; i += 4)
+			{
+				// Column c of the four matrices as structure of arrays: X[c] holds the x components
+				glm_vec4 X[4], Y[4], Z[4];
+				for(length_t c = 0; c < 4; ++c)
+				{
+					glm_vec4 c0 = _mm_loadu_ps(&m[i + 0][c].x);
+					glm_vec4 c1 = _mm_loadu_ps(&m[i + 1][c].x);
+					glm_vec4 c2 = _mm_loadu_ps(&m[i + 2][c].x);
+					glm_vec4 c3 = _mm_loadu_ps(&m[i + 3][c].x);
+					_MM_TRANSPOSE4_PS(c0, c1, c2, c3);
+					X[c] = c0;
+					Y[c] = c1;
+					Z[c] = c2;
+				}
+
+				_mm_storeu_ps(tx + i, X[3]);
+				_mm_storeu_ps(ty + i, Y[3]);
+				_mm_storeu_ps(tz + i, Z[3]);
+
+				// Determinant as dot(Column0, cross(Column1, Column2))
+				glm_vec4 const CrossX = _mm_sub_ps(_mm_mul_ps(Y[1], Z[2]), _mm_mul_ps(Z[1], Y[2]));
+				glm_vec4 const CrossY = _mm_sub_ps(_mm_mul_ps(Z[1], X[2]), _mm_mul_ps(X[1], Z[2]));
+				glm_vec4 const CrossZ = _mm_sub_ps(_mm_mul_ps(X[1], Y[2]), _mm_mul_ps(Y[1], X[2]));
+				glm_vec4 const Determinant = _mm_add_ps(_mm_add_ps(_mm_mul_ps(X[0], CrossX), _mm_mul_ps(Y[0], CrossY)), _mm_mul_ps(Z[0], CrossZ));
+				glm_vec4 const Regular = _mm_cmpneq_ps(Determinant, Zero);
+				glm_vec4 const Sign = _mm_and_ps(_mm_and_ps(Determinant, SignMask), Regular);
+
+				// Scales, negated for a reflection, and rotation columns
+				glm_vec4 S[3], R[9];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					glm_vec4 const Length = _mm_sqrt_ps(_mm_add_ps(_mm_add_ps(_mm_mul_ps(X[c], X[c]), _mm_mul_ps(Y[c], Y[c])), _mm_mul_ps(Z[c], Z[c])));
+					S[c] = _mm_xor_ps(Length, Sign);
+
+					// Singular matrices get an identity rotation
+					glm_vec4 const InverseScale = _mm_and_ps(Regular, _mm_div_ps(One, S[c]));
+					glm_vec4 const Identity = _mm_andnot_ps(Regular, One);
+					R[c * 3 + 0] = _mm_mul_ps(X[c], InverseScale);
+					R[c * 3 + 1] = _mm_mul_ps(Y[c], InverseScale);
+					R[c * 3 + 2] = _mm_mul_ps(Z[c], InverseScale);
+					R[c * 3 + c] = _mm_or_ps(R[c * 3 + c], Identity);
+				}
+
+				_mm_storeu_ps(sx + i, S[0]);
+				_mm_storeu_ps(sy + i, S[1]);
+				_mm_storeu_ps(sz + i, S[2]);
+
+				// Same case selection as rotation_to_quat, R[c * 3 + r] is the element of column c and row r
+				glm_vec4 const R00 = R[0], R11 = R[4], R22 = R[8];
+				glm_vec4 const SumXY = _mm_add_ps(R[1], R[3]);
+				glm_vec4 const SumXZ = _mm_add_ps(R[6], R[2]);
+				glm_vec4 const SumYZ = _mm_add_ps(R[5], R[7]);
+				glm_vec4 const DiffX = _mm_sub_ps(R[5], R[7]);
+				glm_vec4 const DiffY = _mm_sub_ps(R[6], R[2]);
+				glm_vec4 const DiffZ = _mm_sub_ps(R[1], R[3]);
+
+				glm_vec4 const CaseXY = _mm_cmplt_ps(R22, Zero);
+				glm_vec4 const CaseX = _mm_cmpgt_ps(R00, R11);
+				glm_vec4 const CaseZ = _mm_cmplt_ps(R00, _mm_xor_ps(R11, SignMask));
+
+				glm_vec4 const TraceX = _mm_sub_ps(_mm_sub_ps(_mm_add_ps(One, R00), R11), R22);
+				glm_vec4 const TraceY = _mm_sub_ps(_mm_add_ps(_mm_sub_ps(One, R00), R11), R22);
+				glm_vec4 const TraceZ = _mm_add_ps(_mm_sub_ps(_mm_sub_ps(One, R00), R11), R22);
+				glm_vec4 const TraceW = _mm_add_ps(_mm_add_ps(_mm_add_ps(One, R00), R11), R22);
+
+				glm_vec4 const T = glm_vec4_select(CaseXY, glm_vec4_select(CaseX, TraceX, TraceY), glm_vec4_select(CaseZ, TraceZ, TraceW));
+				glm_vec4 const Qx = glm_vec4_select(CaseXY, glm_vec4_select(CaseX, T, SumXY), glm_vec4_select(CaseZ, SumXZ, DiffX));
+				glm_vec4 const Qy = glm_vec4_select(CaseXY, glm_vec4_select(CaseX, SumXY, T), glm_vec4_select(CaseZ, SumYZ, DiffY));
+				glm_vec4 const Qz = glm_vec4_select(CaseXY, glm_vec4_select(CaseX, SumXZ, SumYZ), glm_vec4_select(CaseZ, T, DiffZ));
+				glm_vec4 const Qw = glm_vec4_select(CaseXY, glm_vec4_select(CaseX, DiffX, DiffY), glm_vec4_select(CaseZ, DiffZ, T));
+
+				glm_vec4 const Factor = _mm_div_ps(Half, _mm_sqrt_ps(T));
+				_mm_storeu_ps(rx + i, _mm_mul_ps(Qx, Factor));
+				_mm_storeu_ps(ry + i, _mm_mul_ps(Qy, Factor));
+				_mm_storeu_ps(rz + i, _mm_mul_ps(Qz, Factor));
+				_mm_storeu_ps(rw + i, _mm_mul_ps(Qw, Factor));
+
+				int const Mask = _mm_movemask_ps(Regular);
+				Decomposed += static_cast<std::size_t>((Mask & 1) + ((Mask >> 1) & 1) + ((Mask >> 2) & 1) + ((Mask >> 3) & 1));
+			}
+
+			return Decomposed + compute_decompose<float, Q, false>::affine(m, i, count, tx, ty, tz, rx, ry, rz, rw, sx, sy, sz);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -9,11 +9,18 @@
 /// Include <glm/gtx/matrix_factorisation.hpp> to use the features of this extension.
 ///
 /// Functions to factor matrices in various forms
+///
+/// The 3x3 SVD, polar and symmetric eigen decompositions are branch free. Their batch versions and the batch system solvers
+/// process four or eight matrices at once for float with GLM_FORCE_INTRINSICS, depending on SSE2 or AVX support,
+/// the system solvers then pivot without branches.
 
 #pragma once
 
 // Dependency:
+#include <cstddef>
+#include <limits>
 #include "../glm.hpp"
+#include "../detail/compute_lane.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -26,7 +33,7 @@
 /*
 Suggestions:
  - Move helper functions flipud and fliplr to another file: They may be helpful in more general circumstances.
- - Implement other types of matrix factorisation, such as: QL and LQ, L(D)U, eigendecompositions, etc...
+ - Implement other types of matrix factorisation, such as: QL and LQ, LDLt, etc...
 */
 
 namespace glm
@@ -49,6 +56,7 @@ namespace glm
 	/// Performs QR factorisation of a matrix.
 	/// Returns 2 matrices, q and r, such that the columns of q are orthonormal and span the same subspace than those of the input matrix, r is an upper triangular matrix, and q*r=in.
 	/// Given an n-by-m input matrix, q has dimensions min(n,m)-by-m, and r has dimensions n-by-min(n,m).
+	/// Uses Householder reflections, the diagonal of r is non negative.
 	///
 	/// From GLM_GTX_matrix_factorisation extension.
 	template <length_t C, length_t R, typename T, qualifier Q>
@@ -63,6 +71,101 @@ namespace glm
 	template <length_t C, length_t R, typename T, qualifier Q>
 	GLM_FUNC_DECL void rq_decompose(mat<C, R, T, Q> const& in, mat<(C < R ? C : R), R, T, Q>& r, mat<C, (C < R ? C : R), T, Q>& q);
 
+	/// Performs the LU factorisation with partial pivoting of a square matrix.
+	/// Returns lu holding the strictly lower triangle of the unit lower triangular matrix l and the upper triangular matrix u,
+	/// such that l*u is the input with the rows k and pivots[k] swapped in increasing order of k.
+	/// Returns false when the input is singular, a null pivot is then left in lu.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL bool lu_decompose(mat<C, C, T, Q> const& in, mat<C, C, T, Q>& lu, vec<C, int, Q>& pivots);
+
+	/// Solves in*x=b with the LU factorisation of in returned by lu_decompose.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<C, T, Q> lu_solve(mat<C, C, T, Q> const& lu, vec<C, int, Q> const& pivots, vec<C, T, Q> const& b);
+
+	/// Performs the Cholesky factorisation of a symmetric positive definite matrix.
+	/// Returns the lower triangular matrix l with a positive diagonal such that l*transpose(l)=in, only the lower triangle of the input is read.
+	/// Returns false when the input is not positive definite, l is then unspecified.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL bool cholesky(mat<C, C, T, Q> const& in, mat<C, C, T, Q>& l);
+
+	/// Solves l*transpose(l)*x=b with the Cholesky factor l returned by cholesky.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<C, T, Q> cholesky_solve(mat<C, C, T, Q> const& l, vec<C, T, Q> const& b);
+
+	/// Solves a*x=b by Gaussian elimination with partial pivoting, more accurate than inverse(a)*b on ill conditioned systems.
+	/// A single system is not faster than inverse(a)*b, use the batch overload for throughput.
+	/// The result is not finite when a is singular.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL vec<C, T, Q> solve(mat<C, C, T, Q> const& a, vec<C, T, Q> const& b);
+
+	/// Solves a[i]*x[i]=b[i] for count systems.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL void solve(mat<C, C, T, Q> const* a, vec<C, T, Q> const* b, std::size_t count, vec<C, T, Q>* x);
+
+	/// Performs the Cholesky factorisation of count symmetric matrices.
+	/// Returns the number of positive definite matrices, l is unspecified for the others.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <length_t C, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t cholesky(mat<C, C, T, Q> const* in, std::size_t count, mat<C, C, T, Q>* l);
+
+	/// Performs the singular value decomposition of a 3x3 matrix.
+	/// Returns u, s and v such that u and v are rotations and u*diagonal3x3(s)*transpose(v)=in.
+	/// The singular values are sorted by decreasing magnitude, s.z is negative when the determinant of the input is negative.
+	/// Uses the Jacobi eigenanalysis of transpose(in)*in and Givens QR without branches of McAdams et al., "Computing the Singular Value Decomposition of 3x3 matrices with minimal branching and elementary floating point operations".
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DECL void svd_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& u, vec<3, T, Q>& s, mat<3, 3, T, Q>& v);
+
+	/// Performs the polar decomposition of a 3x3 matrix.
+	/// Returns r and s such that r is the closest rotation to the input, s is symmetric and r*s=in.
+	/// s has a negative eigenvalue when the determinant of the input is negative.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DECL void polar_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& s);
+
+	/// Performs the singular value decomposition of count 3x3 matrices.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DECL void svd_decompose(mat<3, 3, T, Q> const* in, std::size_t count, mat<3, 3, T, Q>* u, vec<3, T, Q>* s, mat<3, 3, T, Q>* v);
+
+	/// Performs the polar decomposition of count 3x3 matrices.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DECL void polar_decompose(mat<3, 3, T, Q> const* in, std::size_t count, mat<3, 3, T, Q>* r, mat<3, 3, T, Q>* s);
+
+	/// Performs the eigendecomposition of a symmetric 3x3 matrix, for instance a covariance matrix.
+	/// Returns values and vectors such that vectors is a rotation and vectors*diagonal3x3(values)*transpose(vectors)=in.
+	/// The eigenvalues are sorted in decreasing order, so the last column of vectors is the normal of a covariance matrix of points.
+	/// Only the lower triangle of the input is read.
+	/// The analytic eigenvalues give the eigenvector of the most isolated one, Jacobi rotations then diagonalize the remaining block.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DECL void eigen_decompose_symmetric(mat<3, 3, T, Q> const& in, vec<3, T, Q>& values, mat<3, 3, T, Q>& vectors);
+
+	/// Performs the eigendecomposition of count symmetric 3x3 matrices.
+	///
+	/// From GLM_GTX_matrix_factorisation extension.
+	template <typename T, qualifier Q>
+	GLM_FUNC_DECL void eigen_decompose_symmetric(mat<3, 3, T, Q> const* in, std::size_t count, vec<3, T, Q>* values, mat<3, 3, T, Q>* vectors);
+
 	/// @}
 }
 
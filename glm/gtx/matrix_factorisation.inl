@@ -1,7 +1,679 @@
 /// @ref gtx_matrix_factorisation
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	// cos(acos(x) / 3) for x in [-1, 1]
+	template<typename T>
+	GLM_FUNC_QUALIFIER T lane_cos_third_acos(T x)
+	{
+		return cos(acos(x) / static_cast<T>(3));
+	}
+
+	// Number of Jacobi sweeps of the 3x3 SVD, the largest reconstruction error of random matrices reaches the float precision
+	// after five sweeps and the double precision after six, while it is still about 1e-2 after the four sweeps of the paper
+	template<typename T>
+	struct svd_sweeps
+	{
+		static int const value = sizeof(T) > 4 ? 6 : 5;
+	};
+
+	// Conjugate the symmetric matrix s by the Givens rotation of the plane of its first two rows and accumulate the rotation in the quaternion q.
+	// The rows of s are then rotated, so that the three conjugations of a sweep visit the planes (0, 1), (1, 2) and (2, 0) with x, y, z equal to 0, 1, 2 then 1, 2, 0 then 2, 0, 1.
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void svd_jacobi_conjugation(int x, int y, int z, V& s11, V& s21, V& s22, V& s31, V& s32, V& s33, V q[4])
+	{
+		V const Gamma(5.82842712474619);
+		V const CosPi8(0.9238795325112867);
+		V const SinPi8(0.3826834323650898);
+		V const Two(2);
+
+		// Off diagonal elements negligible against the diagonal are flushed to zero, otherwise the products of converged elements
+		// become denormals and slow down the following sweeps by an order of magnitude
+		V const Epsilon(std::numeric_limits<T>::epsilon());
+		s21 = lane_select(Epsilon * Epsilon * s11 * s22 < s21 * s21, s21, V(0));
+
+		// Approximate Givens quaternion: the half angle is pi / 8 when the exact rotation would be larger
+		V const c = Two * (s11 - s22);
+		V const w = lane_rsqrt(c * c + s21 * s21);
+		V const ch = lane_select(Gamma * s21 * s21 < c * c, w * c, CosPi8);
+		V sh = lane_select(Gamma * s21 * s21 < c * c, w * s21, SinPi8);
+
+		V const a = ch * ch - sh * sh;
+		V const b = Two * sh * ch;
+		V const t11 = s11, t21 = s21, t22 = s22, t31 = s31, t32 = s32, t33 = s33;
+		s11 = a * (a * t11 + b * t21) + b * (a * t21 + b * t22);
+		s21 = a * (a * t21 - b * t11) + b * (a * t22 - b * t21);
+		s22 = a * (a * t22 - b * t21) - b * (a * t21 - b * t11);
+		s31 = a * t31 + b * t32;
+		s32 = a * t32 - b * t31;
+
+		V const t[3] = {q[0] * sh, q[1] * sh, q[2] * sh};
+		sh = sh * q[3];
+		q[0] = q[0] * ch;
+		q[1] = q[1] * ch;
+		q[2] = q[2] * ch;
+		q[3] = q[3] * ch;
+		q[z] = q[z] + sh;
+		q[3] = q[3] - t[z];
+		q[x] = q[x] + t[y];
+		q[y] = q[y] - t[x];
+
+		V const u11 = s22, u21 = s32, u22 = t33, u31 = s21, u32 = s31, u33 = s11;
+		s11 = u11; s21 = u21; s22 = u22; s31 = u31; s32 = u32; s33 = u33;
+	}
+
+	// Swap the columns x and y when c is true, negating one of them to keep the determinant
+	template<typename M, typename V>
+	GLM_FUNC_QUALIFIER void lane_swap_columns(M const& c, V x[3], V y[3])
+	{
+		for(int i = 0; i < 3; ++i)
+		{
+			V const t = -x[i];
+			x[i] = lane_select(c, y[i], x[i]);
+			y[i] = lane_select(c, t, y[i]);
+		}
+	}
+
+	// Swap the rows i and j of a and b when c is true, from the column k on
+	template<length_t N, typename M, typename V>
+	GLM_FUNC_QUALIFIER void lane_swap_rows(M const& c, length_t k, length_t i, V a[N][N], V b[N])
+	{
+		for(length_t j = k; j < N; ++j)
+		{
+			V const t = a[j][k];
+			a[j][k] = lane_select(c, a[j][i], t);
+			a[j][i] = lane_select(c, t, a[j][i]);
+		}
+		V const t = b[k];
+		b[k] = lane_select(c, b[i], t);
+		b[i] = lane_select(c, t, b[i]);
+	}
+
+	// Number of matrices of [first, count) with a positive diagonal, NaN is not positive
+	template<length_t N, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t count_positive_diagonals(mat<N, N, T, Q> const* m, std::size_t first, std::size_t count)
+	{
+		std::size_t Positive = 0;
+		for(std::size_t i = first; i < count; ++i)
+		{
+			bool Result = true;
+			for(length_t k = 0; k < N; ++k)
+				Result = Result && m[i][k][k] > static_cast<T>(0);
+			Positive += Result ? 1 : 0;
+		}
+		return Positive;
+	}
+
+	// Givens quaternion annihilating a2 against the pivot a1
+	template<typename V>
+	GLM_FUNC_QUALIFIER void svd_qr_givens(V const& a1, V const& a2, V& ch, V& sh)
+	{
+		// Square root of the smallest normal float, so that squares do not underflow
+		V const Tiny(1.0842021724855044e-19);
+		V const Zero(0);
+
+		V const rho = lane_sqrt(a1 * a1 + a2 * a2);
+		V const s = lane_select(rho > Tiny, a2, Zero);
+		V const c = lane_abs(a1) + lane_max(rho, Tiny);
+		ch = lane_select(a1 < Zero, s, c);
+		sh = lane_select(a1 < Zero, c, s);
+
+		V const w = lane_rsqrt(ch * ch + sh * sh);
+		ch = ch * w;
+		sh = sh * w;
+	}
+
+	// Branch free 3x3 SVD, a = u * diagonal(s) * transpose(v), of "Computing the Singular Value Decomposition of 3x3 matrices
+	// with minimal branching and elementary floating point operations", McAdams et al. 2011.
+	// Matrices are arrays of columns, V is a scalar or the SIMD lanes of several matrices.
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void svd3x3(V const a[3][3], V u[3][3], V s[3], V v[3][3])
+	{
+		V const One(1);
+		V const Two(2);
+
+		// Symmetric eigenanalysis of transpose(a) * a with Jacobi sweeps
+		V s11 = a[0][0] * a[0][0] + a[0][1] * a[0][1] + a[0][2] * a[0][2];
+		V s21 = a[1][0] * a[0][0] + a[1][1] * a[0][1] + a[1][2] * a[0][2];
+		V s22 = a[1][0] * a[1][0] + a[1][1] * a[1][1] + a[1][2] * a[1][2];
+		V s31 = a[2][0] * a[0][0] + a[2][1] * a[0][1] + a[2][2] * a[0][2];
+		V s32 = a[2][0] * a[1][0] + a[2][1] * a[1][1] + a[2][2] * a[1][2];
+		V s33 = a[2][0] * a[2][0] + a[2][1] * a[2][1] + a[2][2] * a[2][2];
+
+		V q[4] = {V(0), V(0), V(0), One};
+		for(int i = 0; i < svd_sweeps<T>::value; ++i)
+		{
+			svd_jacobi_conjugation<T>(0, 1, 2, s11, s21, s22, s31, s32, s33, q);
+			svd_jacobi_conjugation<T>(1, 2, 0, s11, s21, s22, s31, s32, s33, q);
+			svd_jacobi_conjugation<T>(2, 0, 1, s11, s21, s22, s31, s32, s33, q);
+		}
+
+		// Renormalize the quaternion, the inverse square roots of the SIMD lanes are approximations
+		V const Norm = lane_rsqrt(q[0] * q[0] + q[1] * q[1] + q[2] * q[2] + q[3] * q[3]);
+		for(int i = 0; i < 4; ++i)
+			q[i] = q[i] * Norm;
+
+		V const qxx = q[0] * q[0], qyy = q[1] * q[1], qzz = q[2] * q[2];
+		V const qxy = q[0] * q[1], qxz = q[0] * q[2], qyz = q[1] * q[2];
+		V const qwx = q[3] * q[0], qwy = q[3] * q[1], qwz = q[3] * q[2];
+		v[0][0] = One - Two * (qyy + qzz);
+		v[0][1] = Two * (qxy + qwz);
+		v[0][2] = Two * (qxz - qwy);
+		v[1][0] = Two * (qxy - qwz);
+		v[1][1] = One - Two * (qxx + qzz);
+		v[1][2] = Two * (qyz + qwx);
+		v[2][0] = Two * (qxz + qwy);
+		v[2][1] = Two * (qyz - qwx);
+		v[2][2] = One - Two * (qxx + qyy);
+
+		// b = a * v, columns sorted by decreasing length
+		V b[3][3];
+		for(int c = 0; c < 3; ++c)
+		for(int r = 0; r < 3; ++r)
+			b[c][r] = a[0][r] * v[c][0] + a[1][r] * v[c][1] + a[2][r] * v[c][2];
+
+		V rho[3];
+		for(int c = 0; c < 3; ++c)
+			rho[c] = b[c][0] * b[c][0] + b[c][1] * b[c][1] + b[c][2] * b[c][2];
+
+		lane_swap_columns(rho[0] < rho[1], b[0], b[1]);
+		lane_swap_columns(rho[0] < rho[1], v[0], v[1]);
+		V const rho0 = rho[0];
+		rho[0] = lane_select(rho0 < rho[1], rho[1], rho0);
+		rho[1] = lane_select(rho0 < rho[1], rho0, rho[1]);
+		lane_swap_columns(rho[0] < rho[2], b[0], b[2]);
+		lane_swap_columns(rho[0] < rho[2], v[0], v[2]);
+		rho[2] = lane_select(rho[0] < rho[2], rho[0], rho[2]);
+		lane_swap_columns(rho[1] < rho[2], b[1], b[2]);
+		lane_swap_columns(rho[1] < rho[2], v[1], v[2]);
+
+		// QR decomposition of b with three Givens rotations of cosine c and sine s, r is diagonal up to rounding
+		V ch, sh;
+
+		svd_qr_givens(b[0][0], b[0][1], ch, sh);
+		V const c1 = One - Two * sh * sh;
+		V const s1 = Two * ch * sh;
+		V r[3][3];
+		for(int c = 0; c < 3; ++c)
+		{
+			r[c][0] = c1 * b[c][0] + s1 * b[c][1];
+			r[c][1] = c1 * b[c][1] - s1 * b[c][0];
+			r[c][2] = b[c][2];
+		}
+
+		svd_qr_givens(r[0][0], r[0][2], ch, sh);
+		V const c2 = One - Two * sh * sh;
+		V const s2 = Two * ch * sh;
+		for(int c = 1; c < 3; ++c)
+		{
+			b[c][0] = c2 * r[c][0] + s2 * r[c][2];
+			b[c][1] = r[c][1];
+			b[c][2] = c2 * r[c][2] - s2 * r[c][0];
+		}
+
+		svd_qr_givens(b[1][1], b[1][2], ch, sh);
+		V const c3 = One - Two * sh * sh;
+		V const s3 = Two * ch * sh;
+		s[0] = c2 * r[0][0] + s2 * r[0][2];
+		s[1] = c3 * b[1][1] + s3 * b[1][2];
+		s[2] = c3 * b[2][2] - s3 * b[2][1];
+
+		// u is the product of the three rotations
+		u[0][0] = c1 * c2;
+		u[0][1] = s1 * c2;
+		u[0][2] = s2;
+		u[1][0] = -s1 * c3 - c1 * s2 * s3;
+		u[1][1] = c1 * c3 - s1 * s2 * s3;
+		u[1][2] = c2 * s3;
+		u[2][0] = s1 * s3 - c1 * s2 * c3;
+		u[2][1] = -c1 * s3 - s1 * s2 * c3;
+		u[2][2] = c2 * c3;
+	}
+
+	// Polar decomposition a = r * s from the SVD: r = u * transpose(v) and s = v * diagonal(sigma) * transpose(v)
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void polar3x3(V const a[3][3], V r[3][3], V s[3][3])
+	{
+		V u[3][3], sigma[3], v[3][3];
+		svd3x3<T>(a, u, sigma, v);
+
+		for(int c = 0; c < 3; ++c)
+		for(int i = 0; i < 3; ++i)
+		{
+			r[c][i] = u[0][i] * v[0][c] + u[1][i] * v[1][c] + u[2][i] * v[2][c];
+			s[c][i] = v[0][i] * sigma[0] * v[0][c] + v[1][i] * sigma[1] * v[1][c] + v[2][i] * sigma[2] * v[2][c];
+		}
+	}
+
+	// Number of Jacobi sweeps refining the analytic eigenvectors of a symmetric 3x3 matrix
+	template<typename T>
+	struct eigen_sweeps
+	{
+		static int const value = sizeof(T) > 4 ? 3 : 2;
+	};
+
+	// Conjugate the symmetric matrix d by the Jacobi rotation annihilating d[q][p] and accumulate the rotation in the columns of v
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void eigen_jacobi_rotation(int p, int q, V d[3][3], V v[3][3])
+	{
+		V const Zero(0);
+		V const One(1);
+		V const Half(0.5);
+		V const Two(2);
+		V const Epsilon(std::numeric_limits<T>::epsilon());
+		V const Tiny(std::numeric_limits<T>::min());
+
+		// Negligible elements are not rotated, so that converged elements do not become denormals
+		V const dpq = lane_select(Epsilon * (lane_abs(d[p][p]) + lane_abs(d[q][q])) < lane_abs(d[q][p]), d[q][p], Zero);
+		V const dpp_qq = d[p][p] - d[q][q];
+
+		// Cosine and sine of twice the rotation angle, in [-pi / 4, pi / 4]
+		V const r2 = dpp_qq * dpp_qq + Two * Two * dpq * dpq;
+		V const InverseR = lane_rsqrt(lane_max(r2, Tiny));
+		V const Cos2 = lane_select(Tiny < r2, lane_abs(dpp_qq) * InverseR, One);
+		V const Sin2 = lane_select(Tiny < r2, lane_select(dpp_qq < Zero, Two * dpq, -Two * dpq) * InverseR, Zero);
+		V const h = Half + Half * Cos2;
+		V const InverseH = lane_rsqrt(h);
+		V const c = h * InverseH;
+		V const s = Half * Sin2 * InverseH;
+
+		// The columns become c * p - s * q and s * p + c * q, then the rows
+		for(int k = 0; k < 3; ++k)
+		{
+			V const dp = d[p][k], dq = d[q][k];
+			d[p][k] = c * dp - s * dq;
+			d[q][k] = s * dp + c * dq;
+		}
+		for(int k = 0; k < 3; ++k)
+		{
+			V const dp = d[k][p], dq = d[k][q];
+			d[k][p] = c * dp - s * dq;
+			d[k][q] = s * dp + c * dq;
+		}
+		for(int k = 0; k < 3; ++k)
+		{
+			V const vp = v[p][k], vq = v[q][k];
+			v[p][k] = c * vp - s * vq;
+			v[q][k] = s * vp + c * vq;
+		}
+	}
+
+	// Eigendecomposition of a symmetric 3x3 matrix, a = vectors * diagonal(values) * transpose(vectors).
+	// The eigenvalues of the characteristic polynomial give the eigenvector of the most isolated eigenvalue, completed by an orthonormal basis,
+	// then Jacobi rotations diagonalize the remaining 2x2 block and refine the result.
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void eigen3x3(V const a[3][3], V values[3], V vectors[3][3])
+	{
+		V const Zero(0);
+		V const One(1);
+		V const Two(2);
+		V const Third(1.0 / 3.0);
+		V const Tiny(std::numeric_limits<T>::min());
+
+		V const a00 = a[0][0], a11 = a[1][1], a22 = a[2][2];
+		V const a01 = a[0][1], a02 = a[0][2], a12 = a[1][2];
+
+		// Trigonometric solution of Smith, "Eigenvalues of a symmetric 3 x 3 matrix", with B = (a - q * I) / p
+		V const q = (a00 + a11 + a22) * Third;
+		V const b00 = a00 - q, b11 = a11 - q, b22 = a22 - q;
+		V const p = lane_sqrt((b00 * b00 + b11 * b11 + b22 * b22 + Two * (a01 * a01 + a02 * a02 + a12 * a12)) * V(1.0 / 6.0));
+		V const DeterminantB = b00 * (b11 * b22 - a12 * a12) - a01 * (a01 * b22 - a12 * a02) + a02 * (a01 * a12 - b11 * a02);
+		V const p3 = p * p * p;
+		V const r = lane_select(Tiny < p3, lane_max(-One, lane_min(One, DeterminantB / (Two * lane_max(p3, Tiny)))), Zero);
+		V const CosPhi = lane_cos_third_acos(r);
+		V const SinPhi = lane_sqrt(lane_max(Zero, One - CosPhi * CosPhi));
+		V const Largest = q + Two * p * CosPhi;
+		V const Smallest = q - p * (CosPhi + V(1.7320508075688772) * SinPhi);
+		V const Middle = V(3) * q - Largest - Smallest;
+		V const Lambda = lane_select(Middle - Smallest < Largest - Middle, Largest, Smallest);
+
+		// Its eigenvector is the largest cross product of two rows of a - Lambda * I
+		V const r0[3] = {a00 - Lambda, a01, a02};
+		V const r1[3] = {a01, a11 - Lambda, a12};
+		V const r2[3] = {a02, a12, a22 - Lambda};
+		V const c01[3] = {r0[1] * r1[2] - r0[2] * r1[1], r0[2] * r1[0] - r0[0] * r1[2], r0[0] * r1[1] - r0[1] * r1[0]};
+		V const c02[3] = {r0[1] * r2[2] - r0[2] * r2[1], r0[2] * r2[0] - r0[0] * r2[2], r0[0] * r2[1] - r0[1] * r2[0]};
+		V const c12[3] = {r1[1] * r2[2] - r1[2] * r2[1], r1[2] * r2[0] - r1[0] * r2[2], r1[0] * r2[1] - r1[1] * r2[0]};
+		V const n01 = c01[0] * c01[0] + c01[1] * c01[1] + c01[2] * c01[2];
+		V const n02 = c02[0] * c02[0] + c02[1] * c02[1] + c02[2] * c02[2];
+		V const n12 = c12[0] * c12[0] + c12[1] * c12[1] + c12[2] * c12[2];
+		V const n = lane_max(n01, lane_max(n02, n12));
+		V const Scale = lane_rsqrt(lane_max(n, Tiny));
+
+		// Any vector is an eigenvector of a multiple of the identity
+		V e[3];
+		for(int i = 0; i < 3; ++i)
+		{
+			V const c = lane_select(n01 < n02, lane_select(n02 < n12, c12[i], c02[i]), lane_select(n01 < n12, c12[i], c01[i]));
+			e[i] = lane_select(Tiny < n, c * Scale, i == 0 ? One : Zero);
+		}
+
+		// Orthonormal basis of Duff et al., "Building an Orthonormal Basis, Revisited"
+		V const Sign = lane_select(e[2] < Zero, -One, One);
+		V const ba = -One / (Sign + e[2]);
+		V const bb = e[0] * e[1] * ba;
+		vectors[0][0] = e[0];
+		vectors[0][1] = e[1];
+		vectors[0][2] = e[2];
+		vectors[1][0] = One + Sign * e[0] * e[0] * ba;
+		vectors[1][1] = Sign * bb;
+		vectors[1][2] = -Sign * e[0];
+		vectors[2][0] = bb;
+		vectors[2][1] = Sign + e[1] * e[1] * ba;
+		vectors[2][2] = -e[1];
+
+		// d = transpose(vectors) * a * vectors
+		V d[3][3];
+		for(int j = 0; j < 3; ++j)
+		{
+			V const av[3] = {
+				a00 * vectors[j][0] + a01 * vectors[j][1] + a02 * vectors[j][2],
+				a01 * vectors[j][0] + a11 * vectors[j][1] + a12 * vectors[j][2],
+				a02 * vectors[j][0] + a12 * vectors[j][1] + a22 * vectors[j][2]};
+			for(int i = 0; i < 3; ++i)
+				d[j][i] = vectors[i][0] * av[0] + vectors[i][1] * av[1] + vectors[i][2] * av[2];
+		}
+
+		for(int i = 0; i < eigen_sweeps<T>::value; ++i)
+		{
+			eigen_jacobi_rotation<T>(1, 2, d, vectors);
+			eigen_jacobi_rotation<T>(0, 1, d, vectors);
+			eigen_jacobi_rotation<T>(0, 2, d, vectors);
+		}
+
+		// Decreasing eigenvalues, the swapped eigenvectors are negated to keep a rotation
+		for(int i = 0; i < 3; ++i)
+			values[i] = d[i][i];
+		for(int i = 0; i < 3; ++i)
+		for(int j = i + 1; j < 3; ++j)
+		{
+			V const vi = values[i];
+			lane_swap_columns(vi < values[j], vectors[i], vectors[j]);
+			values[i] = lane_max(vi, values[j]);
+			values[j] = lane_min(vi, values[j]);
+		}
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_eigen_symmetric
+	{
+		// Decompose the matrices [first, count)
+		GLM_FUNC_QUALIFIER static void call(mat<3, 3, T, Q> const* in, std::size_t first, std::size_t count, vec<3, T, Q>* values, mat<3, 3, T, Q>* vectors)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				T a[3][3], Values[3], Vectors[3][3];
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					a[c][r] = in[i][c][r];
+
+				eigen3x3<T>(a, Values, Vectors);
+
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					vectors[i][c][r] = Vectors[c][r];
+				values[i] = vec<3, T, Q>(Values[0], Values[1], Values[2]);
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_svd
+	{
+		// Decompose the matrices [first, count)
+		GLM_FUNC_QUALIFIER static void svd(mat<3, 3, T, Q> const* in, std::size_t first, std::size_t count, mat<3, 3, T, Q>* u, vec<3, T, Q>* s, mat<3, 3, T, Q>* v)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				T a[3][3], U[3][3], S[3], W[3][3];
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					a[c][r] = in[i][c][r];
+
+				svd3x3<T>(a, U, S, W);
+
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+				{
+					u[i][c][r] = U[c][r];
+					v[i][c][r] = W[c][r];
+				}
+				s[i] = vec<3, T, Q>(S[0], S[1], S[2]);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void polar(mat<3, 3, T, Q> const* in, std::size_t first, std::size_t count, mat<3, 3, T, Q>* r, mat<3, 3, T, Q>* s)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				T a[3][3], R[3][3], S[3][3];
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t j = 0; j < 3; ++j)
+					a[c][j] = in[i][c][j];
+
+				polar3x3<T>(a, R, S);
+
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t j = 0; j < 3; ++j)
+				{
+					r[i][c][j] = R[c][j];
+					s[i][c][j] = S[c][j];
+				}
+			}
+		}
+	};
+
+	// Subtract the multiple of the pivot row k annihilating a[k][i] from the row i, from the column k + 1 on
+	template<length_t N, typename V>
+	GLM_FUNC_QUALIFIER void lane_eliminate_row(length_t k, length_t i, V const& InversePivot, V a[N][N], V b[N])
+	{
+		V const f = a[k][i] * InversePivot;
+		for(length_t c = k + 1; c < N; ++c)
+			a[c][i] = a[c][i] - f * a[c][k];
+		b[i] = b[i] - f * b[k];
+	}
+
+	// Component k of the solution of the upper triangular system, the components after k are known
+	template<length_t N, typename V>
+	GLM_FUNC_QUALIFIER void lane_back_substitute(length_t k, V const& InversePivot, V const a[N][N], V const b[N], V x[N])
+	{
+		V Sum = b[k];
+		for(length_t c = k + 1; c < N; ++c)
+			Sum = Sum - a[c][k] * x[c];
+		x[k] = Sum * InversePivot;
+	}
+
+	// Swap the row i into the pivot row k when its element in the column k is larger.
+	// The SIMD lanes swap with selects, a single system branches since its pivot rarely moves.
+	template<bool Branch>
+	struct pivot_row
+	{
+		template<length_t N, typename V>
+		GLM_FUNC_QUALIFIER static void call(length_t k, length_t i, V a[N][N], V b[N])
+		{
+			lane_swap_rows<N>(lane_abs(a[k][k]) < lane_abs(a[k][i]), k, i, a, b);
+		}
+	};
+
+	template<>
+	struct pivot_row<true>
+	{
+		template<length_t N, typename V>
+		GLM_FUNC_QUALIFIER static void call(length_t k, length_t i, V a[N][N], V b[N])
+		{
+			if(!(lane_abs(a[k][k]) < lane_abs(a[k][i])))
+				return;
+			for(length_t j = k; j < N; ++j)
+			{
+				V const t = a[j][k];
+				a[j][k] = a[j][i];
+				a[j][i] = t;
+			}
+			V const t = b[k];
+			b[k] = b[i];
+			b[i] = t;
+		}
+	};
+
+	template<length_t N, bool Branch, typename V>
+	GLM_FUNC_QUALIFIER void lane_pivot_row(length_t k, length_t i, V a[N][N], V b[N])
+	{
+		pivot_row<Branch>::template call<N>(k, i, a, b);
+	}
+
+	// Solve a * x = b by Gaussian elimination with partial pivoting, a and b are overwritten.
+	// The steps are written for each size so that the nested loops are unrolled.
+	template<typename T, bool Branch, typename V>
+	GLM_FUNC_QUALIFIER void solve_lanes(V a[2][2], V b[2], V x[2])
+	{
+		lane_pivot_row<2, Branch>(0, 1, a, b);
+		V const p0 = V(1) / a[0][0];
+		lane_eliminate_row<2>(0, 1, p0, a, b);
+		V const p1 = V(1) / a[1][1];
+
+		lane_back_substitute<2>(1, p1, a, b, x);
+		lane_back_substitute<2>(0, p0, a, b, x);
+	}
+
+	template<typename T, bool Branch, typename V>
+	GLM_FUNC_QUALIFIER void solve_lanes(V a[3][3], V b[3], V x[3])
+	{
+		lane_pivot_row<3, Branch>(0, 1, a, b);
+		lane_pivot_row<3, Branch>(0, 2, a, b);
+		V const p0 = V(1) / a[0][0];
+		lane_eliminate_row<3>(0, 1, p0, a, b);
+		lane_eliminate_row<3>(0, 2, p0, a, b);
+		lane_pivot_row<3, Branch>(1, 2, a, b);
+		V const p1 = V(1) / a[1][1];
+		lane_eliminate_row<3>(1, 2, p1, a, b);
+		V const p2 = V(1) / a[2][2];
+
+		lane_back_substitute<3>(2, p2, a, b, x);
+		lane_back_substitute<3>(1, p1, a, b, x);
+		lane_back_substitute<3>(0, p0, a, b, x);
+	}
+
+	template<typename T, bool Branch, typename V>
+	GLM_FUNC_QUALIFIER void solve_lanes(V a[4][4], V b[4], V x[4])
+	{
+		lane_pivot_row<4, Branch>(0, 1, a, b);
+		lane_pivot_row<4, Branch>(0, 2, a, b);
+		lane_pivot_row<4, Branch>(0, 3, a, b);
+		V const p0 = V(1) / a[0][0];
+		lane_eliminate_row<4>(0, 1, p0, a, b);
+		lane_eliminate_row<4>(0, 2, p0, a, b);
+		lane_eliminate_row<4>(0, 3, p0, a, b);
+		lane_pivot_row<4, Branch>(1, 2, a, b);
+		lane_pivot_row<4, Branch>(1, 3, a, b);
+		V const p1 = V(1) / a[1][1];
+		lane_eliminate_row<4>(1, 2, p1, a, b);
+		lane_eliminate_row<4>(1, 3, p1, a, b);
+		lane_pivot_row<4, Branch>(2, 3, a, b);
+		V const p2 = V(1) / a[2][2];
+		lane_eliminate_row<4>(2, 3, p2, a, b);
+		V const p3 = V(1) / a[3][3];
+
+		lane_back_substitute<4>(3, p3, a, b, x);
+		lane_back_substitute<4>(2, p2, a, b, x);
+		lane_back_substitute<4>(1, p1, a, b, x);
+		lane_back_substitute<4>(0, p0, a, b, x);
+	}
+
+	// Diagonal element j of the Cholesky factor l, the columns before j are known, returns its inverse.
+	// The diagonal of l is NaN when a is not positive definite.
+	template<length_t N, typename V>
+	GLM_FUNC_QUALIFIER V lane_cholesky_diagonal(length_t j, V const a[N][N], V l[N][N])
+	{
+		V d = a[j][j];
+		for(length_t k = 0; k < j; ++k)
+			d = d - l[k][j] * l[k][j];
+		V const InverseDiagonal = lane_rsqrt(d);
+		l[j][j] = d * InverseDiagonal;
+		for(length_t i = 0; i < j; ++i)
+			l[j][i] = V(0);
+		return InverseDiagonal;
+	}
+
+	template<length_t N, typename V>
+	GLM_FUNC_QUALIFIER void lane_cholesky_element(length_t j, length_t i, V const& InverseDiagonal, V const a[N][N], V l[N][N])
+	{
+		V Sum = a[j][i];
+		for(length_t k = 0; k < j; ++k)
+			Sum = Sum - l[k][i] * l[k][j];
+		l[j][i] = Sum * InverseDiagonal;
+	}
+
+	// Cholesky factor l of a symmetric matrix, only the lower triangle of a is read
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void cholesky_lanes(V const a[2][2], V l[2][2])
+	{
+		V const d0 = lane_cholesky_diagonal<2>(0, a, l);
+		lane_cholesky_element<2>(0, 1, d0, a, l);
+		lane_cholesky_diagonal<2>(1, a, l);
+	}
+
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void cholesky_lanes(V const a[3][3], V l[3][3])
+	{
+		V const d0 = lane_cholesky_diagonal<3>(0, a, l);
+		lane_cholesky_element<3>(0, 1, d0, a, l);
+		lane_cholesky_element<3>(0, 2, d0, a, l);
+		V const d1 = lane_cholesky_diagonal<3>(1, a, l);
+		lane_cholesky_element<3>(1, 2, d1, a, l);
+		lane_cholesky_diagonal<3>(2, a, l);
+	}
+
+	template<typename T, typename V>
+	GLM_FUNC_QUALIFIER void cholesky_lanes(V const a[4][4], V l[4][4])
+	{
+		V const d0 = lane_cholesky_diagonal<4>(0, a, l);
+		lane_cholesky_element<4>(0, 1, d0, a, l);
+		lane_cholesky_element<4>(0, 2, d0, a, l);
+		lane_cholesky_element<4>(0, 3, d0, a, l);
+		V const d1 = lane_cholesky_diagonal<4>(1, a, l);
+		lane_cholesky_element<4>(1, 2, d1, a, l);
+		lane_cholesky_element<4>(1, 3, d1, a, l);
+		V const d2 = lane_cholesky_diagonal<4>(2, a, l);
+		lane_cholesky_element<4>(2, 3, d2, a, l);
+		lane_cholesky_diagonal<4>(3, a, l);
+	}
+
+	template<length_t N, typename T, qualifier Q, bool UseSimd>
+	struct compute_solve
+	{
+		// Solve the systems [first, count) one at a time, with the branching pivot of solve
+		GLM_FUNC_QUALIFIER static void call(mat<N, N, T, Q> const* a, vec<N, T, Q> const* b, std::size_t first, std::size_t count, vec<N, T, Q>* x)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				x[i] = glm::solve(a[i], b[i]);
+		}
+	};
+
+	template<length_t N, typename T, qualifier Q, bool UseSimd>
+	struct compute_cholesky
+	{
+		// Decompose the matrices [first, count), returns the number of positive definite matrices
+		GLM_FUNC_QUALIFIER static std::size_t call(mat<N, N, T, Q> const* in, std::size_t first, std::size_t count, mat<N, N, T, Q>* l)
+		{
+			for(std::size_t i = first; i < count; ++i)
+			{
+				T A[N][N], L[N][N];
+				for(length_t c = 0; c < N; ++c)
+				for(length_t r = 0; r < N; ++r)
+					A[c][r] = in[i][c][r];
+
+				cholesky_lanes<T>(A, L);
+
+				for(length_t c = 0; c < N; ++c)
+				for(length_t r = 0; r < N; ++r)
+					l[i][c][r] = L[c][r];
+			}
+			return count_positive_diagonals(l, first, count);
+		}
+	};
+}//namespace detail
+
 	template <length_t C, length_t R, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER mat<C, R, T, Q> flipud(mat<C, R, T, Q> const& in)
 	{
@@ -27,35 +699,49 @@ namespace glm
 	template <length_t C, length_t R, typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER void qr_decompose(mat<C, R, T, Q> const& in, mat<(C < R ? C : R), R, T, Q>& q, mat<C, (C < R ? C : R), T, Q>& r)
 	{
-		// Uses modified Gram-Schmidt method
-		// Source: https://en.wikipedia.org/wiki/GramSchmidt_process
-		// And https://en.wikipedia.org/wiki/QR_decomposition
+		// Uses Householder reflections, which keep q orthonormal when the columns of the input are nearly dependent
+		// Source: https://en.wikipedia.org/wiki/QR_decomposition#Using_Householder_reflections
+		length_t const M = C < R ? C : R;
 
-		//For all the linearly independs columns of the input...
-		// (there can be no more linearly independents columns than there are rows.)
-		for (length_t i = 0; i < (C < R ? C : R); i++)
+		// The reflection k is I - 2 * v[k] * transpose(v[k]) / dot(v[k], v[k]), the rows of v[k] before k are zero
+		mat<C, R, T, Q> a(in);
+		vec<R, T, Q> v[M];
+		for (length_t k = 0; k < M; k++)
 		{
-			//Copy in Q the input's i-th column.
-			q[i] = in[i];
+			v[k] = a[k];
+			for (length_t i = 0; i < k; i++)
+				v[k][i] = static_cast<T>(0);
 
-			//j = [0,i[
-			// Make that column orthogonal to all the previous ones by substracting to it the non-orthogonal projection of all the previous columns.
-			// Also: Fill the zero elements of R
-			for (length_t j = 0; j < i; j++)
+			// Reflect the column onto -sign(a[k][k]) * e_k to avoid the cancellation in v[k][k]
+			T const Norm = length(v[k]);
+			v[k][k] += a[k][k] < static_cast<T>(0) ? -Norm : Norm;
+
+			T const Length2 = dot(v[k], v[k]);
+			if (Length2 > static_cast<T>(0))
 			{
-				q[i] -= dot(q[i], q[j])*q[j];
-				r[j][i] = 0;
+				v[k] /= sqrt(Length2);
+				for (length_t j = k; j < C; j++)
+					a[j] -= v[k] * (static_cast<T>(2) * dot(v[k], a[j]));
 			}
+		}
 
-			//Now, Q i-th column is orthogonal to all the previous columns. Normalize it.
-			q[i] = normalize(q[i]);
+		// Thin q is the product of the reflections applied to the first columns of the identity
+		for (length_t j = 0; j < M; j++)
+		{
+			q[j] = vec<R, T, Q>(static_cast<T>(0));
+			q[j][j] = static_cast<T>(1);
+			for (length_t k = j + 1; k-- > 0;)
+				q[j] -= v[k] * (static_cast<T>(2) * dot(v[k], q[j]));
+		}
 
-			//j = [i,C[
-			//Finally, compute the corresponding coefficients of R by computing the projection of the resulting column on the other columns of the input.
-			for (length_t j = i; j < C; j++)
-			{
-				r[j][i] = dot(in[j], q[i]);
-			}
+		// r is the upper triangle of the reflected input, rows are negated to get a non negative diagonal like Gram-Schmidt
+		for (length_t i = 0; i < M; i++)
+		{
+			bool const Negate = a[i][i] < static_cast<T>(0);
+			if (Negate)
+				q[i] = -q[i];
+			for (length_t j = 0; j < C; j++)
+				r[j][i] = j < i ? static_cast<T>(0) : (Negate ? -a[j][i] : a[j][i]);
 		}
 	}
 
@@ -81,4 +767,163 @@ namespace glm
 		tq = fliplr(tq);
 		q = transpose(tq);
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void svd_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& u, vec<3, T, Q>& s, mat<3, 3, T, Q>& v)
+	{
+		detail::compute_svd<T, Q, false>::svd(&in, 0, 1, &u, &s, &v);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void polar_decompose(mat<3, 3, T, Q> const& in, mat<3, 3, T, Q>& r, mat<3, 3, T, Q>& s)
+	{
+		detail::compute_svd<T, Q, false>::polar(&in, 0, 1, &r, &s);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void svd_decompose(mat<3, 3, T, Q> const* in, std::size_t count, mat<3, 3, T, Q>* u, vec<3, T, Q>* s, mat<3, 3, T, Q>* v)
+	{
+		detail::compute_svd<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::svd(in, 0, count, u, s, v);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void polar_decompose(mat<3, 3, T, Q> const* in, std::size_t count, mat<3, 3, T, Q>* r, mat<3, 3, T, Q>* s)
+	{
+		detail::compute_svd<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::polar(in, 0, count, r, s);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void eigen_decompose_symmetric(mat<3, 3, T, Q> const& in, vec<3, T, Q>& values, mat<3, 3, T, Q>& vectors)
+	{
+		detail::compute_eigen_symmetric<T, Q, false>::call(&in, 0, 1, &values, &vectors);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void eigen_decompose_symmetric(mat<3, 3, T, Q> const* in, std::size_t count, vec<3, T, Q>* values, mat<3, 3, T, Q>* vectors)
+	{
+		detail::compute_eigen_symmetric<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, 0, count, values, vectors);
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool lu_decompose(mat<C, C, T, Q> const& in, mat<C, C, T, Q>& lu, vec<C, int, Q>& pivots)
+	{
+		bool Regular = true;
+		lu = in;
+		for(length_t k = 0; k < C; ++k)
+		{
+			length_t Pivot = k;
+			for(length_t i = k + 1; i < C; ++i)
+				if(abs(lu[k][i]) > abs(lu[k][Pivot]))
+					Pivot = i;
+			pivots[k] = static_cast<int>(Pivot);
+
+			if(Pivot != k)
+				for(length_t c = 0; c < C; ++c)
+				{
+					T const t = lu[c][k];
+					lu[c][k] = lu[c][Pivot];
+					lu[c][Pivot] = t;
+				}
+
+			if(lu[k][k] == static_cast<T>(0))
+			{
+				Regular = false;
+				continue;
+			}
+
+			T const InversePivot = static_cast<T>(1) / lu[k][k];
+			for(length_t i = k + 1; i < C; ++i)
+			{
+				lu[k][i] *= InversePivot;
+				for(length_t c = k + 1; c < C; ++c)
+					lu[c][i] -= lu[k][i] * lu[c][k];
+			}
+		}
+		return Regular;
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<C, T, Q> lu_solve(mat<C, C, T, Q> const& lu, vec<C, int, Q> const& pivots, vec<C, T, Q> const& b)
+	{
+		vec<C, T, Q> x(b);
+		for(length_t k = 0; k < C; ++k)
+		{
+			T const t = x[k];
+			x[k] = x[pivots[k]];
+			x[pivots[k]] = t;
+		}
+
+		// Forward substitution with the unit lower triangle, then backward substitution with the upper triangle
+		for(length_t k = 0; k < C; ++k)
+		for(length_t c = 0; c < k; ++c)
+			x[k] -= lu[c][k] * x[c];
+		for(length_t k = C; k-- > 0;)
+		{
+			for(length_t c = k + 1; c < C; ++c)
+				x[k] -= lu[c][k] * x[c];
+			x[k] /= lu[k][k];
+		}
+		return x;
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool cholesky(mat<C, C, T, Q> const& in, mat<C, C, T, Q>& l)
+	{
+		return detail::compute_cholesky<C, T, Q, false>::call(&in, 0, 1, &l) == 1;
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<C, T, Q> cholesky_solve(mat<C, C, T, Q> const& l, vec<C, T, Q> const& b)
+	{
+		// l * y = b, then transpose(l) * x = y
+		vec<C, T, Q> x(b);
+		for(length_t k = 0; k < C; ++k)
+		{
+			for(length_t c = 0; c < k; ++c)
+				x[k] -= l[c][k] * x[c];
+			x[k] /= l[k][k];
+		}
+		for(length_t k = C; k-- > 0;)
+		{
+			for(length_t r = k + 1; r < C; ++r)
+				x[k] -= l[k][r] * x[r];
+			x[k] /= l[k][k];
+		}
+		return x;
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER vec<C, T, Q> solve(mat<C, C, T, Q> const& a, vec<C, T, Q> const& b)
+	{
+		T A[C][C], B[C], X[C];
+		for(length_t c = 0; c < C; ++c)
+		{
+			for(length_t r = 0; r < C; ++r)
+				A[c][r] = a[c][r];
+			B[c] = b[c];
+		}
+
+		detail::solve_lanes<T, true>(A, B, X);
+
+		vec<C, T, Q> x;
+		for(length_t c = 0; c < C; ++c)
+			x[c] = X[c];
+		return x;
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void solve(mat<C, C, T, Q> const* a, vec<C, T, Q> const* b, std::size_t count, vec<C, T, Q>* x)
+	{
+		detail::compute_solve<C, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(a, b, 0, count, x);
+	}
+
+	template<length_t C, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t cholesky(mat<C, C, T, Q> const* in, std::size_t count, mat<C, C, T, Q>* l)
+	{
+		return detail::compute_cholesky<C, T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(in, 0, count, l);
+	}
 } //namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_factorisation_simd.inl"
+#endif
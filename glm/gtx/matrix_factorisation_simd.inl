@@ -0,0 +1,160 @@
+/// @ref gtx_matrix_factorisation
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// cos(acos(x) / 3) with the Taylor series of cos up to the 10th degree, about 4e-9 absolute error on [0, pi / 3]
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER V lane_cos_third_acos_polynomial(V const& x)
+	{
+		V const Phi = lane_acos_polynomial<V, M>(x) * V(1.0 / 3.0);
+
+		V const Phi2 = Phi * Phi;
+		V c(-1.0 / 3628800.0);
+		c = c * Phi2 + V(1.0 / 40320.0);
+		c = c * Phi2 + V(-1.0 / 720.0);
+		c = c * Phi2 + V(1.0 / 24.0);
+		c = c * Phi2 + V(-0.5);
+		return c * Phi2 + V(1);
+	}
+
+	GLM_FUNC_QUALIFIER lane4 lane_cos_third_acos(lane4 const& x)
+	{
+		return lane_cos_third_acos_polynomial<lane4, lane_mask4>(x);
+	}
+
+#	if GLM_ARCH & GLM_ARCH_AVX_BIT
+	GLM_FUNC_QUALIFIER lane8 lane_cos_third_acos(lane8 const& x)
+	{
+		return lane_cos_third_acos_polynomial<lane8, lane_mask8>(x);
+	}
+#	endif//GLM_ARCH & GLM_ARCH_AVX_BIT
+
+	template<qualifier Q>
+	struct compute_svd<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static void svd(mat<3, 3, float, Q> const* in, std::size_t first, std::size_t count, mat<3, 3, float, Q>* u, vec<3, float, Q>* s, mat<3, 3, float, Q>* v)
+		{
+			std::size_t i = first;
+			for(; i + Width <= count; i += Width)
+			{
+				lane a[3][3], U[3][3], S[3], W[3][3];
+				lane_load(in, i, a);
+				svd3x3<float>(a, U, S, W);
+				lane_store(U, i, u);
+				lane_store(S, i, s);
+				lane_store(W, i, v);
+			}
+
+			compute_svd<float, Q, false>::svd(in, i, count, u, s, v);
+		}
+
+		GLM_FUNC_QUALIFIER static void polar(mat<3, 3, float, Q> const* in, std::size_t first, std::size_t count, mat<3, 3, float, Q>* r, mat<3, 3, float, Q>* s)
+		{
+			std::size_t i = first;
+			for(; i + Width <= count; i += Width)
+			{
+				lane a[3][3], R[3][3], S[3][3];
+				lane_load(in, i, a);
+				polar3x3<float>(a, R, S);
+				lane_store(R, i, r);
+				lane_store(S, i, s);
+			}
+
+			compute_svd<float, Q, false>::polar(in, i, count, r, s);
+		}
+	};
+
+	template<qualifier Q>
+	struct compute_eigen_symmetric<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static void call(mat<3, 3, float, Q> const* in, std::size_t first, std::size_t count, vec<3, float, Q>* values, mat<3, 3, float, Q>* vectors)
+		{
+			std::size_t i = first;
+			for(; i + Width <= count; i += Width)
+			{
+				lane a[3][3], Values[3], Vectors[3][3];
+				lane_load(in, i, a);
+				eigen3x3<float>(a, Values, Vectors);
+				lane_store(Values, i, values);
+				lane_store(Vectors, i, vectors);
+			}
+
+			compute_eigen_symmetric<float, Q, false>::call(in, i, count, values, vectors);
+		}
+	};
+
+	template<length_t N, qualifier Q>
+	struct compute_solve<N, float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static void call(mat<N, N, float, Q> const* a, vec<N, float, Q> const* b, std::size_t first, std::size_t count, vec<N, float, Q>* x)
+		{
+			std::size_t i = first;
+			for(; i + Width <= count; i += Width)
+			{
+				lane A[N][N], B[N], X[N];
+				lane_load(a, i, A);
+				lane_load(b, i, B);
+				solve_lanes<float, false>(A, B, X);
+				lane_store(X, i, x);
+			}
+
+			compute_solve<N, float, Q, false>::call(a, b, i, count, x);
+		}
+	};
+
+	template<length_t N, qualifier Q>
+	struct compute_cholesky<N, float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static std::size_t call(mat<N, N, float, Q> const* in, std::size_t first, std::size_t count, mat<N, N, float, Q>* l)
+		{
+			std::size_t i = first;
+			for(; i + Width <= count; i += Width)
+			{
+				lane A[N][N], L[N][N];
+				lane_load(in, i, A);
+				cholesky_lanes<float>(A, L);
+				lane_store(L, i, l);
+			}
+
+			return count_positive_diagonals(l, first, i) + compute_cholesky<N, float, Q, false>::call(in, i, count, l);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -10,11 +10,19 @@
 /// Include <glm/gtx/matrix_interpolation.hpp> to use the features of this extension.
 ///
 /// Allows to directly interpolate two matrices.
+///
+/// A matrix_interpolator decomposes a pair of affine matrices once into translations, scales and a rotation from the first
+/// orientation to the second, then interpolates them at any number of deltas without acos or branches, for instance the
+/// sub-frame times of motion blur. For float and GLM_FORCE_INTRINSICS, four or eight deltas are evaluated at once.
 
 #pragma once
 
 // Dependency:
+#include <cstddef>
+#include <limits>
 #include "../glm.hpp"
+#include "../gtx/matrix_decompose.hpp"
+#include "../gtx/quaternion_batch.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -54,6 +62,39 @@ namespace glm
 	GLM_FUNC_DECL mat<4, 4, T, Q> interpolate(
 		mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2, T const Delta);
 
+	/// A pair of affine matrices decomposed by buildMatrixInterpolator.
+	/// The rotation at delta is angleAxis(angle * delta, axis) * orientation, along the shortest arc.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q = defaultp>
+	struct matrix_interpolator
+	{
+		vec<3, T, Q> translation[2];
+		vec<3, T, Q> scale[2];
+		qua<T, Q> orientation;
+		vec<3, T, Q> axis;
+		T angle;
+	};
+
+	/// Decompose m1 and m2 with decomposeAffine into an interpolator.
+	/// Unlike interpolate, the scales of the matrices are interpolated.
+	/// Return false if the linear part of a matrix is singular.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL bool buildMatrixInterpolator(
+		matrix_interpolator<T, Q>& interpolator, mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2);
+
+	/// Interpolate the decomposed matrices at delta, m1 at 0 and m2 at 1.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> interpolate(
+		matrix_interpolator<T, Q> const& interpolator, T delta);
+
+	/// Interpolate the decomposed matrices at count deltas into out.
+	/// From GLM_GTX_matrix_interpolation extension.
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void interpolate(
+		matrix_interpolator<T, Q> const& interpolator, T const* deltas, std::size_t count, mat<4, 4, T, Q>* out);
+
 	/// @}
 }//namespace glm
 
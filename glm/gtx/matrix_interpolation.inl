@@ -2,8 +2,20 @@
 
 #include "../gtc/constants.hpp"
 
-namespace glm
+namespace glm{
+namespace detail
 {
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_matrix_interpolator
+	{
+		GLM_FUNC_QUALIFIER static void call(matrix_interpolator<T, Q> const& interpolator, T const* deltas, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = interpolate(interpolator, deltas[i]);
+		}
+	};
+}//namespace detail
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER void axisAngle(mat<4, 4, T, Q> const& m, vec<3, T, Q> & axis, T& angle)
 	{
@@ -126,4 +138,51 @@ namespace glm
 		out[3][2] = m1[3][2] + delta * (m2[3][2] - m1[3][2]);
 		return out;
 	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER bool buildMatrixInterpolator(matrix_interpolator<T, Q>& interpolator, mat<4, 4, T, Q> const& m1, mat<4, 4, T, Q> const& m2)
+	{
+		qua<T, Q> Orientation;
+		bool const Affine1 = decomposeAffine(m1, interpolator.scale[0], interpolator.orientation, interpolator.translation[0]);
+		bool const Affine2 = decomposeAffine(m2, interpolator.scale[1], Orientation, interpolator.translation[1]);
+
+		// Rotation from the first orientation to the second along the shortest arc
+		qua<T, Q> Rotation = Orientation * conjugate(interpolator.orientation);
+		if(Rotation.w < static_cast<T>(0))
+			Rotation = -Rotation;
+
+		vec<3, T, Q> const Axis(Rotation.x, Rotation.y, Rotation.z);
+		T const SinHalfAngle = length(Axis);
+		interpolator.angle = static_cast<T>(2) * atan(SinHalfAngle, Rotation.w);
+		interpolator.axis = SinHalfAngle > epsilon<T>() ? Axis / SinHalfAngle : vec<3, T, Q>(static_cast<T>(0));
+
+		return Affine1 && Affine2;
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> interpolate(matrix_interpolator<T, Q> const& interpolator, T delta)
+	{
+		T const HalfAngle = interpolator.angle * delta * static_cast<T>(0.5);
+		qua<T, Q> const Orientation = qua<T, Q>(cos(HalfAngle), interpolator.axis * sin(HalfAngle)) * interpolator.orientation;
+		mat<3, 3, T, Q> const Rotation = mat3_cast(Orientation);
+		vec<3, T, Q> const Scale = mix(interpolator.scale[0], interpolator.scale[1], delta);
+		vec<3, T, Q> const Translation = mix(interpolator.translation[0], interpolator.translation[1], delta);
+
+		return mat<4, 4, T, Q>(
+			vec<4, T, Q>(Rotation[0] * Scale.x, static_cast<T>(0)),
+			vec<4, T, Q>(Rotation[1] * Scale.y, static_cast<T>(0)),
+			vec<4, T, Q>(Rotation[2] * Scale.z, static_cast<T>(0)),
+			vec<4, T, Q>(Translation, static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void interpolate(matrix_interpolator<T, Q> const& interpolator, T const* deltas, std::size_t count, mat<4, 4, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'interpolate' only accept floating-point inputs");
+		detail::compute_matrix_interpolator<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(interpolator, deltas, count, out);
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_interpolation_simd.inl"
+#endif
@@ -0,0 +1,67 @@
+/// @ref gtx_matrix_interpolation
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The orientation at delta d is cos(angle d / 2) q + sin(angle d / 2) (axis, 0) * q: the two quaternions are
+	// broadcast once and Width deltas are interpolated at a time. The remaining deltas are interpolated by the generic path.
+	template<qualifier Q>
+	struct compute_matrix_interpolator<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		GLM_FUNC_QUALIFIER static void call(matrix_interpolator<float, Q> const& interpolator, float const* deltas, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+			qua<float, Q> const& q = interpolator.orientation;
+			qua<float, Q> const Turned = qua<float, Q>(0.0f, interpolator.axis) * q;
+			lane const Orientation[4] = {lane(q.x), lane(q.y), lane(q.z), lane(q.w)};
+			lane const Turn[4] = {lane(Turned.x), lane(Turned.y), lane(Turned.z), lane(Turned.w)};
+			lane const HalfAngle(interpolator.angle * 0.5f);
+
+			lane Scale[3], ScaleDelta[3], Translation[3], TranslationDelta[3];
+			for(length_t c = 0; c < 3; ++c)
+			{
+				Scale[c] = lane(interpolator.scale[0][c]);
+				ScaleDelta[c] = lane(interpolator.scale[1][c] - interpolator.scale[0][c]);
+				Translation[c] = lane(interpolator.translation[0][c]);
+				TranslationDelta[c] = lane(interpolator.translation[1][c] - interpolator.translation[0][c]);
+			}
+
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane d, s, c;
+				lane_load(deltas, i, d);
+				lane_sincos(HalfAngle * d, s, c);
+
+				lane Quat[4], Rotation[3][3], Result[4][4];
+				for(length_t k = 0; k < 4; ++k)
+					Quat[k] = c * Orientation[k] + s * Turn[k];
+				lane_mat3_cast(Quat, Rotation);
+
+				for(length_t k = 0; k < 3; ++k)
+				{
+					lane const ColumnScale = Scale[k] + d * ScaleDelta[k];
+					for(length_t r = 0; r < 3; ++r)
+						Result[k][r] = Rotation[k][r] * ColumnScale;
+					Result[k][3] = lane(0.0);
+					Result[3][k] = Translation[k] + d * TranslationDelta[k];
+				}
+				Result[3][3] = lane(1.0);
+				lane_store(Result, i, out);
+			}
+			compute_matrix_interpolator<float, Q, false>::call(interpolator, deltas + i, count - i, out + i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,103 @@
+/// @ref gtx_matrix_trs
+/// @file glm/gtx/matrix_trs.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_affine (dependence)
+///
+/// @defgroup gtx_matrix_trs GLM_GTX_matrix_trs
+/// @ingroup gtx
+///
+/// Include <glm/gtx/matrix_trs.hpp> to use the features of this extension.
+///
+/// Build translation * rotation * scale transformations and their inverses directly from their components,
+/// without the three matrix products of translate(rotate(scale(...))).
+/// Batch versions read the components as structure of arrays.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/affine.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_matrix_trs is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_matrix_trs extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_matrix_trs
+	/// @{
+
+	/// Build the matrix equal to translate(t) * mat4_cast(r) * scale(s).
+	/// r must be a unit quaternion.
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> trs(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s);
+
+	/// Build the inverse of trs(t, r, s): scale(1 / s) * mat4_cast(conjugate(r)) * translate(-t).
+	/// r must be a unit quaternion and the components of s different from zero.
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL mat<4, 4, T, Q> inverseTRS(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s);
+
+	/// Build the affine transformation equal to trs(t, r, s).
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL affine<T, Q> affineTRS(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s);
+
+	/// Build the affine transformation equal to inverseTRS(t, r, s).
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL affine<T, Q> affineInverseTRS(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s);
+
+	/// Build count matrices trs(t[i], r[i], s[i]) from translations, unit quaternions and scales stored as structure of arrays.
+	/// Four matrices are built at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void trs(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, mat<4, 4, T, Q>* out);
+
+	/// Build count affine transformations affineTRS(t[i], r[i], s[i]) from components stored as structure of arrays.
+	/// Four transformations are built at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void trs(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, affine<T, Q>* out);
+
+	/// Build count matrices inverseTRS(t[i], r[i], s[i]) from components stored as structure of arrays.
+	/// Four matrices are built at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void inverseTRS(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, mat<4, 4, T, Q>* out);
+
+	/// Build count affine transformations affineInverseTRS(t[i], r[i], s[i]) from components stored as structure of arrays.
+	/// Four transformations are built at once for float when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_matrix_trs
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void inverseTRS(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, affine<T, Q>* out);
+
+	/// @}
+}//namespace glm
+
+#include "matrix_trs.inl"
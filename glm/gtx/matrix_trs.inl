@@ -0,0 +1,162 @@
+/// @ref gtx_matrix_trs
+
+namespace glm{
+namespace detail
+{
+	template<typename T, bool UseSimd>
+	struct compute_trs
+	{
+		// Build the transformations [first, count)
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void trs(
+			T const* tx, T const* ty, T const* tz,
+			T const* rx, T const* ry, T const* rz, T const* rw,
+			T const* sx, T const* sy, T const* sz,
+			std::size_t first, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = glm::trs(vec<3, T, Q>(tx[i], ty[i], tz[i]), qua<T, Q>(rw[i], rx[i], ry[i], rz[i]), vec<3, T, Q>(sx[i], sy[i], sz[i]));
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void trs(
+			T const* tx, T const* ty, T const* tz,
+			T const* rx, T const* ry, T const* rz, T const* rw,
+			T const* sx, T const* sy, T const* sz,
+			std::size_t first, std::size_t count, affine<T, Q>* out)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = glm::affineTRS(vec<3, T, Q>(tx[i], ty[i], tz[i]), qua<T, Q>(rw[i], rx[i], ry[i], rz[i]), vec<3, T, Q>(sx[i], sy[i], sz[i]));
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void inverseTRS(
+			T const* tx, T const* ty, T const* tz,
+			T const* rx, T const* ry, T const* rz, T const* rw,
+			T const* sx, T const* sy, T const* sz,
+			std::size_t first, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = glm::inverseTRS(vec<3, T, Q>(tx[i], ty[i], tz[i]), qua<T, Q>(rw[i], rx[i], ry[i], rz[i]), vec<3, T, Q>(sx[i], sy[i], sz[i]));
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void inverseTRS(
+			T const* tx, T const* ty, T const* tz,
+			T const* rx, T const* ry, T const* rz, T const* rw,
+			T const* sx, T const* sy, T const* sz,
+			std::size_t first, std::size_t count, affine<T, Q>* out)
+		{
+			for(std::size_t i = first; i < count; ++i)
+				out[i] = glm::affineInverseTRS(vec<3, T, Q>(tx[i], ty[i], tz[i]), qua<T, Q>(rw[i], rx[i], ry[i], rz[i]), vec<3, T, Q>(sx[i], sy[i], sz[i]));
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> trs(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s)
+	{
+		mat<3, 3, T, Q> const R(mat3_cast(r));
+
+		return mat<4, 4, T, Q>(
+			vec<4, T, Q>(R[0] * s.x, static_cast<T>(0)),
+			vec<4, T, Q>(R[1] * s.y, static_cast<T>(0)),
+			vec<4, T, Q>(R[2] * s.z, static_cast<T>(0)),
+			vec<4, T, Q>(t, static_cast<T>(1)));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER mat<4, 4, T, Q> inverseTRS(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s)
+	{
+		// The rows of the inverse linear part are the columns of the rotation divided by the scale
+		mat<3, 3, T, Q> const R(mat3_cast(r));
+		vec<3, T, Q> const InvS(static_cast<T>(1) / s);
+		vec<3, T, Q> const InvT(-InvS * vec<3, T, Q>(dot(R[0], t), dot(R[1], t), dot(R[2], t)));
+
+		return mat<4, 4, T, Q>(
+			R[0].x * InvS.x, R[1].x * InvS.y, R[2].x * InvS.z, static_cast<T>(0),
+			R[0].y * InvS.x, R[1].y * InvS.y, R[2].y * InvS.z, static_cast<T>(0),
+			R[0].z * InvS.x, R[1].z * InvS.y, R[2].z * InvS.z, static_cast<T>(0),
+			InvT.x, InvT.y, InvT.z, static_cast<T>(1));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q> affineTRS(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s)
+	{
+		mat<3, 3, T, Q> const R(mat3_cast(r));
+
+		return affine<T, Q>(
+			vec<4, T, Q>(R[0].x * s.x, R[1].x * s.y, R[2].x * s.z, t.x),
+			vec<4, T, Q>(R[0].y * s.x, R[1].y * s.y, R[2].y * s.z, t.y),
+			vec<4, T, Q>(R[0].z * s.x, R[1].z * s.y, R[2].z * s.z, t.z));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER affine<T, Q> affineInverseTRS(vec<3, T, Q> const& t, qua<T, Q> const& r, vec<3, T, Q> const& s)
+	{
+		mat<3, 3, T, Q> const R(mat3_cast(r));
+		vec<3, T, Q> const InvS(static_cast<T>(1) / s);
+		vec<3, T, Q> const InvT(-InvS * vec<3, T, Q>(dot(R[0], t), dot(R[1], t), dot(R[2], t)));
+
+		return affine<T, Q>(
+			vec<4, T, Q>(R[0] * InvS.x, InvT.x),
+			vec<4, T, Q>(R[1] * InvS.y, InvT.y),
+			vec<4, T, Q>(R[2] * InvS.z, InvT.z));
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void trs
+	(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, mat<4, 4, T, Q>* out
+	)
+	{
+		detail::compute_trs<T, GLM_CONFIG_SIMD == GLM_ENABLE>::trs(
+			translationX, translationY, translationZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, 0, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void trs
+	(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, affine<T, Q>* out
+	)
+	{
+		detail::compute_trs<T, GLM_CONFIG_SIMD == GLM_ENABLE>::trs(
+			translationX, translationY, translationZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, 0, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void inverseTRS
+	(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, mat<4, 4, T, Q>* out
+	)
+	{
+		detail::compute_trs<T, GLM_CONFIG_SIMD == GLM_ENABLE>::inverseTRS(
+			translationX, translationY, translationZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, 0, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void inverseTRS
+	(
+		T const* translationX, T const* translationY, T const* translationZ,
+		T const* rotationX, T const* rotationY, T const* rotationZ, T const* rotationW,
+		T const* scaleX, T const* scaleY, T const* scaleZ,
+		std::size_t count, affine<T, Q>* out
+	)
+	{
+		detail::compute_trs<T, GLM_CONFIG_SIMD == GLM_ENABLE>::inverseTRS(
+			translationX, translationY, translationZ, rotationX, rotationY, rotationZ, rotationW, scaleX, scaleY, scaleZ, 0, count, out);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "matrix_trs_simd.inl"
+#endif
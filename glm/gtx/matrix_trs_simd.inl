@@ -0,0 +1,186 @@
+/// @ref gtx_matrix_trs
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/common.h"
+
+namespace glm{
+namespace detail
+{
+	template<>
+	struct compute_trs<float, true>
+	{
+		// Rotation matrix of four unit quaternions, R[c * 3 + r] is the element of column c and row r
+		GLM_FUNC_QUALIFIER static void rotation(std::size_t i, float const* rx, float const* ry, float const* rz, float const* rw, glm_vec4 R[9])
+		{
+			glm_vec4 const x = _mm_loadu_ps(rx + i);
+			glm_vec4 const y = _mm_loadu_ps(ry + i);
+			glm_vec4 const z = _mm_loadu_ps(rz + i);
+			glm_vec4 const w = _mm_loadu_ps(rw + i);
+			glm_vec4 const x2 = _mm_add_ps(x, x);
+			glm_vec4 const y2 = _mm_add_ps(y, y);
+			glm_vec4 const z2 = _mm_add_ps(z, z);
+
+			glm_vec4 const xx = _mm_mul_ps(x, x2);
+			glm_vec4 const yy = _mm_mul_ps(y, y2);
+			glm_vec4 const zz = _mm_mul_ps(z, z2);
+			glm_vec4 const xy = _mm_mul_ps(x, y2);
+			glm_vec4 const xz = _mm_mul_ps(x, z2);
+			glm_vec4 const yz = _mm_mul_ps(y, z2);
+			glm_vec4 const wx = _mm_mul_ps(w, x2);
+			glm_vec4 const wy = _mm_mul_ps(w, y2);
+			glm_vec4 const wz = _mm_mul_ps(w, z2);
+			glm_vec4 const One = _mm_set1_ps(1.0f);
+
+			R[0] = _mm_sub_ps(One, _mm_add_ps(yy, zz));
+			R[1] = _mm_add_ps(xy, wz);
+			R[2] = _mm_sub_ps(xz, wy);
+			R[3] = _mm_sub_ps(xy, wz);
+			R[4] = _mm_sub_ps(One, _mm_add_ps(xx, zz));
+			R[5] = _mm_add_ps(yz, wx);
+			R[6] = _mm_add_ps(xz, wy);
+			R[7] = _mm_sub_ps(yz, wx);
+			R[8] = _mm_sub_ps(One, _mm_add_ps(xx, yy));
+		}
+
+		// Linear part L (same layout as R) and translation T of four TRS transformations
+		GLM_FUNC_QUALIFIER static void forward(
+			std::size_t i,
+			float const* tx, float const* ty, float const* tz,
+			float const* rx, float const* ry, float const* rz, float const* rw,
+			float const* sx, float const* sy, float const* sz,
+			glm_vec4 L[9], glm_vec4 T[3])
+		{
+			rotation(i, rx, ry, rz, rw, L);
+
+			glm_vec4 const S[3] = {_mm_loadu_ps(sx + i), _mm_loadu_ps(sy + i), _mm_loadu_ps(sz + i)};
+			for(length_t c = 0; c < 3; ++c)
+			for(length_t r = 0; r < 3; ++r)
+				L[c * 3 + r] = _mm_mul_ps(L[c * 3 + r], S[c]);
+
+			T[0] = _mm_loadu_ps(tx + i);
+			T[1] = _mm_loadu_ps(ty + i);
+			T[2] = _mm_loadu_ps(tz + i);
+		}
+
+		// Linear part L (same layout as R) and translation T of the inverse of four TRS transformations
+		GLM_FUNC_QUALIFIER static void inverse(
+			std::size_t i,
+			float const* tx, float const* ty, float const* tz,
+			float const* rx, float const* ry, float const* rz, float const* rw,
+			float const* sx, float const* sy, float const* sz,
+			glm_vec4 L[9], glm_vec4 T[3])
+		{
+			glm_vec4 R[9];
+			rotation(i, rx, ry, rz, rw, R);
+
+			glm_vec4 const One = _mm_set1_ps(1.0f);
+			glm_vec4 const InvS[3] = {_mm_div_ps(One, _mm_loadu_ps(sx + i)), _mm_div_ps(One, _mm_loadu_ps(sy + i)), _mm_div_ps(One, _mm_loadu_ps(sz + i))};
+			glm_vec4 const x = _mm_loadu_ps(tx + i);
+			glm_vec4 const y = _mm_loadu_ps(ty + i);
+			glm_vec4 const z = _mm_loadu_ps(tz + i);
+
+			// Row r of the inverse linear part is column r of the rotation divided by the r-th scale
+			for(length_t r = 0; r < 3; ++r)
+			{
+				for(length_t c = 0; c < 3; ++c)
+					L[c * 3 + r] = _mm_mul_ps(R[r * 3 + c], InvS[r]);
+				T[r] = _mm_sub_ps(_mm_setzero_ps(), glm_vec4_fma(L[r], x, glm_vec4_fma(L[3 + r], y, _mm_mul_ps(L[6 + r], z))));
+			}
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void store(glm_vec4 const L[9], glm_vec4 const T[3], mat<4, 4, float, Q>* out)
+		{
+			glm_vec4 const Zero = _mm_setzero_ps();
+			glm_vec4 C0 = L[0], C1 = L[1], C2 = L[2], C3 = Zero;
+			glm_vec4 D0 = L[3], D1 = L[4], D2 = L[5], D3 = Zero;
+			glm_vec4 E0 = L[6], E1 = L[7], E2 = L[8], E3 = Zero;
+			glm_vec4 F0 = T[0], F1 = T[1], F2 = T[2], F3 = _mm_set1_ps(1.0f);
+			_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+			_MM_TRANSPOSE4_PS(D0, D1, D2, D3);
+			_MM_TRANSPOSE4_PS(E0, E1, E2, E3);
+			_MM_TRANSPOSE4_PS(F0, F1, F2, F3);
+
+			_mm_storeu_ps(&out[0][0].x, C0);
+			_mm_storeu_ps(&out[0][1].x, D0);
+			_mm_storeu_ps(&out[0][2].x, E0);
+			_mm_storeu_ps(&out[0][3].x, F0);
+			_mm_storeu_ps(&out[1][0].x, C1);
+			_mm_storeu_ps(&out[1][1].x, D1);
+			_mm_storeu_ps(&out[1][2].x, E1);
+			_mm_storeu_ps(&out[1][3].x, F1);
+			_mm_storeu_ps(&out[2][0].x, C2);
+			_mm_storeu_ps(&out[2][1].x, D2);
+			_mm_storeu_ps(&out[2][2].x, E2);
+			_mm_storeu_ps(&out[2][3].x, F2);
+			_mm_storeu_ps(&out[3][0].x, C3);
+			_mm_storeu_ps(&out[3][1].x, D3);
+			_mm_storeu_ps(&out[3][2].x, E3);
+			_mm_storeu_ps(&out[3][3].x, F3);
+		}
+
+		template<qualifier Q>
+		GLM_FUNC_QUALIFIER static void store(glm_vec4 const L[9], glm_vec4 const T[3], affine<float, Q>* out)
+		{
+			glm_vec4 A0 = L[0], A1 = L[3], A2 = L[6], A3 = T[0];
+			glm_vec4 B0 = L[1], B1 = L[4], B2 = L[7], B3 = T[1];
+			glm_vec4 C0 = L[2], C1 = L[5], C2 = L[8], C3 = T[2];
+			_MM_TRANSPOSE4_PS(A0, A1, A2, A3);
+			_MM_TRANSPOSE4_PS(B0, B1, B2, B3);
+			_MM_TRANSPOSE4_PS(C0, C1, C2, C3);
+
+			_mm_storeu_ps(&out[0][0].x, A0);
+			_mm_storeu_ps(&out[0][1].x, B0);
+			_mm_storeu_ps(&out[0][2].x, C0);
+			_mm_storeu_ps(&out[1][0].x, A1);
+			_mm_storeu_ps(&out[1][1].x, B1);
+			_mm_storeu_ps(&out[1][2].x, C1);
+			_mm_storeu_ps(&out[2][0].x, A2);
+			_mm_storeu_ps(&out[2][1].x, B2);
+			_mm_storeu_ps(&out[2][2].x, C2);
+			_mm_storeu_ps(&out[3][0].x, A3);
+			_mm_storeu_ps(&out[3][1].x, B3);
+			_mm_storeu_ps(&out[3][2].x, C3);
+		}
+
+		template<typename matType>
+		GLM_FUNC_QUALIFIER static void trs(
+			float const* tx, float const* ty, float const* tz,
+			float const* rx, float const* ry, float const* rz, float const* rw,
+			float const* sx, float const* sy, float const* sz,
+			std::size_t first, std::size_t count, matType* out)
+		{
+			std::size_t i = first;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 L[9], T[3];
+				forward(i, tx, ty, tz, rx, ry, rz, rw, sx, sy, sz, L, T);
+				store(L, T, out + i);
+			}
+
+			compute_trs<float, false>::trs(tx, ty, tz, rx, ry, rz, rw, sx, sy, sz, i, count, out);
+		}
+
+		template<typename matType>
+		GLM_FUNC_QUALIFIER static void inverseTRS(
+			float const* tx, float const* ty, float const* tz,
+			float const* rx, float const* ry, float const* rz, float const* rw,
+			float const* sx, float const* sy, float const* sz,
+			std::size_t first, std::size_t count, matType* out)
+		{
+			std::size_t i = first;
+			for(; i + 4 <= count; i += 4)
+			{
+				glm_vec4 L[9], T[3];
+				inverse(i, tx, ty, tz, rx, ry, rz, rw, sx, sy, sz, L, T);
+				store(L, T, out + i);
+			}
+
+			compute_trs<float, false>::inverseTRS(tx, ty, tz, rx, ry, rz, rw, sx, sy, sz, i, count, out);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -152,6 +152,18 @@ namespace glm
 		qua<T, Q> const& y,
 		T const& a);
 
+	/// Approximation of slerp along the shortest path without transcendental functions:
+	/// a normalized linear interpolation with a weight corrected by a polynomial of a and dot(x, y).
+	/// For unit quaternions and a in [0, 1], the result is rotated from the slerp one by less than 6e-5 radians,
+	/// against 0.15 radians for the normalized linear interpolation of fastMix.
+	///
+	/// @see gtx_quaternion
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL qua<T, Q> fastSlerp(
+		qua<T, Q> const& x,
+		qua<T, Q> const& y,
+		T a);
+
 	/// Compute the rotation between two vectors.
 	/// param orig vector, needs to be normalized
 	/// param dest vector, needs to be normalized
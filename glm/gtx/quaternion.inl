@@ -5,6 +5,34 @@
 
 namespace glm
 {
+namespace detail
+{
+	// Weight of the normalized linear interpolation of unit quaternions with |dot| = d rotating by the fraction t of their angle:
+	// t + t * (t - 1/2) * (t - 1) * k(d, (t - 1/2)^2) with k a least squares fit to the exact weight minimizing the largest angular error
+	template<typename V>
+	GLM_FUNC_QUALIFIER V fast_slerp_weight(V const& d, V const& t)
+	{
+		V const c = t - V(0.5);
+		V const u = c * c;
+		V const k0 = ((V(-0.1217172) * d + V(0.40357891)) * d + V(-1.144804)) * d + V(0.85937237);
+		V const k1 = ((V(-0.20063308) * d + V(1.324083)) * d + V(-1.9167)) * d + V(0.81016757);
+		V const k2 = ((V(-3.9418855) * d + V(7.6706194)) * d + V(-5.0905698)) * d + V(1.2109265);
+		V const k = (k2 * u + k1) * u + k0;
+		return t + t * c * (t - V(1)) * k;
+	}
+
+	template<typename T, qualifier Q, bool Aligned>
+	struct compute_fast_slerp
+	{
+		GLM_FUNC_QUALIFIER static qua<T, Q> call(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+		{
+			T const d = dot(x, y);
+			T const Weight = fast_slerp_weight(abs(d), a);
+			return normalize(x * (static_cast<T>(1) - Weight) + y * (d < static_cast<T>(0) ? -Weight : Weight));
+		}
+	};
+}//namespace detail
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER qua<T, Q> quat_identity()
 	{
@@ -118,6 +146,13 @@ namespace glm
 		return glm::normalize(x * (static_cast<T>(1) - a) + (y * a));
 	}
 
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER qua<T, Q> fastSlerp(qua<T, Q> const& x, qua<T, Q> const& y, T a)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastSlerp' only accept floating-point inputs");
+		return detail::compute_fast_slerp<T, Q, detail::is_aligned<Q>::value>::call(x, y, a);
+	}
+
 	template<typename T, qualifier Q>
 	GLM_FUNC_QUALIFIER qua<T, Q> rotation(vec<3, T, Q> const& orig, vec<3, T, Q> const& dest)
 	{
@@ -157,3 +192,7 @@ namespace glm
 			rotationAxis.z * invs);
 	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "quaternion_simd.inl"
+#endif
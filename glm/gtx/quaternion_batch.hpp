@@ -0,0 +1,99 @@
+/// @ref gtx_quaternion_batch
+/// @file glm/gtx/quaternion_batch.hpp
+///
+/// @see core (dependence)
+/// @see gtc_quaternion (dependence)
+/// @see gtx_quaternion (dependence)
+///
+/// @defgroup gtx_quaternion_batch GLM_GTX_quaternion_batch
+/// @ingroup gtx
+///
+/// Include <glm/gtx/quaternion_batch.hpp> to use the features of this extension.
+///
+/// Interpolate arrays of quaternion pairs with per element weights in a single call, for instance to blend animation poses,
+/// and convert arrays of quaternions to rotation matrices and back.
+/// The interpolations take the shortest path: y[i] is negated when dot(x[i], y[i]) is negative.
+/// The output may be the same array as an input but may not partially overlap it.
+///
+/// For float and GLM_FORCE_INTRINSICS, four or eight elements are processed at once without branches, depending on SSE2 or AVX support.
+/// slerpBatch then evaluates acos and sin with polynomials, the components differ from slerp by less than 5e-7 for weights in [0, 1].
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <limits>
+#include "../glm.hpp"
+#include "../gtc/quaternion.hpp"
+#include "../gtx/quaternion.hpp"
+#include "../detail/compute_lane.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_quaternion_batch is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_quaternion_batch extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_quaternion_batch
+	/// @{
+
+	/// Compute out[i] = slerp(x[i], y[i], a[i]) along the shortest path for count pairs of unit quaternions.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void slerpBatch(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out);
+
+	/// Compute out[i] = normalize(x[i] * (1 - a[i]) + y[i] * a[i]) along the shortest path for count pairs of quaternions.
+	/// Cheaper than slerpBatch but the angular velocity is not constant: the result is rotated from the slerp one by at most
+	/// 0.0002 radians for inputs 20 degrees apart, 0.011 radians for inputs 80 degrees apart.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void nlerpBatch(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out);
+
+	/// Compute out[i] = fastSlerp(x[i], y[i], a[i]) for count pairs of unit quaternions, about the cost of nlerpBatch.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void fastSlerpBatch(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out);
+
+	/// Compute out[i] = mat3_cast(q[i]) for count unit quaternions.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat3CastBatch(qua<T, Q> const* q, std::size_t count, mat<3, 3, T, Q>* out);
+
+	/// Compute the rotation matrices of count unit quaternions stored as mat3x4, like mat3x4_cast(tdualquat):
+	/// the columns of out[i] are the rows of mat3_cast(q[i]) with a null w component.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat3x4CastBatch(qua<T, Q> const* q, std::size_t count, mat<3, 4, T, Q>* out);
+
+	/// Compute out[i] = mat4_cast(q[i]) for count unit quaternions.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void mat4CastBatch(qua<T, Q> const* q, std::size_t count, mat<4, 4, T, Q>* out);
+
+	/// Compute out[i] = quat_cast(m[i]) for count rotation matrices.
+	/// The largest of the four components is computed first, as quat_cast does, and it's selected without branches in SIMD lanes.
+	/// Single matrices and the remaining elements use the branch of quat_cast, which is faster than the selection on one element.
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void quatCastBatch(mat<3, 3, T, Q> const* m, std::size_t count, qua<T, Q>* out);
+
+	/// Compute the quaternions of count rotation matrices stored as mat3x4, the columns of m[i] are the rows of the rotation.
+	/// @see quatCastBatch(mat<3, 3, T, Q> const*, std::size_t, qua<T, Q>*)
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void quatCastBatch(mat<3, 4, T, Q> const* m, std::size_t count, qua<T, Q>* out);
+
+	/// Compute out[i] = quat_cast(m[i]) for count matrices whose upper left 3x3 part is a rotation.
+	/// @see quatCastBatch(mat<3, 3, T, Q> const*, std::size_t, qua<T, Q>*)
+	/// @see gtx_quaternion_batch
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void quatCastBatch(mat<4, 4, T, Q> const* m, std::size_t count, qua<T, Q>* out);
+
+	/// @}
+}//namespace glm
+
+#include "quaternion_batch.inl"
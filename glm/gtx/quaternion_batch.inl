@@ -0,0 +1,227 @@
+/// @ref gtx_quaternion_batch
+
+namespace glm{
+namespace detail
+{
+	// Rotation matrix m[c][r] of lanes of unit quaternion components x, y, z, w
+	template<typename V>
+	GLM_FUNC_QUALIFIER void lane_mat3_cast(V const q[4], V m[3][3])
+	{
+		V const x2 = q[0] + q[0];
+		V const y2 = q[1] + q[1];
+		V const z2 = q[2] + q[2];
+		V const xx = q[0] * x2;
+		V const yy = q[1] * y2;
+		V const zz = q[2] * z2;
+		V const xy = q[0] * y2;
+		V const xz = q[0] * z2;
+		V const yz = q[1] * z2;
+		V const wx = q[3] * x2;
+		V const wy = q[3] * y2;
+		V const wz = q[3] * z2;
+
+		m[0][0] = V(1) - (yy + zz);
+		m[0][1] = xy + wz;
+		m[0][2] = xz - wy;
+		m[1][0] = xy - wz;
+		m[1][1] = V(1) - (xx + zz);
+		m[1][2] = yz + wx;
+		m[2][0] = xz + wy;
+		m[2][1] = yz - wx;
+		m[2][2] = V(1) - (xx + yy);
+	}
+
+	// Quaternion components x, y, z, w of lanes of rotation matrices m[c][r].
+	// As quat_cast, the largest component is computed from the diagonal and the others from the off diagonal elements,
+	// the same component is selected on ties but with masks instead of branches.
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER void lane_quat_cast(V const m[3][3], V q[4])
+	{
+		V const FourXSquaredMinus1 = m[0][0] - m[1][1] - m[2][2];
+		V const FourYSquaredMinus1 = m[1][1] - m[0][0] - m[2][2];
+		V const FourZSquaredMinus1 = m[2][2] - m[0][0] - m[1][1];
+		V const FourWSquaredMinus1 = m[0][0] + m[1][1] + m[2][2];
+
+		M const BiggestX = FourXSquaredMinus1 > FourWSquaredMinus1;
+		V FourBiggestSquaredMinus1 = lane_select(BiggestX, FourXSquaredMinus1, FourWSquaredMinus1);
+		M const BiggestY = FourYSquaredMinus1 > FourBiggestSquaredMinus1;
+		FourBiggestSquaredMinus1 = lane_select(BiggestY, FourYSquaredMinus1, FourBiggestSquaredMinus1);
+		M const BiggestZ = FourZSquaredMinus1 > FourBiggestSquaredMinus1;
+		FourBiggestSquaredMinus1 = lane_select(BiggestZ, FourZSquaredMinus1, FourBiggestSquaredMinus1);
+
+		V const BiggestVal = lane_sqrt(FourBiggestSquaredMinus1 + V(1)) * V(0.5);
+		V const Mult = V(0.25) / BiggestVal;
+
+		V const a = (m[1][2] - m[2][1]) * Mult;
+		V const b = (m[2][0] - m[0][2]) * Mult;
+		V const c = (m[0][1] - m[1][0]) * Mult;
+		V const d = (m[0][1] + m[1][0]) * Mult;
+		V const e = (m[2][0] + m[0][2]) * Mult;
+		V const f = (m[1][2] + m[2][1]) * Mult;
+
+		// The later selections override the earlier ones, like the comparisons against the running maximum
+		q[0] = lane_select(BiggestZ, e, lane_select(BiggestY, d, lane_select(BiggestX, BiggestVal, a)));
+		q[1] = lane_select(BiggestZ, f, lane_select(BiggestY, BiggestVal, lane_select(BiggestX, d, b)));
+		q[2] = lane_select(BiggestZ, BiggestVal, lane_select(BiggestY, f, lane_select(BiggestX, e, c)));
+		q[3] = lane_select(BiggestZ, c, lane_select(BiggestY, b, lane_select(BiggestX, a, BiggestVal)));
+	}
+
+	// The results go through a local so that out may alias the inputs
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_quaternion_batch
+	{
+		GLM_FUNC_QUALIFIER static void slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				qua<T, Q> const Result(glm::slerp(x[i], y[i], a[i]));
+				out[i] = Result;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void nlerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T const Sign = dot(x[i], y[i]) < static_cast<T>(0) ? static_cast<T>(-1) : static_cast<T>(1);
+				qua<T, Q> const Result(normalize(x[i] * (static_cast<T>(1) - a[i]) + y[i] * (Sign * a[i])));
+				out[i] = Result;
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void fast_slerp(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				qua<T, Q> const Result(fastSlerp(x[i], y[i], a[i]));
+				out[i] = Result;
+			}
+		}
+
+		// The matrices are computed by the kernels of the SIMD path one element at a time
+		GLM_FUNC_QUALIFIER static void mat3_cast(qua<T, Q> const* q, std::size_t count, mat<3, 3, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					out[i][c][r] = Rotation[c][r];
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mat3x4_cast(qua<T, Q> const* q, std::size_t count, mat<3, 4, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				for(length_t c = 0; c < 3; ++c)
+					out[i][c] = vec<4, T, Q>(Rotation[0][c], Rotation[1][c], Rotation[2][c], static_cast<T>(0));
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4_cast(qua<T, Q> const* q, std::size_t count, mat<4, 4, T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				for(length_t c = 0; c < 3; ++c)
+					out[i][c] = vec<4, T, Q>(Rotation[c][0], Rotation[c][1], Rotation[c][2], static_cast<T>(0));
+				out[i][3] = vec<4, T, Q>(static_cast<T>(0), static_cast<T>(0), static_cast<T>(0), static_cast<T>(1));
+			}
+		}
+
+		// One element at a time, the branch of quat_cast is faster than the selection of the four components
+		GLM_FUNC_QUALIFIER static void quat_cast(mat<3, 3, T, Q> const* m, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::quat_cast(m[i]);
+		}
+
+		GLM_FUNC_QUALIFIER static void quat_cast(mat<3, 4, T, Q> const* m, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::quat_cast(mat<3, 3, T, Q>(transpose(m[i])));
+		}
+
+		GLM_FUNC_QUALIFIER static void quat_cast(mat<4, 4, T, Q> const* m, std::size_t count, qua<T, Q>* out)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+				out[i] = glm::quat_cast(m[i]);
+		}
+	};
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void slerpBatch(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'slerpBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::slerp(x, y, a, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void nlerpBatch(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'nlerpBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::nlerp(x, y, a, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void fastSlerpBatch(qua<T, Q> const* x, qua<T, Q> const* y, T const* a, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'fastSlerpBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::fast_slerp(x, y, a, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3CastBatch(qua<T, Q> const* q, std::size_t count, mat<3, 3, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mat3CastBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mat3_cast(q, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat3x4CastBatch(qua<T, Q> const* q, std::size_t count, mat<3, 4, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mat3x4CastBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mat3x4_cast(q, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void mat4CastBatch(qua<T, Q> const* q, std::size_t count, mat<4, 4, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'mat4CastBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::mat4_cast(q, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void quatCastBatch(mat<3, 3, T, Q> const* m, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'quatCastBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::quat_cast(m, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void quatCastBatch(mat<3, 4, T, Q> const* m, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'quatCastBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::quat_cast(m, count, out);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void quatCastBatch(mat<4, 4, T, Q> const* m, std::size_t count, qua<T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'quatCastBatch' only accept floating-point inputs");
+		detail::compute_quaternion_batch<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::quat_cast(m, count, out);
+	}
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "quaternion_batch_simd.inl"
+#endif
@@ -0,0 +1,219 @@
+/// @ref gtx_quaternion_batch
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// Normalized linear interpolation of lanes of quaternion components with the weight a of y, negated when d = dot(x, y) < 0
+	template<typename V, typename M>
+	GLM_FUNC_QUALIFIER void lane_nlerp(V const x[4], V const y[4], V const& d, V const& a, V out[4])
+	{
+		V const b = V(1) - a;
+		V const w1 = lane_select(d < V(0), -a, a);
+
+		V r[4];
+		for(length_t c = 0; c < 4; ++c)
+			r[c] = x[c] * b + y[c] * w1;
+		V const InvLength = lane_rsqrt(lane_dot(r, r));
+		for(length_t c = 0; c < 4; ++c)
+			out[c] = r[c] * InvLength;
+	}
+
+	// Shortest path slerp, acos and sin are evaluated with polynomials.
+	// The weights of the linear interpolation are used when sin(theta) would be a zero denominator.
+	struct lane_slerp_kernel
+	{
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static void call(V const x[4], V const y[4], V const& a, V out[4])
+		{
+			V const d = lane_dot(x, y);
+			M const Negative = d < V(0);
+			V const CosTheta = lane_min(lane_abs(d), V(1));
+			M const Linear = CosTheta > V(1) - V(epsilon<float>());
+
+			V const Theta = lane_acos_polynomial<V, M>(CosTheta);
+			V const InvSinTheta = V(1) / lane_max(lane_sin_polynomial(Theta), V(epsilon<float>()));
+			V const b = V(1) - a;
+			V const w0 = lane_select(Linear, b, lane_sin_polynomial(b * Theta) * InvSinTheta);
+			V const w1 = lane_select(Linear, a, lane_sin_polynomial(a * Theta) * InvSinTheta);
+			V const w1Signed = lane_select(Negative, -w1, w1);
+
+			for(length_t c = 0; c < 4; ++c)
+				out[c] = x[c] * w0 + y[c] * w1Signed;
+		}
+	};
+
+	struct lane_nlerp_kernel
+	{
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static void call(V const x[4], V const y[4], V const& a, V out[4])
+		{
+			lane_nlerp<V, M>(x, y, lane_dot(x, y), a, out);
+		}
+	};
+
+	struct lane_fast_slerp_kernel
+	{
+		template<typename V, typename M>
+		GLM_FUNC_QUALIFIER static void call(V const x[4], V const y[4], V const& a, V out[4])
+		{
+			V const d = lane_dot(x, y);
+			lane_nlerp<V, M>(x, y, d, fast_slerp_weight(lane_abs(d), a), out);
+		}
+	};
+
+	// The remaining quaternions are interpolated one at a time with the same kernels on float lanes
+	template<qualifier Q>
+	struct compute_quaternion_batch<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			typedef lane_mask8 lane_mask;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			typedef lane_mask4 lane_mask;
+			static std::size_t const Width = 4;
+#		endif
+
+		template<typename Kernel>
+		GLM_FUNC_QUALIFIER static void call(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, std::size_t count, qua<float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane X[4], Y[4], A, Result[4];
+				lane_load(x, i, X);
+				lane_load(y, i, Y);
+				lane_load(a, i, A);
+				Kernel::template call<lane, lane_mask>(X, Y, A, Result);
+				lane_store(Result, i, out);
+			}
+			for(; i < count; ++i)
+			{
+				float X[4], Y[4], Result[4];
+				lane_load(x, i, X);
+				lane_load(y, i, Y);
+				Kernel::template call<float, bool>(X, Y, a[i], Result);
+				lane_store(Result, i, out);
+			}
+		}
+
+		GLM_FUNC_QUALIFIER static void slerp(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, std::size_t count, qua<float, Q>* out)
+		{
+			call<lane_slerp_kernel>(x, y, a, count, out);
+		}
+
+		GLM_FUNC_QUALIFIER static void nlerp(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, std::size_t count, qua<float, Q>* out)
+		{
+			call<lane_nlerp_kernel>(x, y, a, count, out);
+		}
+
+		GLM_FUNC_QUALIFIER static void fast_slerp(qua<float, Q> const* x, qua<float, Q> const* y, float const* a, std::size_t count, qua<float, Q>* out)
+		{
+			call<lane_fast_slerp_kernel>(x, y, a, count, out);
+		}
+
+		// The remaining elements are converted by the generic path, which runs the same kernels on floats
+		GLM_FUNC_QUALIFIER static void mat3_cast(qua<float, Q> const* q, std::size_t count, mat<3, 3, float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				lane_store(Rotation, i, out);
+			}
+			compute_quaternion_batch<float, Q, false>::mat3_cast(q + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat3x4_cast(qua<float, Q> const* q, std::size_t count, mat<3, 4, float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				for(length_t c = 0; c < 3; ++c)
+				{
+					lane const Column[4] = {Rotation[0][c], Rotation[1][c], Rotation[2][c], lane(0.0)};
+					lane_store_column(Column, i, c, out);
+				}
+			}
+			compute_quaternion_batch<float, Q, false>::mat3x4_cast(q + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void mat4_cast(qua<float, Q> const* q, std::size_t count, mat<4, 4, float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Quat[4], Rotation[3][3];
+				lane_load(q, i, Quat);
+				lane_mat3_cast(Quat, Rotation);
+				for(length_t c = 0; c < 3; ++c)
+				{
+					lane const Column[4] = {Rotation[c][0], Rotation[c][1], Rotation[c][2], lane(0.0)};
+					lane_store_column(Column, i, c, out);
+				}
+				lane const Translation[4] = {lane(0.0), lane(0.0), lane(0.0), lane(1.0)};
+				lane_store_column(Translation, i, 3, out);
+			}
+			compute_quaternion_batch<float, Q, false>::mat4_cast(q + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void quat_cast(mat<3, 3, float, Q> const* m, std::size_t count, qua<float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Rotation[3][3], Quat[4];
+				lane_load(m, i, Rotation);
+				lane_quat_cast<lane, lane_mask>(Rotation, Quat);
+				lane_store(Quat, i, out);
+			}
+			compute_quaternion_batch<float, Q, false>::quat_cast(m + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void quat_cast(mat<3, 4, float, Q> const* m, std::size_t count, qua<float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Rows[3][4], Rotation[3][3], Quat[4];
+				lane_load(m, i, Rows);
+				for(length_t c = 0; c < 3; ++c)
+				for(length_t r = 0; r < 3; ++r)
+					Rotation[c][r] = Rows[r][c];
+				lane_quat_cast<lane, lane_mask>(Rotation, Quat);
+				lane_store(Quat, i, out);
+			}
+			compute_quaternion_batch<float, Q, false>::quat_cast(m + i, count - i, out + i);
+		}
+
+		GLM_FUNC_QUALIFIER static void quat_cast(mat<4, 4, float, Q> const* m, std::size_t count, qua<float, Q>* out)
+		{
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Rotation[3][3], Quat[4];
+				for(length_t c = 0; c < 3; ++c)
+				{
+					lane Column[4];
+					lane_load_column(m, i, c, Column);
+					for(length_t r = 0; r < 3; ++r)
+						Rotation[c][r] = Column[r];
+				}
+				lane_quat_cast<lane, lane_mask>(Rotation, Quat);
+				lane_store(Quat, i, out);
+			}
+			compute_quaternion_batch<float, Q, false>::quat_cast(m + i, count - i, out + i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,34 @@
+/// @ref gtx_quaternion
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/geometric.h"
+#include "../detail/compute_lane.hpp"
+
+namespace glm{
+namespace detail
+{
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+	// The weight is computed in the four lanes of the broadcast dot product
+	template<qualifier Q>
+	struct compute_fast_slerp<float, Q, true>
+	{
+		GLM_STATIC_ASSERT(detail::is_aligned<Q>::value, "Specialization requires aligned");
+
+		GLM_FUNC_QUALIFIER static qua<float, Q> call(qua<float, Q> const& x, qua<float, Q> const& y, float a)
+		{
+			glm_vec4 const Dot = glm_vec4_dot(x.data, y.data);
+			glm_vec4 const Sign = _mm_and_ps(Dot, _mm_set1_ps(-0.0f));
+			lane4 const Weight = fast_slerp_weight(lane4(_mm_andnot_ps(_mm_set1_ps(-0.0f), Dot)), lane4(a));
+			lane4 const Lerp = lane4(x.data) * (lane4(1.0) - Weight) + lane4(_mm_xor_ps(y.data, Sign)) * Weight;
+
+			qua<float, Q> Result;
+			Result.data = (Lerp * lane_rsqrt(lane4(glm_vec4_dot(Lerp.data, Lerp.data)))).data;
+			return Result;
+		}
+	};
+#	endif
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,133 @@
+/// @ref gtx_skinning
+/// @file glm/gtx/skinning.hpp
+///
+/// @see core (dependence)
+/// @see gtx_affine (dependence)
+/// @see gtx_dual_quaternion (dependence)
+///
+/// @defgroup gtx_skinning GLM_GTX_skinning
+/// @ingroup gtx
+///
+/// Include <glm/gtx/skinning.hpp> to use the features of this extension.
+///
+/// Deform arrays of vertices by the weighted transformations of their bones: up to four dual quaternions or up to eight affine transformations per vertex.
+/// The bone indices must be valid even when their weight is null, the outputs may be the same arrays as the inputs.
+///
+/// For float and GLM_FORCE_INTRINSICS, four or eight vertices are skinned at once without branches, depending on SSE2 or AVX support.
+/// linearBlendSkinningParallel creates its threads on each call, small meshes are faster skinned by linearBlendSkinning.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <limits>
+#include "../glm.hpp"
+#include "../gtx/affine.hpp"
+#include "../gtx/dual_quaternion.hpp"
+#include "../detail/compute_lane.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_skinning is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_skinning extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_skinning
+	/// @{
+
+	/// Dual quaternion linear blend skinning of count vertices, see Kavan et al., "Geometric Skinning with Approximate Dual Quaternion Blending".
+	/// The unit dual quaternions bones[indices[i][k]] are blended with the weights weights[i][k] and normalized, then transform positions[i] into outPositions[i]
+	/// and rotate normals[i] into outNormals[i]. The normals are skipped when normals or outNormals is null.
+	/// A bone whose real part is in the opposite hemisphere of the one of the first influence is negated, so that the blend takes the shortest path.
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I, qualifier P>
+	GLM_FUNC_DECL void dualQuaternionSkinning(
+		tdualquat<T, Q> const* bones, vec<4, I, P> const* indices, vec<4, T, Q> const* weights,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, std::size_t count,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals);
+
+	/// Strided array of vertex attributes, element i is stride bytes after element i - 1.
+	/// The stride of a packed array is sizeof(T), the one of an attribute of interleaved vertices is the size of a vertex.
+	/// @see gtx_skinning
+	template<typename T>
+	struct vertex_stream
+	{
+		T* data;
+		std::size_t stride;
+
+		/// Null stream, for a skipped attribute
+		GLM_FUNC_DECL vertex_stream();
+		/// Packed array
+		GLM_FUNC_DECL vertex_stream(T* data);
+		GLM_FUNC_DECL vertex_stream(T* data, std::size_t stride);
+
+		GLM_FUNC_DECL T& operator[](std::size_t i) const;
+	};
+
+	/// Stream of a packed array of bone indices or weights with influences elements per vertex, vertex i starts at element i * influences.
+	/// @see gtx_skinning
+	template<typename T>
+	GLM_FUNC_DECL vertex_stream<T> influenceStream(T* data, length_t influences);
+
+	/// Vertex streams of linear blend skinning.
+	/// Vertex i is influenced by influences bones with weights expected to sum to one, read as consecutive elements from indices[i] and weights[i].
+	/// The index and weight streams advance by one vertex, their stride is at least influences elements:
+	/// build them with influenceStream for packed arrays, or from the first index and weight of interleaved vertices.
+	/// Null normals, tangents or their outputs skip the attribute. A vec3 stream of vec4 tangents leaves the handedness in w untouched.
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	struct skinning_streams
+	{
+		vertex_stream<I const> indices;
+		vertex_stream<T const> weights;
+		length_t influences;
+
+		vertex_stream<vec<3, T, Q> const> positions;
+		vertex_stream<vec<3, T, Q> const> normals;
+		vertex_stream<vec<3, T, Q> const> tangents;
+
+		vertex_stream<vec<3, T, Q> > outPositions;
+		vertex_stream<vec<3, T, Q> > outNormals;
+		vertex_stream<vec<3, T, Q> > outTangents;
+
+		/// Null streams and four influences
+		GLM_FUNC_DECL skinning_streams();
+	};
+
+	/// Linear blend skinning of count vertices with from 1 to 8 influences per vertex.
+	/// The weighted sum of the affine transformations bones[indices[i * influences + k]] transforms the positions,
+	/// its linear part transforms the normals and the tangents, which are not renormalized.
+	/// Transforming normals by the linear part is exact for rotations and uniform scales.
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DECL void linearBlendSkinning(affine<T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count);
+
+	/// Linear blend skinning with bones stored as the columns of mat3x4, like the ones returned by mat3x4_cast(tdualquat).
+	/// @see linearBlendSkinning(affine<T, Q> const*, skinning_streams<T, Q, I> const&, std::size_t)
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DECL void linearBlendSkinning(mat<3, 4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count);
+
+#	if GLM_HAS_CXX11_STL
+	/// Linear blend skinning with threadCount threads, including the calling thread.
+	/// The threads skin chunks of 1024 vertices taken in order from a shared counter, so that the faster threads take more chunks.
+	/// @see linearBlendSkinning(affine<T, Q> const*, skinning_streams<T, Q, I> const&, std::size_t)
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DECL void linearBlendSkinningParallel(affine<T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count, unsigned threadCount);
+
+	/// Linear blend skinning with bones stored as the columns of mat3x4 and threadCount threads, including the calling thread.
+	/// @see linearBlendSkinningParallel(affine<T, Q> const*, skinning_streams<T, Q, I> const&, std::size_t, unsigned)
+	/// @see gtx_skinning
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_DECL void linearBlendSkinningParallel(mat<3, 4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count, unsigned threadCount);
+#	endif//GLM_HAS_CXX11_STL
+
+	/// @}
+}//namespace glm
+
+#include "skinning.inl"
@@ -0,0 +1,224 @@
+/// @ref gtx_skinning
+
+#if GLM_HAS_CXX11_STL
+#	include <algorithm>
+#	include <atomic>
+#	include <thread>
+#	include <vector>
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T>
+	struct stream_byte
+	{
+		typedef char type;
+	};
+
+	template<typename T>
+	struct stream_byte<T const>
+	{
+		typedef char const type;
+	};
+
+	// The results go through locals so that the outputs may alias the inputs
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_skinning
+	{
+		template<typename I, qualifier P>
+		GLM_FUNC_QUALIFIER static void dual_quaternion(
+			tdualquat<T, Q> const* bones, vec<4, I, P> const* indices, vec<4, T, Q> const* weights,
+			vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, std::size_t count,
+			vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals)
+		{
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				tdualquat<T, Q> const& First = bones[static_cast<std::size_t>(indices[i].x)];
+				tdualquat<T, Q> Blend = First * weights[i].x;
+				for(length_t k = 1; k < 4; ++k)
+				{
+					tdualquat<T, Q> const& Bone = bones[static_cast<std::size_t>(indices[i][k])];
+					Blend = Blend + Bone * (dot(First.real, Bone.real) < static_cast<T>(0) ? -weights[i][k] : weights[i][k]);
+				}
+				Blend = normalize(Blend);
+
+				vec<3, T, Q> const Position(Blend * positions[i]);
+				if(normals && outNormals)
+				{
+					vec<3, T, Q> const Normal(Blend.real * normals[i]);
+					outNormals[i] = Normal;
+				}
+				outPositions[i] = Position;
+			}
+		}
+
+		// The bones are held as three rows each, the vertices [first, last) are skinned
+		template<typename I>
+		GLM_FUNC_QUALIFIER static void linear_blend(vec<4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t first, std::size_t last)
+		{
+			bool const Positions = streams.positions.data && streams.outPositions.data;
+			bool const Normals = streams.normals.data && streams.outNormals.data;
+			bool const Tangents = streams.tangents.data && streams.outTangents.data;
+
+			for(std::size_t i = first; i < last; ++i)
+			{
+				I const* Index = &streams.indices[i];
+				T const* Weight = &streams.weights[i];
+
+				vec<4, T, Q> const* Bone = bones + 3 * static_cast<std::size_t>(Index[0]);
+				vec<4, T, Q> Row0(Bone[0] * Weight[0]);
+				vec<4, T, Q> Row1(Bone[1] * Weight[0]);
+				vec<4, T, Q> Row2(Bone[2] * Weight[0]);
+				for(length_t k = 1; k < streams.influences; ++k)
+				{
+					Bone = bones + 3 * static_cast<std::size_t>(Index[k]);
+					Row0 += Bone[0] * Weight[k];
+					Row1 += Bone[1] * Weight[k];
+					Row2 += Bone[2] * Weight[k];
+				}
+
+				if(Positions)
+				{
+					vec<4, T, Q> const Position(streams.positions[i], static_cast<T>(1));
+					streams.outPositions[i] = vec<3, T, Q>(dot(Row0, Position), dot(Row1, Position), dot(Row2, Position));
+				}
+				if(Normals)
+				{
+					vec<3, T, Q> const Normal(streams.normals[i]);
+					streams.outNormals[i] = vec<3, T, Q>(dot(vec<3, T, Q>(Row0), Normal), dot(vec<3, T, Q>(Row1), Normal), dot(vec<3, T, Q>(Row2), Normal));
+				}
+				if(Tangents)
+				{
+					vec<3, T, Q> const Tangent(streams.tangents[i]);
+					streams.outTangents[i] = vec<3, T, Q>(dot(vec<3, T, Q>(Row0), Tangent), dot(vec<3, T, Q>(Row1), Tangent), dot(vec<3, T, Q>(Row2), Tangent));
+				}
+			}
+		}
+	};
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linear_blend_skinning(vec<4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'linearBlendSkinning' only accept floating-point inputs");
+		GLM_STATIC_ASSERT(std::numeric_limits<I>::is_integer, "'linearBlendSkinning' only accept integer bone indices");
+		assert(streams.influences >= 1 && streams.influences <= 8);
+		assert(streams.indices.stride >= sizeof(I) * static_cast<std::size_t>(streams.influences));
+		assert(streams.weights.stride >= sizeof(T) * static_cast<std::size_t>(streams.influences));
+		compute_skinning<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::linear_blend(bones, streams, 0, count);
+	}
+
+#	if GLM_HAS_CXX11_STL
+	// Chunks of vertices taken from a shared counter, a multiple of the SIMD width
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linear_blend_chunks(vec<4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count, std::atomic<std::size_t>& next)
+	{
+		std::size_t const Chunk = 1024;
+		for(std::size_t First = next.fetch_add(Chunk); First < count; First = next.fetch_add(Chunk))
+			compute_skinning<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::linear_blend(bones, streams, First, std::min(First + Chunk, count));
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linear_blend_skinning_parallel(vec<4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count, unsigned threadCount)
+	{
+		if(threadCount <= 1)
+		{
+			linear_blend_skinning(bones, streams, count);
+			return;
+		}
+
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'linearBlendSkinningParallel' only accept floating-point inputs");
+		GLM_STATIC_ASSERT(std::numeric_limits<I>::is_integer, "'linearBlendSkinningParallel' only accept integer bone indices");
+		assert(streams.influences >= 1 && streams.influences <= 8);
+		assert(streams.indices.stride >= sizeof(I) * static_cast<std::size_t>(streams.influences));
+		assert(streams.weights.stride >= sizeof(T) * static_cast<std::size_t>(streams.influences));
+
+		std::atomic<std::size_t> Next(0);
+		std::vector<std::thread> Threads;
+		Threads.reserve(threadCount - 1);
+		for(unsigned t = 1; t < threadCount; ++t)
+			Threads.push_back(std::thread(linear_blend_chunks<T, Q, I>, bones, std::cref(streams), count, std::ref(Next)));
+
+		linear_blend_chunks(bones, streams, count, Next);
+
+		for(std::size_t t = 0; t < Threads.size(); ++t)
+			Threads[t].join();
+	}
+#	endif//GLM_HAS_CXX11_STL
+}//namespace detail
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vertex_stream<T>::vertex_stream()
+		: data(GLM_NULLPTR), stride(sizeof(T))
+	{}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vertex_stream<T>::vertex_stream(T* d)
+		: data(d), stride(sizeof(T))
+	{}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vertex_stream<T>::vertex_stream(T* d, std::size_t s)
+		: data(d), stride(s)
+	{}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER T& vertex_stream<T>::operator[](std::size_t i) const
+	{
+		typedef typename detail::stream_byte<T>::type byte;
+		return *reinterpret_cast<T*>(reinterpret_cast<byte*>(data) + i * stride);
+	}
+
+	template<typename T>
+	GLM_FUNC_QUALIFIER vertex_stream<T> influenceStream(T* data, length_t influences)
+	{
+		return vertex_stream<T>(data, sizeof(T) * static_cast<std::size_t>(influences));
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER skinning_streams<T, Q, I>::skinning_streams()
+		: influences(4)
+	{}
+
+	template<typename T, qualifier Q, typename I, qualifier P>
+	GLM_FUNC_QUALIFIER void dualQuaternionSkinning(
+		tdualquat<T, Q> const* bones, vec<4, I, P> const* indices, vec<4, T, Q> const* weights,
+		vec<3, T, Q> const* positions, vec<3, T, Q> const* normals, std::size_t count,
+		vec<3, T, Q>* outPositions, vec<3, T, Q>* outNormals)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'dualQuaternionSkinning' only accept floating-point inputs");
+		GLM_STATIC_ASSERT(std::numeric_limits<I>::is_integer, "'dualQuaternionSkinning' only accept integer bone indices");
+		detail::compute_skinning<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::dual_quaternion(bones, indices, weights, positions, normals, count, outPositions, outNormals);
+	}
+
+	// affine and mat3x4 both store the three rows of the transformation as vec4
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linearBlendSkinning(affine<T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count)
+	{
+		detail::linear_blend_skinning(&bones[0][0], streams, count);
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linearBlendSkinning(mat<3, 4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count)
+	{
+		detail::linear_blend_skinning(&bones[0][0], streams, count);
+	}
+
+#	if GLM_HAS_CXX11_STL
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linearBlendSkinningParallel(affine<T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count, unsigned threadCount)
+	{
+		detail::linear_blend_skinning_parallel(&bones[0][0], streams, count, threadCount);
+	}
+
+	template<typename T, qualifier Q, typename I>
+	GLM_FUNC_QUALIFIER void linearBlendSkinningParallel(mat<3, 4, T, Q> const* bones, skinning_streams<T, Q, I> const& streams, std::size_t count, unsigned threadCount)
+	{
+		detail::linear_blend_skinning_parallel(&bones[0][0], streams, count, threadCount);
+	}
+#	endif//GLM_HAS_CXX11_STL
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "skinning_simd.inl"
+#endif
@@ -0,0 +1,208 @@
+/// @ref gtx_skinning
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_skinning<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		// The bones of each influence are gathered with transposes into lanes of dual quaternion components,
+		// the remaining vertices are skinned one at a time
+		template<typename I, qualifier P>
+		GLM_FUNC_QUALIFIER static void dual_quaternion(
+			tdualquat<float, Q> const* bones, vec<4, I, P> const* indices, vec<4, float, Q> const* weights,
+			vec<3, float, Q> const* positions, vec<3, float, Q> const* normals, std::size_t count,
+			vec<3, float, Q>* outPositions, vec<3, float, Q>* outNormals)
+		{
+			bool const Normals = normals && outNormals;
+
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				float const* Weights[Width];
+				for(std::size_t j = 0; j < Width; ++j)
+					Weights[j] = reinterpret_cast<float const*>(weights + i + j);
+				lane W[4];
+				lane_gather(Weights, 0, W);
+
+				lane First[4], Real[4], Dual[4];
+				for(length_t k = 0; k < 4; ++k)
+				{
+					// The dual part follows the real part
+					float const* Bones[Width];
+					for(std::size_t j = 0; j < Width; ++j)
+						Bones[j] = reinterpret_cast<float const*>(bones + static_cast<std::size_t>(indices[i + j][k]));
+					lane BoneReal[4], BoneDual[4];
+					lane_gather(Bones, 0, BoneReal);
+					lane_gather(Bones, 4, BoneDual);
+
+					if(k == 0)
+					{
+						for(length_t c = 0; c < 4; ++c)
+						{
+							First[c] = BoneReal[c];
+							Real[c] = BoneReal[c] * W[0];
+							Dual[c] = BoneDual[c] * W[0];
+						}
+					}
+					else
+					{
+						lane const Weight = lane_select(lane_dot(First, BoneReal) < lane(0.0), -W[k], W[k]);
+						for(length_t c = 0; c < 4; ++c)
+						{
+							Real[c] = Real[c] + BoneReal[c] * Weight;
+							Dual[c] = Dual[c] + BoneDual[c] * Weight;
+						}
+					}
+				}
+
+				// The lanes hold the components x, y, z, w
+				lane const InvLength = lane_rsqrt(lane_dot(Real, Real));
+				lane const r[3] = {Real[0] * InvLength, Real[1] * InvLength, Real[2] * InvLength};
+				lane const d[3] = {Dual[0] * InvLength, Dual[1] * InvLength, Dual[2] * InvLength};
+				lane const rw = Real[3] * InvLength;
+				lane const dw = Dual[3] * InvLength;
+
+				// v + 2 * (r x (r x v + rw * v + d) + rw * d - dw * r)
+				lane v[3], t[3], u[3];
+				lane_load(positions, i, v);
+				lane_cross(r, v, t);
+				for(length_t c = 0; c < 3; ++c)
+					t[c] = t[c] + v[c] * rw + d[c];
+				lane_cross(r, t, u);
+				for(length_t c = 0; c < 3; ++c)
+					u[c] = (u[c] + d[c] * rw - r[c] * dw) * lane(2.0) + v[c];
+
+				if(Normals)
+				{
+					// n + 2 * r x (r x n + rw * n)
+					lane n[3], s[3], o[3];
+					lane_load(normals, i, n);
+					lane_cross(r, n, s);
+					for(length_t c = 0; c < 3; ++c)
+						s[c] = s[c] + n[c] * rw;
+					lane_cross(r, s, o);
+					for(length_t c = 0; c < 3; ++c)
+						o[c] = o[c] * lane(2.0) + n[c];
+					lane_store(o, i, outNormals);
+				}
+				lane_store(u, i, outPositions);
+			}
+
+			compute_skinning<float, Q, false>::dual_quaternion(bones, indices + i, weights + i, positions + i, Normals ? normals + i : normals, count - i, outPositions + i, Normals ? outNormals + i : outNormals);
+		}
+
+		// Gather or scatter the vec3 at the vertices [i, i + Width) of a stream into lanes of their components
+		GLM_FUNC_QUALIFIER static void load(vertex_stream<vec<3, float, Q> const> const& stream, std::size_t i, lane a[3])
+		{
+			float const* Vertices[Width];
+			for(std::size_t j = 0; j < Width; ++j)
+				Vertices[j] = &stream[i + j].x;
+			lane_gather(Vertices, 0, a[0]);
+			lane_gather(Vertices, 1, a[1]);
+			lane_gather(Vertices, 2, a[2]);
+		}
+
+		GLM_FUNC_QUALIFIER static void store(lane const a[3], std::size_t i, vertex_stream<vec<3, float, Q> > const& stream)
+		{
+			float* Vertices[Width];
+			for(std::size_t j = 0; j < Width; ++j)
+				Vertices[j] = &stream[i + j].x;
+			lane_scatter(a[0], 0, Vertices);
+			lane_scatter(a[1], 1, Vertices);
+			lane_scatter(a[2], 2, Vertices);
+		}
+
+		// Weighted sum of the rows of the bones of a vertex
+		template<typename I>
+		GLM_FUNC_QUALIFIER static void blend(vec<4, float, Q> const* bones, I const* indices, float const* weights, length_t influences, float rows[12])
+		{
+			float const* Bone = reinterpret_cast<float const*>(bones + 3 * static_cast<std::size_t>(indices[0]));
+			glm_vec4 Weight = _mm_set1_ps(weights[0]);
+			glm_vec4 Row0 = glm_vec4_mul(_mm_loadu_ps(Bone), Weight);
+			glm_vec4 Row1 = glm_vec4_mul(_mm_loadu_ps(Bone + 4), Weight);
+			glm_vec4 Row2 = glm_vec4_mul(_mm_loadu_ps(Bone + 8), Weight);
+			for(length_t k = 1; k < influences; ++k)
+			{
+				Bone = reinterpret_cast<float const*>(bones + 3 * static_cast<std::size_t>(indices[k]));
+				Weight = _mm_set1_ps(weights[k]);
+				Row0 = glm_vec4_fma(_mm_loadu_ps(Bone), Weight, Row0);
+				Row1 = glm_vec4_fma(_mm_loadu_ps(Bone + 4), Weight, Row1);
+				Row2 = glm_vec4_fma(_mm_loadu_ps(Bone + 8), Weight, Row2);
+			}
+			_mm_storeu_ps(rows, Row0);
+			_mm_storeu_ps(rows + 4, Row1);
+			_mm_storeu_ps(rows + 8, Row2);
+		}
+
+		// The blended rows of the vertices are transposed into lanes, the remaining vertices are skinned one at a time
+		template<typename I>
+		GLM_FUNC_QUALIFIER static void linear_blend(vec<4, float, Q> const* bones, skinning_streams<float, Q, I> const& streams, std::size_t first, std::size_t last)
+		{
+			bool const Positions = streams.positions.data && streams.outPositions.data;
+			bool const Normals = streams.normals.data && streams.outNormals.data;
+			bool const Tangents = streams.tangents.data && streams.outTangents.data;
+
+			std::size_t i = first;
+			for(; i + Width <= last; i += Width)
+			{
+				// The rows of each vertex are blended with one register per row, then transposed into lanes
+				float Blend[Width][12];
+				float const* Blends[Width];
+				for(std::size_t j = 0; j < Width; ++j)
+				{
+					blend(bones, &streams.indices[i + j], &streams.weights[i + j], streams.influences, Blend[j]);
+					Blends[j] = Blend[j];
+				}
+
+				// Null lanes for the skipped attributes
+				lane v[3], n[3], t[3];
+				for(length_t c = 0; c < 3; ++c)
+					v[c] = n[c] = t[c] = lane(0.0);
+				if(Positions)
+					load(streams.positions, i, v);
+				if(Normals)
+					load(streams.normals, i, n);
+				if(Tangents)
+					load(streams.tangents, i, t);
+
+				// Row[c] is the component c of the row r, the translation is c = 3
+				lane Position[3], Normal[3], Tangent[3];
+				for(length_t r = 0; r < 3; ++r)
+				{
+					lane Row[4];
+					lane_gather(Blends, static_cast<std::size_t>(r) * 4, Row);
+
+					if(Positions)
+						Position[r] = Row[0] * v[0] + Row[1] * v[1] + Row[2] * v[2] + Row[3];
+					if(Normals)
+						Normal[r] = Row[0] * n[0] + Row[1] * n[1] + Row[2] * n[2];
+					if(Tangents)
+						Tangent[r] = Row[0] * t[0] + Row[1] * t[1] + Row[2] * t[2];
+				}
+
+				if(Positions)
+					store(Position, i, streams.outPositions);
+				if(Normals)
+					store(Normal, i, streams.outNormals);
+				if(Tangents)
+					store(Tangent, i, streams.outTangents);
+			}
+
+			compute_skinning<float, Q, false>::linear_blend(bones, streams, i, last);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
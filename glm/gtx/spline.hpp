@@ -9,12 +9,22 @@
 /// Include <glm/gtx/spline.hpp> to use the features of this extension.
 ///
 /// Spline functions
+///
+/// cubic_spline stores the polynomial coefficients of each segment of a Catmull-Rom, Hermite or cubic curve,
+/// computed once, so that sampling a point or a derivative is a Horner evaluation of the coefficients.
+/// An arc length table maps distances along the curve to curve parameters, to sample the curve at uniform speed.
+/// For float and GLM_FORCE_INTRINSICS, four or eight parameters are evaluated at once, depending on SSE2 or AVX support,
+/// with fused multiply-adds when AVX2 is available.
 
 #pragma once
 
 // Dependency:
+#include <cstddef>
+#include <limits>
+#include <vector>
 #include "../glm.hpp"
 #include "../gtx/optimum_pow.hpp"
+#include "../detail/compute_lane.hpp"
 
 #if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
 #	ifndef GLM_ENABLE_EXPERIMENTAL
@@ -59,6 +69,72 @@ namespace glm
 		genType const& v4,
 		typename genType::value_type const& s);
 
+	/// Piecewise cubic curve of L components, segment i is evaluated for the parameters u in [i, i + 1].
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q = defaultp>
+	struct cubic_spline
+	{
+		typedef T value_type;
+
+		/// Coefficients a, b, c and d of p(s) = ((a * s + b) * s + c) * s + d, for component c of segment i at (i * L + c) * 4.
+		std::vector<T> coefficients;
+
+		/// Arc lengths at the parameters k / samples, with samples per segment, empty until buildSplineArcLengths.
+		std::vector<T> arcLengths;
+	};
+
+	/// Build the Catmull-Rom curve through count points, count - 1 segments, segment i is catmullRom(points[i - 1], points[i], points[i + 1], points[i + 2]).
+	/// The first and last points are repeated beyond the ends.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildCatmullRomSpline(cubic_spline<L, T, Q>& spline, vec<L, T, Q> const* points, std::size_t count);
+
+	/// Build the Hermite curve through count points with the tangents of the points, segment i is hermite(points[i], tangents[i], points[i + 1], tangents[i + 1]).
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildHermiteSpline(cubic_spline<L, T, Q>& spline, vec<L, T, Q> const* points, vec<L, T, Q> const* tangents, std::size_t count);
+
+	/// Build a curve of segments cubic(v[4 * i], v[4 * i + 1], v[4 * i + 2], v[4 * i + 3]).
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildCubicSpline(cubic_spline<L, T, Q>& spline, vec<L, T, Q> const* v, std::size_t segments);
+
+	/// Number of segments of a curve.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t splineSegments(cubic_spline<L, T, Q> const& spline);
+
+	/// Sample the points of a curve at count parameters, clamped to [0, splineSegments(spline)].
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void sampleSpline(cubic_spline<L, T, Q> const& spline, T const* u, std::size_t count, vec<L, T, Q>* out);
+
+	/// Sample the first derivatives by the parameter of a curve.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void sampleSplineDerivative(cubic_spline<L, T, Q> const& spline, T const* u, std::size_t count, vec<L, T, Q>* out);
+
+	/// Sample the second derivatives by the parameter of a curve.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void sampleSplineSecondDerivative(cubic_spline<L, T, Q> const& spline, T const* u, std::size_t count, vec<L, T, Q>* out);
+
+	/// Build the arc length table of a curve, with samples entries per segment integrated with a 5 point Gauss-Legendre rule.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void buildSplineArcLengths(cubic_spline<L, T, Q>& spline, std::size_t samples);
+
+	/// Length of a curve, requires buildSplineArcLengths.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL T splineLength(cubic_spline<L, T, Q> const& spline);
+
+	/// Parameters u of the points at count lengths along a curve, clamped to [0, splineLength(spline)], requires buildSplineArcLengths.
+	/// The parameter interpolated in the table is refined by two Newton steps.
+	/// @see gtx_spline
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_DECL void splineLengthToParameter(cubic_spline<L, T, Q> const& spline, T const* lengths, std::size_t count, T* u);
+
 	/// @}
 }//namespace glm
 
@@ -1,7 +1,92 @@
 /// @ref gtx_spline
 
-namespace glm
+#include <algorithm>
+
+namespace glm{
+namespace detail
 {
+	// Value, first or second derivative of the cubic of coefficients c at s, with Horner's scheme
+	template<typename V>
+	GLM_FUNC_QUALIFIER V lane_cubic(V const c[4], V const& s, int Order)
+	{
+		switch(Order)
+		{
+		case 0:
+			return lane_fma(lane_fma(lane_fma(c[0], s, c[1]), s, c[2]), s, c[3]);
+		case 1:
+			return lane_fma(lane_fma(c[0] * V(3), s, c[1] * V(2)), s, c[2]);
+		default:
+			return lane_fma(c[0] * V(6), s, c[1] * V(2));
+		}
+	}
+
+	// Segment of the parameter u clamped to the curve, and the parameter s in [0, 1] in the segment
+	template<typename T>
+	GLM_FUNC_QUALIFIER std::size_t spline_segment(T u, std::size_t Segments, T& s)
+	{
+		T const Clamped = clamp(u, static_cast<T>(0), static_cast<T>(Segments));
+		T const Segment = min(floor(Clamped), static_cast<T>(Segments - 1));
+		s = Clamped - Segment;
+		return static_cast<std::size_t>(Segment);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void spline_set_segment(cubic_spline<L, T, Q>& spline, std::size_t Segment, vec<L, T, Q> const& a, vec<L, T, Q> const& b, vec<L, T, Q> const& c, vec<L, T, Q> const& d)
+	{
+		for(length_t i = 0; i < L; ++i)
+		{
+			T* const Coefficients = &spline.coefficients[(Segment * L + i) * 4];
+			Coefficients[0] = a[i];
+			Coefficients[1] = b[i];
+			Coefficients[2] = c[i];
+			Coefficients[3] = d[i];
+		}
+	}
+
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_spline
+	{
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void sample(cubic_spline<L, T, Q> const& spline, int Order, T const* u, std::size_t count, vec<L, T, Q>* out)
+		{
+			std::size_t const Segments = splineSegments(spline);
+			for(std::size_t i = 0; i < count; ++i)
+			{
+				T s;
+				T const* const Coefficients = &spline.coefficients[spline_segment(u[i], Segments, s) * L * 4];
+				for(length_t c = 0; c < L; ++c)
+					out[i][c] = lane_cubic(Coefficients + c * 4, s, Order);
+			}
+		}
+	};
+
+	// Speed |p'(u)| integrated on [u0, u1] with the 5 point Gauss-Legendre rule, [u0, u1] in a segment
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T spline_arc_length(cubic_spline<L, T, Q> const& spline, T u0, T u1)
+	{
+		static T const Nodes[5] = {
+			static_cast<T>(0), static_cast<T>(-0.53846931010568309104), static_cast<T>(0.53846931010568309104),
+			static_cast<T>(-0.90617984593866399280), static_cast<T>(0.90617984593866399280)};
+		static T const Weights[5] = {
+			static_cast<T>(0.56888888888888888889), static_cast<T>(0.47862867049936646804), static_cast<T>(0.47862867049936646804),
+			static_cast<T>(0.23692688505618908751), static_cast<T>(0.23692688505618908751)};
+
+		T const Half = (u1 - u0) * static_cast<T>(0.5);
+		T const Middle = (u0 + u1) * static_cast<T>(0.5);
+
+		T u[5];
+		vec<L, T, Q> Derivatives[5];
+		for(std::size_t k = 0; k < 5; ++k)
+			u[k] = Middle + Half * Nodes[k];
+		compute_spline<T, Q, false>::sample(spline, 1, u, 5, Derivatives);
+
+		T Result = static_cast<T>(0);
+		for(std::size_t k = 0; k < 5; ++k)
+			Result += Weights[k] * length(Derivatives[k]);
+		return Result * Half;
+	}
+}//namespace detail
+
 	template<typename genType>
 	GLM_FUNC_QUALIFIER genType catmullRom
 	(
@@ -57,4 +142,152 @@ namespace glm
 	{
 		return ((v1 * s + v2) * s + v3) * s + v4;
 	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildCatmullRomSpline(cubic_spline<L, T, Q>& spline, vec<L, T, Q> const* points, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildCatmullRomSpline' only accept floating-point inputs");
+		assert(count > 1);
+
+		spline.coefficients.resize((count - 1) * L * 4);
+		spline.arcLengths.clear();
+		for(std::size_t i = 0; i + 1 < count; ++i)
+		{
+			vec<L, T, Q> const& v1 = points[i > 0 ? i - 1 : 0];
+			vec<L, T, Q> const& v2 = points[i];
+			vec<L, T, Q> const& v3 = points[i + 1];
+			vec<L, T, Q> const& v4 = points[i + 2 < count ? i + 2 : count - 1];
+			detail::spline_set_segment(spline, i,
+				(v4 - v1 + (v2 - v3) * static_cast<T>(3)) * static_cast<T>(0.5),
+				v1 - v2 * static_cast<T>(2.5) + v3 * static_cast<T>(2) - v4 * static_cast<T>(0.5),
+				(v3 - v1) * static_cast<T>(0.5),
+				v2);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildHermiteSpline(cubic_spline<L, T, Q>& spline, vec<L, T, Q> const* points, vec<L, T, Q> const* tangents, std::size_t count)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildHermiteSpline' only accept floating-point inputs");
+		assert(count > 1);
+
+		spline.coefficients.resize((count - 1) * L * 4);
+		spline.arcLengths.clear();
+		for(std::size_t i = 0; i + 1 < count; ++i)
+		{
+			vec<L, T, Q> const Delta = points[i + 1] - points[i];
+			detail::spline_set_segment(spline, i,
+				tangents[i] + tangents[i + 1] - Delta * static_cast<T>(2),
+				Delta * static_cast<T>(3) - tangents[i] * static_cast<T>(2) - tangents[i + 1],
+				tangents[i],
+				points[i]);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildCubicSpline(cubic_spline<L, T, Q>& spline, vec<L, T, Q> const* v, std::size_t segments)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'buildCubicSpline' only accept floating-point inputs");
+		assert(segments > 0);
+
+		spline.coefficients.resize(segments * L * 4);
+		spline.arcLengths.clear();
+		for(std::size_t i = 0; i < segments; ++i)
+			detail::spline_set_segment(spline, i, v[i * 4], v[i * 4 + 1], v[i * 4 + 2], v[i * 4 + 3]);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t splineSegments(cubic_spline<L, T, Q> const& spline)
+	{
+		return spline.coefficients.size() / (L * 4);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sampleSpline(cubic_spline<L, T, Q> const& spline, T const* u, std::size_t count, vec<L, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sampleSpline' only accept floating-point inputs");
+		assert(splineSegments(spline) > 0);
+		detail::compute_spline<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::sample(spline, 0, u, count, out);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sampleSplineDerivative(cubic_spline<L, T, Q> const& spline, T const* u, std::size_t count, vec<L, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sampleSplineDerivative' only accept floating-point inputs");
+		assert(splineSegments(spline) > 0);
+		detail::compute_spline<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::sample(spline, 1, u, count, out);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void sampleSplineSecondDerivative(cubic_spline<L, T, Q> const& spline, T const* u, std::size_t count, vec<L, T, Q>* out)
+	{
+		GLM_STATIC_ASSERT(std::numeric_limits<T>::is_iec559, "'sampleSplineSecondDerivative' only accept floating-point inputs");
+		assert(splineSegments(spline) > 0);
+		detail::compute_spline<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::sample(spline, 2, u, count, out);
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void buildSplineArcLengths(cubic_spline<L, T, Q>& spline, std::size_t samples)
+	{
+		assert(samples > 0);
+
+		std::size_t const Count = splineSegments(spline) * samples;
+		T const Step = static_cast<T>(1) / static_cast<T>(samples);
+
+		spline.arcLengths.resize(Count + 1);
+		spline.arcLengths[0] = static_cast<T>(0);
+		for(std::size_t k = 0; k < Count; ++k)
+		{
+			std::size_t const Segment = k / samples;
+			T const u0 = static_cast<T>(Segment) + static_cast<T>(k % samples) * Step;
+			T const u1 = k % samples + 1 == samples ? static_cast<T>(Segment + 1) : u0 + Step;
+			spline.arcLengths[k + 1] = spline.arcLengths[k] + detail::spline_arc_length(spline, u0, u1);
+		}
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER T splineLength(cubic_spline<L, T, Q> const& spline)
+	{
+		assert(!spline.arcLengths.empty());
+		return spline.arcLengths.back();
+	}
+
+	template<length_t L, typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void splineLengthToParameter(cubic_spline<L, T, Q> const& spline, T const* lengths, std::size_t count, T* u)
+	{
+		assert(splineSegments(spline) > 0);
+		assert(!spline.arcLengths.empty());
+
+		std::vector<T> const& Table = spline.arcLengths;
+		std::size_t const Samples = (Table.size() - 1) / splineSegments(spline);
+		T const Step = static_cast<T>(1) / static_cast<T>(Samples);
+
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			T const Length = clamp(lengths[i], static_cast<T>(0), Table.back());
+			std::size_t const Upper = static_cast<std::size_t>(std::upper_bound(Table.begin(), Table.end(), Length) - Table.begin());
+			std::size_t const k = min(Upper - 1, Table.size() - 2);
+
+			T const u0 = static_cast<T>(k / Samples) + static_cast<T>(k % Samples) * Step;
+			T const u1 = u0 + Step;
+			T const Interval = Table[k + 1] - Table[k];
+			T Result = Interval > static_cast<T>(0) ? u0 + Step * (Length - Table[k]) / Interval : u0;
+
+			for(int Newton = 0; Newton < 2; ++Newton)
+			{
+				vec<L, T, Q> Derivative;
+				detail::compute_spline<T, Q, false>::sample(spline, 1, &Result, 1, &Derivative);
+				T const Speed = length(Derivative);
+				if(Speed <= std::numeric_limits<T>::epsilon())
+					break;
+				T const Error = Table[k] + detail::spline_arc_length(spline, u0, Result) - Length;
+				Result = clamp(Result - Error / Speed, u0, u1);
+			}
+			u[i] = Result;
+		}
+	}
 }//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "spline_simd.inl"
+#endif
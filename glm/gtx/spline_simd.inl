@@ -0,0 +1,58 @@
+/// @ref gtx_spline
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+namespace glm{
+namespace detail
+{
+	// The segments are found in lanes, the coefficients of each component are gathered as the four floats a, b, c and d
+	// of the segments and evaluated in lanes. The remaining parameters are sampled by the generic path.
+	template<qualifier Q>
+	struct compute_spline<float, Q, true>
+	{
+#		if GLM_ARCH & GLM_ARCH_AVX_BIT
+			typedef lane8 lane;
+			static std::size_t const Width = 8;
+#		else
+			typedef lane4 lane;
+			static std::size_t const Width = 4;
+#		endif
+
+		template<length_t L>
+		GLM_FUNC_QUALIFIER static void sample(cubic_spline<L, float, Q> const& spline, int Order, float const* u, std::size_t count, vec<L, float, Q>* out)
+		{
+			std::size_t const Segments = splineSegments(spline);
+			lane const Last(static_cast<double>(Segments - 1));
+			lane const End(static_cast<double>(Segments));
+
+			std::size_t i = 0;
+			for(; i + Width <= count; i += Width)
+			{
+				lane Parameter;
+				lane_load(u, i, Parameter);
+				Parameter = lane_min(lane_max(Parameter, lane(0.0)), End);
+				lane const Segment = lane_min(lane_floor(Parameter), Last);
+				lane const s = Parameter - Segment;
+
+				float Indices[Width];
+				float const* Coefficients[Width];
+				lane_store(Segment, 0, Indices);
+				for(std::size_t j = 0; j < Width; ++j)
+					Coefficients[j] = &spline.coefficients[static_cast<std::size_t>(Indices[j]) * L * 4];
+
+				lane Result[L];
+				for(length_t c = 0; c < L; ++c)
+				{
+					lane Cubic[4];
+					lane_gather(Coefficients, static_cast<std::size_t>(c) * 4, Cubic);
+					Result[c] = lane_cubic(Cubic, s, Order);
+				}
+				lane_store(Result, i, out);
+			}
+			compute_spline<float, Q, false>::sample(spline, Order, u + i, count - i, out + i);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
@@ -0,0 +1,93 @@
+/// @ref gtx_transform_hierarchy
+/// @file glm/gtx/transform_hierarchy.hpp
+///
+/// @see core (dependence)
+/// @see gtx_affine (dependence)
+///
+/// @defgroup gtx_transform_hierarchy GLM_GTX_transform_hierarchy
+/// @ingroup gtx
+///
+/// Include <glm/gtx/transform_hierarchy.hpp> to use the features of this extension.
+///
+/// Propagate local transformations to world transformations over a hierarchy stored as an array of parent indices:
+/// world[i] = world[parents[i]] * local[i], or world[i] = local[i] for the roots, which have a negative parent index.
+/// The nodes must be topologically sorted: parents[i] < i.
+
+#pragma once
+
+// Dependency:
+#include <cstddef>
+#include <vector>
+#include "../glm.hpp"
+#include "../ext/scalar_int_sized.hpp"
+#include "../ext/scalar_uint_sized.hpp"
+#include "../gtx/affine.hpp"
+
+#if GLM_MESSAGES == GLM_ENABLE && !defined(GLM_EXT_INCLUDED)
+#	ifndef GLM_ENABLE_EXPERIMENTAL
+#		pragma message("GLM: GLM_GTX_transform_hierarchy is an experimental extension and may change in the future. Use #define GLM_ENABLE_EXPERIMENTAL before including it, if you really want to use it.")
+#	elif
+#		pragma message("GLM: GLM_GTX_transform_hierarchy extension included")
+#	endif
+#endif
+
+namespace glm
+{
+	/// @addtogroup gtx_transform_hierarchy
+	/// @{
+
+	/// Compute the world transformations of count nodes.
+	/// The products use the SIMD 4x4 matrix kernel for float, whatever the qualifier, when GLM_FORCE_INTRINSICS is enabled.
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void propagateTransforms(int32 const* parents, mat<4, 4, T, Q> const* locals, std::size_t count, mat<4, 4, T, Q>* worlds);
+
+	/// Compute the world affine transformations of count nodes.
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void propagateTransforms(int32 const* parents, affine<T, Q> const* locals, std::size_t count, affine<T, Q>* worlds);
+
+	/// Recompute the world transformations of the nodes whose local transformation changed and of their descendants.
+	/// Bit i % 32 of dirty[i / 32] flags node i, dirty must hold (count + 31) / 32 words.
+	/// On return the bits of all the recomputed nodes are set, clearing them is left to the caller.
+	/// Return the number of recomputed nodes.
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t propagateTransforms(int32 const* parents, mat<4, 4, T, Q> const* locals, std::size_t count, uint32* dirty, mat<4, 4, T, Q>* worlds);
+
+	/// Recompute the world affine transformations of the nodes whose local transformation changed and of their descendants.
+	/// @see propagateTransforms(int32 const*, mat<4, 4, T, Q> const*, std::size_t, uint32*, mat<4, 4, T, Q>*)
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL std::size_t propagateTransforms(int32 const* parents, affine<T, Q> const* locals, std::size_t count, uint32* dirty, affine<T, Q>* worlds);
+
+	/// Compute the ranges of nodes of each depth for a hierarchy sorted breadth first, nodes with a larger depth never come first.
+	/// Level l is [levelOffsets[l], levelOffsets[l + 1]), levelOffsets holds the level count plus one entries.
+	/// Return false and leave levelOffsets empty if the nodes are not sorted by depth.
+	/// @see gtx_transform_hierarchy
+	GLM_FUNC_DECL bool transformHierarchyLevels(int32 const* parents, std::size_t count, std::vector<std::size_t>& levelOffsets);
+
+#	if GLM_HAS_CXX11_STL
+	/// Compute the world transformations of a hierarchy sorted breadth first with threadCount threads, including the calling thread.
+	/// Each level, as computed by transformHierarchyLevels, is split across the threads which synchronize before the next level.
+	/// When dirty is not null only the flagged nodes and their descendants are recomputed, as by the sequential incremental update.
+	/// The threads and the barrier are created on each call, a thread pool can instead split the levels of transformHierarchyLevels across its workers.
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void propagateTransformsParallel(
+		int32 const* parents, mat<4, 4, T, Q> const* locals, std::vector<std::size_t> const& levelOffsets,
+		uint32* dirty, mat<4, 4, T, Q>* worlds, unsigned threadCount);
+
+	/// Compute the world affine transformations of a hierarchy sorted breadth first with threadCount threads, including the calling thread.
+	/// @see propagateTransformsParallel(int32 const*, mat<4, 4, T, Q> const*, std::vector<std::size_t> const&, uint32*, mat<4, 4, T, Q>*, unsigned)
+	/// @see gtx_transform_hierarchy
+	template<typename T, qualifier Q>
+	GLM_FUNC_DECL void propagateTransformsParallel(
+		int32 const* parents, affine<T, Q> const* locals, std::vector<std::size_t> const& levelOffsets,
+		uint32* dirty, affine<T, Q>* worlds, unsigned threadCount);
+#	endif//GLM_HAS_CXX11_STL
+
+	/// @}
+}//namespace glm
+
+#include "transform_hierarchy.inl"
@@ -0,0 +1,260 @@
+/// @ref gtx_transform_hierarchy
+
+#if GLM_HAS_CXX11_STL
+#	include <atomic>
+#	include <thread>
+#endif
+
+namespace glm{
+namespace detail
+{
+	template<typename T, qualifier Q, bool UseSimd>
+	struct compute_hierarchy_mul
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, T, Q> const& parent, mat<4, 4, T, Q> const& local, mat<4, 4, T, Q>& world)
+		{
+			world = parent * local;
+		}
+	};
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hierarchy_mul(mat<4, 4, T, Q> const& parent, mat<4, 4, T, Q> const& local, mat<4, 4, T, Q>& world)
+	{
+		compute_hierarchy_mul<T, Q, GLM_CONFIG_SIMD == GLM_ENABLE>::call(parent, local, world);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void hierarchy_mul(affine<T, Q> const& parent, affine<T, Q> const& local, affine<T, Q>& world)
+	{
+		world = parent * local;
+	}
+
+	// Compute the nodes [first, last), only the flagged ones and the children of flagged ones if dirty is not null
+	template<typename matType>
+	GLM_FUNC_QUALIFIER std::size_t propagate_nodes(int32 const* parents, matType const* locals, std::size_t first, std::size_t last, uint32* dirty, matType* worlds)
+	{
+		if(dirty == GLM_NULLPTR)
+		{
+			for(std::size_t i = first; i < last; ++i)
+			{
+				int32 const Parent = parents[i];
+				if(Parent < 0)
+					worlds[i] = locals[i];
+				else
+					hierarchy_mul(worlds[Parent], locals[i], worlds[i]);
+			}
+			return last - first;
+		}
+
+		std::size_t Updated = 0;
+		for(std::size_t i = first; i < last; ++i)
+		{
+			int32 const Parent = parents[i];
+			uint32 const Flag = (dirty[i >> 5] >> (i & 31)) & 1u;
+			uint32 const ParentFlag = Parent < 0 ? 0u : (dirty[static_cast<std::size_t>(Parent) >> 5] >> (Parent & 31)) & 1u;
+			if((Flag | ParentFlag) == 0u)
+				continue;
+
+			dirty[i >> 5] |= 1u << (i & 31);
+			if(Parent < 0)
+				worlds[i] = locals[i];
+			else
+				hierarchy_mul(worlds[Parent], locals[i], worlds[i]);
+			++Updated;
+		}
+		return Updated;
+	}
+
+#	if GLM_HAS_CXX11_STL
+	// Reusable spinning barrier, the threads only wait for the other threads of the same level
+	class hierarchy_barrier
+	{
+	public:
+		explicit hierarchy_barrier(unsigned count) : Count(count), Waiting(0), Generation(0)
+		{}
+
+		void wait()
+		{
+			unsigned const Current = Generation.load(std::memory_order_acquire);
+			if(Waiting.fetch_add(1, std::memory_order_acq_rel) + 1 == Count)
+			{
+				Waiting.store(0, std::memory_order_relaxed);
+				Generation.fetch_add(1, std::memory_order_release);
+			}
+			else while(Generation.load(std::memory_order_acquire) == Current)
+				std::this_thread::yield();
+		}
+
+	private:
+		unsigned const Count;
+		std::atomic<unsigned> Waiting;
+		std::atomic<unsigned> Generation;
+	};
+
+	// Same as propagate_nodes with a byte per node instead of a bit: the threads of a level write the flags of their own nodes
+	// and read the flags of the parents, written during the previous level, so they never access a memory location written by another thread
+	template<typename matType>
+	GLM_FUNC_QUALIFIER void propagate_flagged_nodes(int32 const* parents, matType const* locals, std::size_t first, std::size_t last, uint8* flags, matType* worlds)
+	{
+		for(std::size_t i = first; i < last; ++i)
+		{
+			int32 const Parent = parents[i];
+			if(Parent >= 0)
+				flags[i] |= flags[Parent];
+			if(flags[i] == 0)
+				continue;
+
+			if(Parent < 0)
+				worlds[i] = locals[i];
+			else
+				hierarchy_mul(worlds[Parent], locals[i], worlds[i]);
+		}
+	}
+
+	// Share of thread of each level, the whole level when flags is null
+	template<typename matType>
+	GLM_FUNC_QUALIFIER void propagate_levels(
+		int32 const* parents, matType const* locals, std::vector<std::size_t> const& levelOffsets,
+		uint8* flags, matType* worlds, unsigned thread, unsigned threadCount, hierarchy_barrier& barrier)
+	{
+		std::size_t const Grain = 256;
+
+		for(std::size_t l = 0; l + 1 < levelOffsets.size(); ++l)
+		{
+			std::size_t const First = levelOffsets[l];
+			std::size_t const Last = levelOffsets[l + 1];
+			std::size_t Chunk = (Last - First + threadCount - 1) / threadCount;
+			Chunk = Chunk < Grain ? Grain : Chunk;
+
+			std::size_t const Begin = First + thread * Chunk;
+			std::size_t const End = Begin + Chunk < Last ? Begin + Chunk : Last;
+			if(Begin < End)
+			{
+				if(flags == GLM_NULLPTR)
+					propagate_nodes(parents, locals, Begin, End, static_cast<uint32*>(GLM_NULLPTR), worlds);
+				else
+					propagate_flagged_nodes(parents, locals, Begin, End, flags, worlds);
+			}
+
+			barrier.wait();
+		}
+	}
+
+	template<typename matType>
+	GLM_FUNC_QUALIFIER void propagate_parallel(
+		int32 const* parents, matType const* locals, std::vector<std::size_t> const& levelOffsets,
+		uint32* dirty, matType* worlds, unsigned threadCount)
+	{
+		if(levelOffsets.empty())
+			return;
+
+		if(threadCount <= 1)
+		{
+			propagate_nodes(parents, locals, 0, levelOffsets.back(), dirty, worlds);
+			return;
+		}
+
+		// The threads update byte flags, the dirty bits are only read before and written after the threads run
+		std::size_t const Count = levelOffsets.back();
+		std::vector<uint8> Flags(dirty == GLM_NULLPTR ? 0 : Count);
+		for(std::size_t i = 0; i < Flags.size(); ++i)
+			Flags[i] = static_cast<uint8>((dirty[i >> 5] >> (i & 31)) & 1u);
+		uint8* const FlagData = Flags.empty() ? GLM_NULLPTR : &Flags[0];
+
+		hierarchy_barrier Barrier(threadCount);
+		std::vector<std::thread> Threads;
+		Threads.reserve(threadCount - 1);
+		for(unsigned t = 1; t < threadCount; ++t)
+			Threads.push_back(std::thread(propagate_levels<matType>, parents, locals, std::cref(levelOffsets), FlagData, worlds, t, threadCount, std::ref(Barrier)));
+
+		propagate_levels(parents, locals, levelOffsets, FlagData, worlds, 0, threadCount, Barrier);
+
+		for(std::size_t t = 0; t < Threads.size(); ++t)
+			Threads[t].join();
+
+		for(std::size_t i = 0; i < Flags.size(); ++i)
+			dirty[i >> 5] |= static_cast<uint32>(Flags[i]) << (i & 31);
+	}
+#	endif//GLM_HAS_CXX11_STL
+}//namespace detail
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void propagateTransforms(int32 const* parents, mat<4, 4, T, Q> const* locals, std::size_t count, mat<4, 4, T, Q>* worlds)
+	{
+		detail::propagate_nodes(parents, locals, 0, count, static_cast<uint32*>(GLM_NULLPTR), worlds);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void propagateTransforms(int32 const* parents, affine<T, Q> const* locals, std::size_t count, affine<T, Q>* worlds)
+	{
+		detail::propagate_nodes(parents, locals, 0, count, static_cast<uint32*>(GLM_NULLPTR), worlds);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t propagateTransforms(int32 const* parents, mat<4, 4, T, Q> const* locals, std::size_t count, uint32* dirty, mat<4, 4, T, Q>* worlds)
+	{
+		assert(dirty != GLM_NULLPTR);
+		return detail::propagate_nodes(parents, locals, 0, count, dirty, worlds);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER std::size_t propagateTransforms(int32 const* parents, affine<T, Q> const* locals, std::size_t count, uint32* dirty, affine<T, Q>* worlds)
+	{
+		assert(dirty != GLM_NULLPTR);
+		return detail::propagate_nodes(parents, locals, 0, count, dirty, worlds);
+	}
+
+	GLM_FUNC_QUALIFIER bool transformHierarchyLevels(int32 const* parents, std::size_t count, std::vector<std::size_t>& levelOffsets)
+	{
+		levelOffsets.clear();
+		if(count == 0)
+			return true;
+
+		std::vector<uint32> Depths(count);
+		levelOffsets.push_back(0);
+		for(std::size_t i = 0; i < count; ++i)
+		{
+			int32 const Parent = parents[i];
+			if(Parent >= 0 && static_cast<std::size_t>(Parent) >= i)
+			{
+				levelOffsets.clear();
+				return false;
+			}
+
+			Depths[i] = Parent < 0 ? 0u : Depths[Parent] + 1u;
+			uint32 const Previous = i == 0 ? 0u : Depths[i - 1];
+			if(Depths[i] < Previous)
+			{
+				levelOffsets.clear();
+				return false;
+			}
+			if(Depths[i] > Previous)
+				levelOffsets.push_back(i);
+		}
+		levelOffsets.push_back(count);
+
+		return true;
+	}
+
+#	if GLM_HAS_CXX11_STL
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void propagateTransformsParallel(
+		int32 const* parents, mat<4, 4, T, Q> const* locals, std::vector<std::size_t> const& levelOffsets,
+		uint32* dirty, mat<4, 4, T, Q>* worlds, unsigned threadCount)
+	{
+		detail::propagate_parallel(parents, locals, levelOffsets, dirty, worlds, threadCount);
+	}
+
+	template<typename T, qualifier Q>
+	GLM_FUNC_QUALIFIER void propagateTransformsParallel(
+		int32 const* parents, affine<T, Q> const* locals, std::vector<std::size_t> const& levelOffsets,
+		uint32* dirty, affine<T, Q>* worlds, unsigned threadCount)
+	{
+		detail::propagate_parallel(parents, locals, levelOffsets, dirty, worlds, threadCount);
+	}
+#	endif//GLM_HAS_CXX11_STL
+}//namespace glm
+
+#if GLM_CONFIG_SIMD == GLM_ENABLE
+#	include "transform_hierarchy_simd.inl"
+#endif
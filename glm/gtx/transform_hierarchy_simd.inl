@@ -0,0 +1,28 @@
+/// @ref gtx_transform_hierarchy
+
+#if GLM_ARCH & GLM_ARCH_SSE2_BIT
+
+#include "../simd/matrix.h"
+
+namespace glm{
+namespace detail
+{
+	template<qualifier Q>
+	struct compute_hierarchy_mul<float, Q, true>
+	{
+		GLM_FUNC_QUALIFIER static void call(mat<4, 4, float, Q> const& parent, mat<4, 4, float, Q> const& local, mat<4, 4, float, Q>& world)
+		{
+			glm_vec4 const a[4] = {_mm_loadu_ps(&parent[0].x), _mm_loadu_ps(&parent[1].x), _mm_loadu_ps(&parent[2].x), _mm_loadu_ps(&parent[3].x)};
+			glm_vec4 const b[4] = {_mm_loadu_ps(&local[0].x), _mm_loadu_ps(&local[1].x), _mm_loadu_ps(&local[2].x), _mm_loadu_ps(&local[3].x)};
+			glm_vec4 c[4];
+			glm_mat4_mul(a, b, c);
+			_mm_storeu_ps(&world[0].x, c[0]);
+			_mm_storeu_ps(&world[1].x, c[1]);
+			_mm_storeu_ps(&world[2].x, c[2]);
+			_mm_storeu_ps(&world[3].x, c[3]);
+		}
+	};
+}//namespace detail
+}//namespace glm
+
+#endif//GLM_ARCH & GLM_ARCH_SSE2_BIT
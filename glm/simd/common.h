@@ -196,6 +196,16 @@ GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_mix(glm_vec4 v1, glm_vec4 v2, glm_vec4 a)
 	return mad0;
 }
 
+// Per component 'mask ? a : b', mask components being all ones or all zeros
+GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_select(glm_vec4 mask, glm_vec4 a, glm_vec4 b)
+{
+#	if GLM_ARCH & GLM_ARCH_SSE41_BIT
+		return _mm_blendv_ps(b, a, mask);
+#	else
+		return _mm_or_ps(_mm_and_ps(mask, a), _mm_andnot_ps(mask, b));
+#	endif
+}
+
 GLM_FUNC_QUALIFIER glm_vec4 glm_vec4_step(glm_vec4 edge, glm_vec4 x)
 {
 	glm_vec4 const cmp = _mm_cmple_ps(x, edge);
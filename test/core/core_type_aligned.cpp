@@ -1,5 +1,6 @@
 #define GLM_FORCE_DEFAULT_ALIGNED_GENTYPES
 #include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
 
 #if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
 #include <type_traits>
@@ -76,6 +77,29 @@ static int test_vec3_aligned()
 	return Error;
 }
 
+static int test_mat4_mul_aligned()
+{
+	typedef glm::mat<4, 4, float, glm::packed_highp> packed_mat4;
+
+	int Error = 0;
+
+	glm::mat4 A, B;
+	packed_mat4 PackedA, PackedB;
+	for(glm::length_t c = 0; c < 4; ++c)
+	for(glm::length_t r = 0; r < 4; ++r)
+	{
+		A[c][r] = PackedA[c][r] = static_cast<float>((c * 4 + r) % 5) - 1.5f;
+		B[c][r] = PackedB[c][r] = static_cast<float>((c + r * 3) % 7) * 0.5f;
+	}
+
+	glm::mat4 const Aligned = A * B;
+	packed_mat4 const Packed = PackedA * PackedB;
+	for(glm::length_t c = 0; c < 4; ++c)
+		Error += glm::all(glm::equal(packed_mat4(Aligned)[c], Packed[c], 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
 #endif
 
 int main()
@@ -86,6 +110,7 @@ int main()
 		Error += test_storage_aligned();
 		Error += test_storage_unaligned();
 		Error += test_vec3_aligned();
+		Error += test_mat4_mul_aligned();
 #	endif
 
 	return Error;
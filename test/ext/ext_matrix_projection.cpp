@@ -1,13 +1,157 @@
 #include <glm/ext/matrix_relational.hpp>
 #include <glm/ext/matrix_projection.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
 #include <glm/ext/matrix_float4x4.hpp>
 #include <glm/ext/vector_relational.hpp>
 #include <glm/ext/vector_float4.hpp>
 #include <glm/ext/vector_float3.hpp>
+#include <glm/ext/vector_int4.hpp>
+#include <vector>
+
+static int test_projector_project()
+{
+	int Error = 0;
+
+	glm::mat4 const Model = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(0.5f, -1.0f, -6.0f)), 0.7f, glm::vec3(0.0f, 1.0f, 0.0f));
+	glm::ivec4 const Viewport(10, 20, 640, 480);
+
+	std::vector<glm::vec3> Obj;
+	for(int i = 0; i < 23; ++i)
+		Obj.push_back(glm::vec3(static_cast<float>(i % 5) - 2.0f, static_cast<float>(i % 3) - 1.0f, static_cast<float>(i % 7) * 0.5f - 1.5f));
+
+	// Zero to one
+	{
+		glm::mat4 const Proj = glm::perspectiveZO(glm::radians(60.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+		glm::projector<float> const P = glm::makeProjectorZO(Model, Proj, Viewport);
+
+		std::vector<glm::vec3> Win(Obj.size());
+		glm::project(P, &Obj[0], &Win[0], Obj.size());
+
+		for(std::size_t i = 0; i < Obj.size(); ++i)
+		{
+			glm::vec3 const Expected = glm::projectZO(Obj[i], Model, Proj, Viewport);
+			Error += glm::all(glm::equal(glm::project(P, Obj[i]), Expected, glm::vec3(0.01f, 0.01f, 0.0001f))) ? 0 : 1;
+			Error += glm::all(glm::equal(Win[i], Expected, glm::vec3(0.01f, 0.01f, 0.0001f))) ? 0 : 1;
+		}
+	}
+
+	// Negative one to one
+	{
+		glm::mat4 const Proj = glm::perspectiveNO(glm::radians(60.0f), 4.0f / 3.0f, 0.1f, 100.0f);
+		glm::projector<float> const P = glm::makeProjectorNO(Model, Proj, Viewport);
+
+		std::vector<glm::vec3> Win(Obj);
+		glm::project(P, &Win[0], &Win[0], Win.size());
+
+		for(std::size_t i = 0; i < Obj.size(); ++i)
+		{
+			glm::vec3 const Expected = glm::projectNO(Obj[i], Model, Proj, Viewport);
+			Error += glm::all(glm::equal(glm::project(P, Obj[i]), Expected, glm::vec3(0.01f, 0.01f, 0.0001f))) ? 0 : 1;
+			Error += glm::all(glm::equal(Win[i], Expected, glm::vec3(0.01f, 0.01f, 0.0001f))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_projector_unProject()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	mat4 const Model = glm::translate(mat4(static_cast<T>(1)), vec3(static_cast<T>(1), static_cast<T>(2), static_cast<T>(-5)));
+	vec4 const Viewport(static_cast<T>(0), static_cast<T>(0), static_cast<T>(37), static_cast<T>(5));
+
+	std::vector<vec3> Win;
+	for(int i = 0; i < 19; ++i)
+		Win.push_back(vec3(static_cast<T>(i * 2) + static_cast<T>(0.5), static_cast<T>(i % 5), static_cast<T>(i) / static_cast<T>(20)));
+
+	for(int Mode = 0; Mode < 2; ++Mode)
+	{
+		mat4 const Proj = Mode == 0
+			? glm::perspectiveZO(static_cast<T>(1), static_cast<T>(37) / static_cast<T>(5), static_cast<T>(0.5), static_cast<T>(50))
+			: glm::perspectiveNO(static_cast<T>(1), static_cast<T>(37) / static_cast<T>(5), static_cast<T>(0.5), static_cast<T>(50));
+		glm::projector<T> const P = Mode == 0
+			? glm::makeProjectorZO(Model, Proj, Viewport)
+			: glm::makeProjectorNO(Model, Proj, Viewport);
+
+		std::vector<vec3> Obj(Win.size());
+		glm::unProject(P, &Win[0], &Obj[0], Win.size());
+
+		std::vector<T> Depth(Win.size());
+		for(std::size_t i = 0; i < Win.size(); ++i)
+			Depth[i] = Win[i].z;
+
+		// 19 pixels wide, one row
+		std::vector<vec3> Buffer(Depth.size());
+		glm::unProjectDepth(P, &Depth[0], Depth.size(), 1, &Buffer[0]);
+
+		for(std::size_t i = 0; i < Win.size(); ++i)
+		{
+			vec3 const Expected = Mode == 0
+				? glm::unProjectZO(Win[i], Model, Proj, Viewport)
+				: glm::unProjectNO(Win[i], Model, Proj, Viewport);
+			vec3 const Epsilon(static_cast<T>(0.001) * (static_cast<T>(1) + glm::abs(Expected.z)));
+
+			Error += glm::all(glm::equal(glm::unProject(P, Win[i]), Expected, Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::equal(Obj[i], Expected, Epsilon)) ? 0 : 1;
+
+			vec3 const Pixel(static_cast<T>(i) + static_cast<T>(0.5), static_cast<T>(0.5), Depth[i]);
+			vec3 const ExpectedPixel = Mode == 0
+				? glm::unProjectZO(Pixel, Model, Proj, Viewport)
+				: glm::unProjectNO(Pixel, Model, Proj, Viewport);
+			Error += glm::all(glm::equal(Buffer[i], ExpectedPixel, Epsilon)) ? 0 : 1;
+
+			// Round trip
+			Error += glm::all(glm::equal(glm::project(P, Obj[i]), Win[i], static_cast<T>(0.001))) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+static int test_projector_unProjectDepth()
+{
+	int Error = 0;
+
+	glm::mat4 const Model(1.0f);
+	glm::mat4 const Proj = glm::perspective(glm::radians(45.0f), 1.0f, 1.0f, 10.0f);
+	glm::vec4 const Viewport(4.0f, 8.0f, 13.0f, 7.0f);
+	glm::projector<float> const P = glm::makeProjector(Model, Proj, Viewport);
+
+	std::size_t const Width = 13;
+	std::size_t const Height = 7;
+	std::vector<float> Depth(Width * Height);
+	for(std::size_t i = 0; i < Depth.size(); ++i)
+		Depth[i] = static_cast<float>(i % 11) / 11.0f;
+
+	std::vector<glm::vec3> Obj(Width * Height);
+	glm::unProjectDepth(P, &Depth[0], Width, Height, &Obj[0]);
+
+	for(std::size_t j = 0; j < Height; ++j)
+	for(std::size_t i = 0; i < Width; ++i)
+	{
+		glm::vec3 const Win(Viewport.x + static_cast<float>(i) + 0.5f, Viewport.y + static_cast<float>(j) + 0.5f, Depth[j * Width + i]);
+		glm::vec3 const Expected = glm::unProject(Win, Model, Proj, Viewport);
+		Error += glm::all(glm::equal(Obj[j * Width + i], Expected, 0.001f * (1.0f + glm::abs(Expected.z)))) ? 0 : 1;
+	}
+
+	return Error;
+}
 
 int main()
 {
 	int Error = 0;
 
+	Error += test_projector_project();
+	Error += test_projector_unProject<float>();
+	Error += test_projector_unProject<double>();
+	Error += test_projector_unProjectDepth();
+
 	return Error;
 }
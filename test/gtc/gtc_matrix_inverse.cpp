@@ -1,5 +1,7 @@
 #include <glm/gtc/matrix_inverse.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
 
 int test_affine()
 {
@@ -41,11 +43,110 @@ int test_affine()
 	return Error;
 }
 
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> make_affine(T Angle, T Sign)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	glm::mat<4, 4, T, glm::defaultp> m(static_cast<T>(1));
+	m = glm::translate(m, vec3(static_cast<T>(3), static_cast<T>(-1), static_cast<T>(2)));
+	m = glm::rotate(m, Angle, glm::normalize(vec3(static_cast<T>(1), static_cast<T>(-2), static_cast<T>(0.5))));
+	m = glm::scale(m, vec3(static_cast<T>(2), static_cast<T>(0.5), Sign * static_cast<T>(3)));
+	m[1][0] += static_cast<T>(0.25); // shear
+	return m;
+}
+
+template<typename T>
+static int test_affine_general()
+{
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	for(int i = 0; i < 8; ++i)
+	{
+		mat4 const M = make_affine(static_cast<T>(i) * static_cast<T>(0.7), i & 1 ? static_cast<T>(-1) : static_cast<T>(1));
+		Error += glm::all(glm::equal(glm::affineInverse(M), glm::inverse(M), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::affineInverse(M) * M, mat4(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_inverseTranspose()
+{
+	typedef glm::mat<2, 2, T, glm::defaultp> mat2;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	for(int i = 0; i < 8; ++i)
+	{
+		mat4 M = make_affine(static_cast<T>(i) * static_cast<T>(0.7), i & 1 ? static_cast<T>(-1) : static_cast<T>(1));
+		M[0][3] = static_cast<T>(0.1); // projective
+		Error += glm::all(glm::equal(glm::inverseTranspose(M), glm::transpose(glm::inverse(M)), Epsilon)) ? 0 : 1;
+
+		mat3 const N(M);
+		Error += glm::all(glm::equal(glm::inverseTranspose(N), glm::transpose(glm::inverse(N)), Epsilon)) ? 0 : 1;
+
+		mat2 const O(M);
+		Error += glm::all(glm::equal(glm::inverseTranspose(O), glm::transpose(glm::inverse(O)), Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T>
+static int test_normalMatrix()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	for(int i = 0; i < 8; ++i)
+	{
+		mat4 const M = make_affine(static_cast<T>(i) * static_cast<T>(0.7), i & 1 ? static_cast<T>(-1) : static_cast<T>(1));
+		mat3 const N(M);
+		mat3 const Expected(glm::transpose(glm::inverse(N)) * glm::determinant(N));
+
+		Error += glm::all(glm::equal(glm::normalMatrix(M), Expected, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::normalMatrix(N), Expected, Epsilon)) ? 0 : 1;
+
+		// The normal of a transformed triangle is the transformed normal
+		vec3 const a(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0.5));
+		vec3 const b(static_cast<T>(-0.5), static_cast<T>(2), static_cast<T>(1));
+		vec3 const Normal = glm::normalize(glm::normalMatrix(M) * glm::cross(a, b));
+		Error += glm::all(glm::equal(Normal, glm::normalize(glm::cross(N * a, N * b)), Epsilon)) ? 0 : 1;
+	}
+
+	// Singular matrices are supported
+	mat3 const Flat(vec3(1, 0, 0), vec3(0, 1, 0), vec3(0));
+	Error += glm::all(glm::equal(glm::normalMatrix(Flat), mat3(vec3(0), vec3(0), vec3(0, 0, 1)), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_affine();
+	Error += test_affine_general<float>();
+	Error += test_affine_general<double>();
+	Error += test_inverseTranspose<float>();
+	Error += test_inverseTranspose<double>();
+	Error += test_normalMatrix<float>();
+	Error += test_normalMatrix<double>();
 
 	return Error;
 }
@@ -0,0 +1,27 @@
+/// Driver shared by the tests of the batch functions, so that every batch ends with a partial group of SIMD lanes
+
+#pragma once
+
+#include <glm/glm.hpp>
+#include <cstddef>
+
+// A single element, one and two groups of 8 lanes with a remainder, and many groups
+static std::size_t const batch_counts[] = {1, 7, 9, 17, 100};
+
+// Sum of the errors of Test::call<T, Q>(Count) for every count, for float, double and aligned float when enabled
+template<typename Test>
+static inline int test_batch_counts()
+{
+	int Error = 0;
+
+	for(std::size_t i = 0; i < sizeof(batch_counts) / sizeof(batch_counts[0]); ++i)
+	{
+		Error += Test::template call<float, glm::defaultp>(batch_counts[i]);
+		Error += Test::template call<double, glm::defaultp>(batch_counts[i]);
+#		if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+			Error += Test::template call<float, glm::aligned_highp>(batch_counts[i]);
+#		endif
+	}
+
+	return Error;
+}
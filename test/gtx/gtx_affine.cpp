@@ -0,0 +1,121 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtx/affine.hpp>
+#include <glm/gtx/norm.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> make_transform(T Angle, glm::vec<3, T, glm::defaultp> const& Translation, glm::vec<3, T, glm::defaultp> const& Scale)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	glm::mat<4, 4, T, glm::defaultp> m(static_cast<T>(1));
+	m = glm::translate(m, Translation);
+	m = glm::rotate(m, Angle, glm::normalize(vec3(static_cast<T>(1), static_cast<T>(2), static_cast<T>(3))));
+	m = glm::scale(m, Scale);
+	return m;
+}
+
+template<typename T>
+static int test_conversions()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	mat4 const m = make_transform(static_cast<T>(0.5), vec3(1, 2, 3), vec3(2, 1, static_cast<T>(0.5)));
+	glm::affine<T> const a(m);
+
+	Error += glm::all(glm::equal(glm::mat4_cast(a), m, static_cast<T>(0))) ? 0 : 1;
+	Error += glm::affine<T>(glm::mat3x4_cast(a)) == a ? 0 : 1;
+	Error += glm::affine<T>(glm::mat<4, 3, T, glm::defaultp>(m)) == a ? 0 : 1;
+	Error += glm::affine<T>(glm::mat<3, 3, T, glm::defaultp>(m), vec3(m[3])) == a ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat3_cast(a), glm::mat<3, 3, T, glm::defaultp>(m), static_cast<T>(0))) ? 0 : 1;
+
+	Error += glm::affine<T>() == glm::affine<T>(mat4(static_cast<T>(1))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(glm::affine<T>(static_cast<T>(2))), glm::scale(mat4(static_cast<T>(1)), vec3(static_cast<T>(2))), static_cast<T>(0))) ? 0 : 1;
+
+	// Same row layout as the dual quaternion mat3x4
+	glm::tdualquat<T, glm::defaultp> const dq(glm::angleAxis(static_cast<T>(0.3), vec3(0, 1, 0)), vec3(4, 5, 6));
+	glm::affine<T> const b(glm::mat3x4_cast(dq));
+	Error += glm::all(glm::equal(transformPoint(b, vec3(0)), vec3(4, 5, 6), static_cast<T>(0.0001))) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_mul()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::vec<4, T, glm::defaultp> vec4;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	mat4 const ma = make_transform(static_cast<T>(0.5), vec3(1, 2, 3), vec3(2, 1, static_cast<T>(0.5)));
+	mat4 const mb = make_transform(static_cast<T>(-1.2), vec3(-3, 0, 7), vec3(1, 3, 1));
+	glm::affine<T> const a(ma);
+	glm::affine<T> const b(mb);
+
+	Error += glm::all(glm::equal(glm::mat4_cast(a * b), ma * mb, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(b * a), mb * ma, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(a * glm::affine<T>()), ma, Epsilon)) ? 0 : 1;
+
+	vec3 const p(static_cast<T>(0.5), -2, 3);
+	Error += glm::all(glm::equal(glm::transformPoint(a, p), vec3(ma * vec4(p, 1)), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::transformVector(a, p), vec3(ma * vec4(p, 0)), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::transformPoint(a * b, p), glm::transformPoint(a, glm::transformPoint(b, p)), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T>
+static int test_inverse()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	mat4 const m = make_transform(static_cast<T>(2.1), vec3(-1, 5, 3), vec3(3, static_cast<T>(0.25), 1));
+	glm::affine<T> const a(m);
+	glm::affine<T> const i(glm::inverse(a));
+
+	Error += glm::all(glm::equal(glm::mat4_cast(i), glm::affineInverse(m), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(i * a), mat4(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(a * i), mat4(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+
+	vec3 const p(7, -2, static_cast<T>(0.5));
+	Error += glm::all(glm::equal(glm::transformPoint(i, glm::transformPoint(a, p)), p, Epsilon)) ? 0 : 1;
+
+	// Shear and reflection
+	glm::affine<T> const s(
+		glm::vec<4, T, glm::defaultp>(1, 2, 0, 1),
+		glm::vec<4, T, glm::defaultp>(0, 1, 0, 2),
+		glm::vec<4, T, glm::defaultp>(0, 0, -1, 3));
+	Error += glm::all(glm::equal(glm::mat4_cast(glm::inverse(s)), glm::inverse(glm::mat4_cast(s)), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_conversions<float>();
+	Error += test_conversions<double>();
+	Error += test_mul<float>();
+	Error += test_mul<double>();
+	Error += test_inverse<float>();
+	Error += test_inverse<double>();
+
+	return Error;
+}
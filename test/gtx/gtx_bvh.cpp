@@ -0,0 +1,159 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/bvh.hpp>
+#include <vector>
+
+static std::vector<glm::vec3> make_triangle_soup(std::size_t TriangleCount)
+{
+	std::vector<glm::vec3> Vertices(TriangleCount * 3);
+	for(std::size_t i = 0; i < TriangleCount; ++i)
+	{
+		glm::vec3 const Center = glm::linearRand(glm::vec3(-10), glm::vec3(10));
+		for(std::size_t j = 0; j < 3; ++j)
+			Vertices[i * 3 + j] = Center + glm::linearRand(glm::vec3(-0.5f), glm::vec3(0.5f));
+	}
+	return Vertices;
+}
+
+static bool brute_force_closest(std::vector<glm::vec3> const& Vertices, glm::vec3 const& Orig, glm::vec3 const& Dir, float& Distance, std::size_t& TriangleIndex)
+{
+	bool Hit = false;
+	for(std::size_t i = 0, n = Vertices.size() / 3; i < n; ++i)
+	{
+		glm::vec2 Bary;
+		float Dist;
+		if(glm::intersectRayTriangle(Orig, Dir, Vertices[i * 3 + 0], Vertices[i * 3 + 1], Vertices[i * 3 + 2], Bary, Dist) && Dist >= 0.f && (!Hit || Dist < Distance))
+		{
+			Distance = Dist;
+			TriangleIndex = i;
+			Hit = true;
+		}
+	}
+	return Hit;
+}
+
+static int test_empty()
+{
+	int Error = 0;
+
+	glm::bvh<float> Tree;
+	glm::buildBVH(Tree, static_cast<glm::vec3 const*>(0), 0);
+
+	glm::vec2 Bary;
+	float Distance = 0;
+	std::size_t Index = 0;
+	Error += glm::intersectRayBVH(Tree, glm::vec3(0), glm::vec3(0, 0, 1), Bary, Distance, Index) ? 1 : 0;
+	Error += glm::intersectRayBVHAny(Tree, glm::vec3(0), glm::vec3(0, 0, 1), 1.f) ? 1 : 0;
+
+	return Error;
+}
+
+static int test_single()
+{
+	int Error = 0;
+
+	glm::vec3 const Vertices[] = {glm::vec3(0, 0, 0), glm::vec3(-1, -1, 0), glm::vec3(1, -1, 0)};
+
+	glm::bvh<float> Tree;
+	glm::buildBVH(Tree, Vertices, 1);
+	Error += Tree.nodes.size() == 1 ? 0 : 1;
+
+	glm::vec2 Bary;
+	float Distance = 0;
+	std::size_t Index = 1;
+	Error += glm::intersectRayBVH(Tree, glm::vec3(0, -0.5f, 2), glm::vec3(0, 0, -1), Bary, Distance, Index) ? 0 : 1;
+	Error += glm::abs(Distance - 2.f) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+	Error += Index == 0 ? 0 : 1;
+
+	// The triangle is behind the ray
+	Error += glm::intersectRayBVH(Tree, glm::vec3(0, -0.5f, 2), glm::vec3(0, 0, 1), Bary, Distance, Index) ? 1 : 0;
+
+	Error += glm::intersectRayBVHAny(Tree, glm::vec3(0, -0.5f, 2), glm::vec3(0, 0, -1), 3.f) ? 0 : 1;
+	Error += glm::intersectRayBVHAny(Tree, glm::vec3(0, -0.5f, 2), glm::vec3(0, 0, -1), 1.f) ? 1 : 0;
+
+	return Error;
+}
+
+static int test_brute_force(std::size_t TriangleCount, glm::length_t MaxLeafSize)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> const Vertices = make_triangle_soup(TriangleCount);
+
+	glm::bvh<float> Tree;
+	glm::buildBVH(Tree, &Vertices[0], Vertices.size() / 3, MaxLeafSize);
+	Error += Tree.vertices.size() == Vertices.size() ? 0 : 1;
+
+	for(std::size_t i = 0; i < 500; ++i)
+	{
+		glm::vec3 const Orig = glm::linearRand(glm::vec3(-12), glm::vec3(12));
+		glm::vec3 const Dir = glm::sphericalRand(1.0f);
+
+		float DistanceRef = 0;
+		std::size_t IndexRef = 0;
+		bool const HitRef = brute_force_closest(Vertices, Orig, Dir, DistanceRef, IndexRef);
+
+		glm::vec2 Bary;
+		float Distance = 0;
+		std::size_t Index = 0;
+		bool const Hit = glm::intersectRayBVH(Tree, Orig, Dir, Bary, Distance, Index);
+
+		Error += Hit == HitRef ? 0 : 1;
+		if(Hit && HitRef)
+		{
+			Error += Distance == DistanceRef ? 0 : 1;
+			Error += Index == IndexRef ? 0 : 1;
+		}
+
+		Error += glm::intersectRayBVHAny(Tree, Orig, Dir, std::numeric_limits<float>::max()) == HitRef ? 0 : 1;
+		if(HitRef)
+		{
+			Error += glm::intersectRayBVHAny(Tree, Orig, Dir, DistanceRef) ? 0 : 1;
+			if(DistanceRef > 0.f)
+				Error += glm::intersectRayBVHAny(Tree, Orig, Dir, DistanceRef * 0.5f) ? 1 : 0;
+		}
+	}
+
+	return Error;
+}
+
+static int test_coincident()
+{
+	int Error = 0;
+
+	// Identical triangles can't be split by the surface area heuristic
+	std::vector<glm::vec3> Vertices;
+	for(std::size_t i = 0; i < 100; ++i)
+	{
+		Vertices.push_back(glm::vec3(0, 0, 0));
+		Vertices.push_back(glm::vec3(-1, -1, 0));
+		Vertices.push_back(glm::vec3(1, -1, 0));
+	}
+
+	glm::bvh<float> Tree;
+	glm::buildBVH(Tree, &Vertices[0], Vertices.size() / 3);
+
+	glm::vec2 Bary;
+	float Distance = 0;
+	std::size_t Index = 0;
+	Error += glm::intersectRayBVH(Tree, glm::vec3(0, -0.5f, 2), glm::vec3(0, 0, -1), Bary, Distance, Index) ? 0 : 1;
+	Error += Index < 100 ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_empty();
+	Error += test_single();
+	Error += test_brute_force(2000, 1);
+	Error += test_brute_force(2000, 4);
+	// Large enough for the OpenMP build to subdivide in parallel tasks
+	Error += test_brute_force(20000, 4);
+	Error += test_coincident();
+
+	return Error;
+}
@@ -0,0 +1,94 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/gtx/covariance.hpp>
+#include <glm/gtx/matrix_factorisation.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+
+// Points of the plane through Center spanned by U and V, far from the origin
+template<typename T>
+static std::vector<glm::vec<3, T, glm::defaultp> > plane_points(std::size_t Count)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+
+	vec3 const Center(10000, -20000, 5000);
+	vec3 const U = glm::normalize(vec3(1, 2, 0));
+	vec3 const V = glm::normalize(glm::cross(vec3(0, 0, 1), U) + vec3(0, 0, 1));
+
+	std::vector<vec3> Points;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T const f = static_cast<T>(i);
+		Points.push_back(Center + U * (glm::sin(f * static_cast<T>(0.37)) * static_cast<T>(3)) + V * glm::cos(f * static_cast<T>(1.91)));
+	}
+	return Points;
+}
+
+template<typename T>
+static int test_covariance()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+
+	int Error = 0;
+
+	glm::covariance_accumulator<T> Empty;
+	Error += Empty.count == 0 ? 0 : 1;
+	Error += glm::all(glm::equal(glm::covarianceMatrix(Empty), mat3(static_cast<T>(0)), static_cast<T>(0))) ? 0 : 1;
+
+	// Reference covariance computed with the mean
+	std::vector<vec3> const Points = plane_points<T>(3001);
+	glm::dvec3 Mean(0);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Mean += glm::dvec3(Points[i]);
+	Mean /= static_cast<double>(Points.size());
+	glm::dmat3 Reference(0);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+	{
+		glm::dvec3 const d(glm::dvec3(Points[i]) - Mean);
+		Reference += glm::outerProduct(d, d);
+	}
+	Reference /= static_cast<double>(Points.size());
+
+	glm::covariance_accumulator<T> Batch;
+	glm::accumulateCovariance(Batch, &Points[0], Points.size());
+	Error += Batch.count == Points.size() ? 0 : 1;
+	Error += glm::all(glm::equal(glm::covarianceMean(Batch), vec3(Mean), static_cast<T>(0.01))) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::covarianceMatrix(Batch), mat3(Reference), static_cast<T>(0.001))) ? 0 : 1;
+
+	glm::covariance_accumulator<T> Single;
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		glm::accumulateCovariance(Single, Points[i]);
+	Error += glm::all(glm::equal(glm::covarianceMatrix(Single), mat3(Reference), static_cast<T>(0.001))) ? 0 : 1;
+
+	// Partial accumulators merged in any order
+	glm::covariance_accumulator<T> First, Second;
+	glm::accumulateCovariance(First, &Points[0], 1000);
+	glm::accumulateCovariance(Second, &Points[1000], Points.size() - 1000);
+	glm::mergeCovariance(Second, First);
+	glm::mergeCovariance(Second, Empty);
+	Error += Second.count == Points.size() ? 0 : 1;
+	Error += glm::all(glm::equal(glm::covarianceMatrix(Second), mat3(Reference), static_cast<T>(0.001))) ? 0 : 1;
+	glm::mergeCovariance(Empty, Second);
+	Error += Empty.count == Points.size() ? 0 : 1;
+
+	// The normal of the plane is the eigenvector of the smallest eigenvalue
+	vec3 Values;
+	mat3 Vectors;
+	glm::eigen_decompose_symmetric(glm::covarianceMatrix(Batch), Values, Vectors);
+	vec3 const Normal = glm::normalize(glm::cross(vec3(1, 2, 0), glm::cross(vec3(0, 0, 1), vec3(1, 2, 0)) + vec3(0, 0, glm::length(vec3(1, 2, 0)))));
+	Error += glm::abs(Values.z) < static_cast<T>(0.001) ? 0 : 1;
+	Error += glm::abs(glm::abs(glm::dot(Vectors[2], Normal)) - static_cast<T>(1)) < static_cast<T>(0.0001) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_covariance<float>();
+	Error += test_covariance<double>();
+
+	return Error;
+}
@@ -1,7 +1,10 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/glm.hpp>
 #include <glm/gtx/quaternion.hpp>
+#include <glm/ext/scalar_relational.hpp>
 #include <glm/gtx/easing.hpp>
+#include <vector>
+#include "batch_counts.hpp"
 
 namespace
 {
@@ -53,6 +56,152 @@ namespace
 
 }
 
+namespace batch
+{
+	template<typename T>
+	struct easing
+	{
+		glm::easing_function Function;
+		T (*Scalar)(T const&);
+	};
+
+	template<typename T>
+	static std::vector<T> parameters(std::size_t Count)
+	{
+		std::vector<T> Parameters(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			Parameters[i] = Count > 1 ? static_cast<T>(i) / static_cast<T>(Count - 1) : static_cast<T>(0.5);
+		return Parameters;
+	}
+
+	// easingBatch against the scalar functions, for every function
+	template<typename T>
+	static int test_batch(std::size_t Count)
+	{
+		int Error = 0;
+
+		T const Epsilon = static_cast<T>(0.00001);
+		easing<T> const Functions[] = {
+			{glm::easing_linear_interpolation, glm::linearInterpolation<T>},
+			{glm::easing_quadratic_in, glm::quadraticEaseIn<T>},
+			{glm::easing_quadratic_out, glm::quadraticEaseOut<T>},
+			{glm::easing_quadratic_in_out, glm::quadraticEaseInOut<T>},
+			{glm::easing_cubic_in, glm::cubicEaseIn<T>},
+			{glm::easing_cubic_out, glm::cubicEaseOut<T>},
+			{glm::easing_cubic_in_out, glm::cubicEaseInOut<T>},
+			{glm::easing_quartic_in, glm::quarticEaseIn<T>},
+			{glm::easing_quartic_out, glm::quarticEaseOut<T>},
+			{glm::easing_quartic_in_out, glm::quarticEaseInOut<T>},
+			{glm::easing_quintic_in, glm::quinticEaseIn<T>},
+			{glm::easing_quintic_out, glm::quinticEaseOut<T>},
+			{glm::easing_quintic_in_out, glm::quinticEaseInOut<T>},
+			{glm::easing_sine_in, glm::sineEaseIn<T>},
+			{glm::easing_sine_out, glm::sineEaseOut<T>},
+			{glm::easing_sine_in_out, glm::sineEaseInOut<T>},
+			{glm::easing_circular_in, glm::circularEaseIn<T>},
+			{glm::easing_circular_out, glm::circularEaseOut<T>},
+			{glm::easing_circular_in_out, glm::circularEaseInOut<T>},
+			{glm::easing_exponential_in, glm::exponentialEaseIn<T>},
+			{glm::easing_exponential_out, glm::exponentialEaseOut<T>},
+			{glm::easing_exponential_in_out, glm::exponentialEaseInOut<T>},
+			{glm::easing_elastic_in, glm::elasticEaseIn<T>},
+			{glm::easing_elastic_out, glm::elasticEaseOut<T>},
+			{glm::easing_elastic_in_out, glm::elasticEaseInOut<T>},
+			{glm::easing_back_in, glm::backEaseIn<T>},
+			{glm::easing_back_out, glm::backEaseOut<T>},
+			{glm::easing_back_in_out, glm::backEaseInOut<T>},
+			{glm::easing_bounce_in, glm::bounceEaseIn<T>},
+			{glm::easing_bounce_out, glm::bounceEaseOut<T>},
+			{glm::easing_bounce_in_out, glm::bounceEaseInOut<T>}};
+
+		std::vector<T> const a = parameters<T>(Count);
+		std::vector<T> Out(Count);
+		for(std::size_t f = 0; f < sizeof(Functions) / sizeof(Functions[0]); ++f)
+		{
+			glm::easingBatch(Functions[f].Function, &a[0], Count, &Out[0]);
+			for(std::size_t i = 0; i < Count; ++i)
+				Error += glm::equal(Out[i], Functions[f].Scalar(a[i]), Epsilon) ? 0 : 1;
+		}
+
+		// The overshoot of the back functions
+		T const o = static_cast<T>(2.5);
+		glm::easingBatch(glm::easing_back_in, &a[0], Count, &Out[0], o);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::backEaseIn(a[i], o), Epsilon) ? 0 : 1;
+		glm::easingBatch(glm::easing_back_out, &a[0], Count, &Out[0], o);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::backEaseOut(a[i], o), Epsilon) ? 0 : 1;
+		glm::easingBatch(glm::easing_back_in_out, &a[0], Count, &Out[0], o);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::equal(Out[i], glm::backEaseInOut(a[i], o), Epsilon) ? 0 : 1;
+
+		return Error;
+	}
+
+	// The component-wise functions of vectors against the scalar functions
+	template<glm::length_t L, typename T, glm::qualifier Q>
+	static int test_vec()
+	{
+		typedef glm::vec<L, T, Q> vec_type;
+
+		int Error = 0;
+
+		T const Epsilon = static_cast<T>(0.00001);
+		std::vector<T> const Parameters = parameters<T>(41);
+		for(std::size_t i = 0; i + L <= Parameters.size(); i += L)
+		{
+			vec_type a;
+			for(glm::length_t c = 0; c < L; ++c)
+				a[c] = Parameters[i + static_cast<std::size_t>(c)];
+
+			vec_type const Results[] = {
+				glm::sineEaseInOut(a), glm::circularEaseInOut(a), glm::exponentialEaseInOut(a), glm::elasticEaseInOut(a),
+				glm::backEaseInOut(a), glm::backEaseOut(a, static_cast<T>(2.5)), glm::bounceEaseIn(a), glm::bounceEaseInOut(a)};
+			for(glm::length_t c = 0; c < L; ++c)
+			{
+				T const Expected[] = {
+					glm::sineEaseInOut(a[c]), glm::circularEaseInOut(a[c]), glm::exponentialEaseInOut(a[c]), glm::elasticEaseInOut(a[c]),
+					glm::backEaseInOut(a[c]), glm::backEaseOut(a[c], static_cast<T>(2.5)), glm::bounceEaseIn(a[c]), glm::bounceEaseInOut(a[c])};
+				for(std::size_t f = 0; f < sizeof(Expected) / sizeof(Expected[0]); ++f)
+					Error += glm::equal(Results[f][c], Expected[f], Epsilon) ? 0 : 1;
+			}
+		}
+
+		return Error;
+	}
+
+	// A parameter is eased alike by vectors of any length and at any index of a batch
+	static int test_vec_lengths()
+	{
+		int Error = 0;
+
+		std::vector<float> const Parameters = parameters<float>(41);
+		std::vector<float> Out(Parameters.size());
+		glm::easingBatch(glm::easing_sine_in_out, &Parameters[0], Parameters.size(), &Out[0]);
+		for(std::size_t i = 0; i < Parameters.size(); ++i)
+		{
+			float const x = Parameters[i];
+			float const Expected = glm::sineEaseInOut(glm::vec4(x)).x;
+			Error += glm::sineEaseInOut(glm::vec1(x)).x == Expected ? 0 : 1;
+			Error += glm::sineEaseInOut(glm::vec2(x)).y == Expected ? 0 : 1;
+			Error += glm::sineEaseInOut(glm::vec3(x)).z == Expected ? 0 : 1;
+			Error += Out[i] == Expected ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	// easingBatch reads arrays of scalars, the qualifier of the driver is unused
+	struct test_functions
+	{
+		template<typename T, glm::qualifier Q>
+		static int call(std::size_t Count)
+		{
+			return test_batch<T>(Count);
+		}
+	};
+}//namespace batch
+
 int main()
 {
 	int Error = 0;
@@ -60,6 +209,16 @@ int main()
 	_test_easing<float>();
 	_test_easing<double>();
 
+	Error += test_batch_counts<batch::test_functions>();
+
+	Error += batch::test_vec<4, float, glm::defaultp>();
+	Error += batch::test_vec<3, float, glm::defaultp>();
+	Error += batch::test_vec<4, double, glm::defaultp>();
+	Error += batch::test_vec_lengths();
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += batch::test_vec<4, float, glm::aligned_highp>();
+#	endif
+
 	return Error;
 }
 
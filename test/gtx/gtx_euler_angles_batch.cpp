@@ -0,0 +1,170 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/quaternion_trigonometric.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/gtx/euler_angles_batch.hpp>
+#include <vector>
+#include "batch_counts.hpp"
+
+template<typename T>
+struct euler_functions
+{
+	typedef glm::mat<4, 4, T, glm::defaultp> (*build)(T const&, T const&, T const&);
+	typedef void (*extract)(glm::mat<4, 4, T, glm::defaultp> const&, T&, T&, T&);
+
+	glm::euler_order Order;
+	glm::length_t Axes[3];
+	build Build;
+	extract Extract;
+};
+
+template<typename T>
+static euler_functions<T> make_functions(glm::euler_order Order, glm::length_t a, glm::length_t b, glm::length_t c, typename euler_functions<T>::build Build, typename euler_functions<T>::extract Extract)
+{
+	euler_functions<T> Result;
+	Result.Order = Order;
+	Result.Axes[0] = a;
+	Result.Axes[1] = b;
+	Result.Axes[2] = c;
+	Result.Build = Build;
+	Result.Extract = Extract;
+	return Result;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_order(euler_functions<T> const& Functions, std::size_t Count)
+{
+	typedef glm::mat<3, 3, T, Q> mat3;
+	typedef glm::mat<4, 4, T, Q> mat4;
+	typedef glm::qua<T, Q> quat;
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	bool const Proper = Functions.Axes[0] == Functions.Axes[2];
+	T const HalfPi = glm::half_pi<T>();
+
+	std::vector<T> T1(Count, static_cast<T>(0)), T2(T1), T3(T1);
+	std::vector<bool> Lock(Count, false);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T1[i] = static_cast<T>(i % 13) * static_cast<T>(0.45) - static_cast<T>(2.7);
+		T3[i] = static_cast<T>(i % 7) * static_cast<T>(0.8) - static_cast<T>(2.4);
+		if(Proper)
+			T2[i] = static_cast<T>(i % 11) * static_cast<T>(0.27) + static_cast<T>(0.1);
+		else
+			T2[i] = static_cast<T>(i % 11) * static_cast<T>(0.27) - static_cast<T>(1.35);
+
+		// Gimbal lock, only the rotation is unique
+		Lock[i] = i % 17 == 5;
+		if(Lock[i])
+			T2[i] = Proper ? static_cast<T>(0) : (i % 2 ? HalfPi : -HalfPi);
+	}
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	std::vector<mat4> Expected(Count, mat4(static_cast<T>(1)));
+	for(std::size_t i = 0; i < Count; ++i)
+		Expected[i] = mat4(Functions.Build(T1[i], T2[i], T3[i]));
+
+	std::vector<mat3> M3(Count, mat3(static_cast<T>(1)));
+	glm::eulerAngleBatch(Functions.Order, &T1[0], &T2[0], &T3[0], Count, &M3[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(M3[i], mat3(Expected[i]), Epsilon)) ? 0 : 1;
+
+	std::vector<mat4> M4(Count, mat4(static_cast<T>(0)));
+	glm::eulerAngleBatch(Functions.Order, &T1[0], &T2[0], &T3[0], Count, &M4[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(M4[i], Expected[i], Epsilon)) ? 0 : 1;
+
+	std::vector<quat> Q4(Count, quat(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+	glm::eulerAngleBatch(Functions.Order, &T1[0], &T2[0], &T3[0], Count, &Q4[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		vec3 Axes[3];
+		for(int a = 0; a < 3; ++a)
+		{
+			Axes[a] = vec3(static_cast<T>(0));
+			Axes[a][Functions.Axes[a]] = static_cast<T>(1);
+		}
+		quat const Product = glm::angleAxis(T1[i], Axes[0]) * glm::angleAxis(T2[i], Axes[1]) * glm::angleAxis(T3[i], Axes[2]);
+		Error += glm::all(glm::equal(Q4[i], Product, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat3_cast(Q4[i]), mat3(Expected[i]), Epsilon)) ? 0 : 1;
+	}
+
+	// The extracted angles are those of the scalar extraction and rebuild the rotation, also in gimbal lock
+	std::vector<T> A1(Count, static_cast<T>(0)), A2(A1), A3(A1);
+	for(int Source = 0; Source < 3; ++Source)
+	{
+		if(Source == 0)
+			glm::extractEulerAngleBatch(Functions.Order, &Expected[0], Count, &A1[0], &A2[0], &A3[0]);
+		else if(Source == 1)
+			glm::extractEulerAngleBatch(Functions.Order, &M3[0], Count, &A1[0], &A2[0], &A3[0]);
+		else
+			glm::extractEulerAngleBatch(Functions.Order, &Q4[0], Count, &A1[0], &A2[0], &A3[0]);
+
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(mat4(Functions.Build(A1[i], A2[i], A3[i])), Expected[i], Epsilon)) ? 0 : 1;
+			if(Lock[i])
+				continue;
+
+			T E1(0), E2(0), E3(0);
+			Functions.Extract(glm::mat<4, 4, T, glm::defaultp>(Expected[i]), E1, E2, E3);
+			Error += glm::equal(A1[i], E1, Epsilon) ? 0 : 1;
+			Error += glm::equal(A2[i], E2, Epsilon) ? 0 : 1;
+			Error += glm::equal(A3[i], E3, Epsilon) ? 0 : 1;
+			Error += glm::equal(A1[i], T1[i], Epsilon) ? 0 : 1;
+			Error += glm::equal(A2[i], T2[i], Epsilon) ? 0 : 1;
+			Error += glm::equal(A3[i], T3[i], Epsilon) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_batch(std::size_t Count)
+{
+	euler_functions<T> const Functions[] = {
+		make_functions<T>(glm::euler_xyz, 0, 1, 2, glm::eulerAngleXYZ<T>, glm::extractEulerAngleXYZ<T>),
+		make_functions<T>(glm::euler_xzy, 0, 2, 1, glm::eulerAngleXZY<T>, glm::extractEulerAngleXZY<T>),
+		make_functions<T>(glm::euler_yxz, 1, 0, 2, glm::eulerAngleYXZ<T>, glm::extractEulerAngleYXZ<T>),
+		make_functions<T>(glm::euler_yzx, 1, 2, 0, glm::eulerAngleYZX<T>, glm::extractEulerAngleYZX<T>),
+		make_functions<T>(glm::euler_zxy, 2, 0, 1, glm::eulerAngleZXY<T>, glm::extractEulerAngleZXY<T>),
+		make_functions<T>(glm::euler_zyx, 2, 1, 0, glm::eulerAngleZYX<T>, glm::extractEulerAngleZYX<T>),
+		make_functions<T>(glm::euler_xyx, 0, 1, 0, glm::eulerAngleXYX<T>, glm::extractEulerAngleXYX<T>),
+		make_functions<T>(glm::euler_xzx, 0, 2, 0, glm::eulerAngleXZX<T>, glm::extractEulerAngleXZX<T>),
+		make_functions<T>(glm::euler_yxy, 1, 0, 1, glm::eulerAngleYXY<T>, glm::extractEulerAngleYXY<T>),
+		make_functions<T>(glm::euler_yzy, 1, 2, 1, glm::eulerAngleYZY<T>, glm::extractEulerAngleYZY<T>),
+		make_functions<T>(glm::euler_zxz, 2, 0, 2, glm::eulerAngleZXZ<T>, glm::extractEulerAngleZXZ<T>),
+		make_functions<T>(glm::euler_zyz, 2, 1, 2, glm::eulerAngleZYZ<T>, glm::extractEulerAngleZYZ<T>)};
+
+	int Error = 0;
+
+	for(std::size_t i = 0; i < sizeof(Functions) / sizeof(Functions[0]); ++i)
+		Error += test_order<T, Q>(Functions[i], Count);
+
+	return Error;
+}
+
+struct test_orders
+{
+	template<typename T, glm::qualifier Q>
+	static int call(std::size_t Count)
+	{
+		return test_batch<T, Q>(Count);
+	}
+};
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_batch_counts<test_orders>();
+
+	return Error;
+}
@@ -0,0 +1,142 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/frustum.hpp>
+#include <vector>
+
+static float plane_distance(glm::vec4 const& Plane, glm::vec3 const& Point)
+{
+	return glm::dot(glm::vec3(Plane), Point) + Plane.w;
+}
+
+static int test_planes()
+{
+	int Error = 0;
+
+	float const Epsilon = 0.0001f;
+
+	glm::mat4 const Projections[2] = {
+		glm::perspectiveRH_ZO(glm::radians(60.f), 1.5f, 0.5f, 100.f),
+		glm::perspectiveRH_NO(glm::radians(60.f), 1.5f, 0.5f, 100.f)};
+
+	for(int k = 0; k < 2; ++k)
+	{
+		glm::vec4 Planes[6];
+		if(k == 0)
+			glm::frustumPlanesZO(Projections[k], Planes);
+		else
+			glm::frustumPlanesNO(Projections[k], Planes);
+
+		for(int p = 0; p < 6; ++p)
+			Error += glm::abs(glm::length(glm::vec3(Planes[p])) - 1.f) < Epsilon ? 0 : 1;
+
+		// Near and far planes, the camera looks down -z
+		Error += glm::abs(plane_distance(Planes[4], glm::vec3(0, 0, -0.5f))) < Epsilon ? 0 : 1;
+		Error += glm::abs(plane_distance(Planes[5], glm::vec3(0, 0, -100.f))) < Epsilon * 100.f ? 0 : 1;
+		Error += plane_distance(Planes[4], glm::vec3(0, 0, -1.f)) > 0.f ? 0 : 1;
+		Error += plane_distance(Planes[4], glm::vec3(0, 0, 0.f)) < 0.f ? 0 : 1;
+
+		// Points unprojected from the clip volume corners lie on the side planes
+		glm::mat4 const Inverse = glm::inverse(Projections[k]);
+		float const NearDepth = k == 0 ? 0.f : -1.f;
+		glm::vec4 const Corner = Inverse * glm::vec4(-1, -1, NearDepth, 1);
+		glm::vec3 const Point = glm::vec3(Corner) / Corner.w;
+		Error += glm::abs(plane_distance(Planes[0], Point)) < Epsilon ? 0 : 1;
+		Error += glm::abs(plane_distance(Planes[2], Point)) < Epsilon ? 0 : 1;
+		Error += glm::abs(plane_distance(Planes[4], Point)) < Epsilon ? 0 : 1;
+	}
+
+	{
+		glm::mat4 const Projection = glm::perspective(glm::radians(60.f), 1.5f, 0.5f, 100.f);
+		glm::mat4 const View = glm::lookAt(glm::vec3(10, 0, 0), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+		glm::vec4 Planes[6];
+		glm::frustumPlanes(Projection * View, Planes);
+
+		for(int p = 0; p < 6; ++p)
+			Error += plane_distance(Planes[p], glm::vec3(0, 0, 0)) > 0.f ? 0 : 1;
+		Error += plane_distance(Planes[4], glm::vec3(9.5f, 0, 0)) < Epsilon ? 0 : 1;
+		Error += plane_distance(Planes[4], glm::vec3(9.5f, 0, 0)) > -Epsilon ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_cull(std::size_t Count)
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspective(glm::radians(60.f), 1.5f, 0.5f, 100.f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 0, 20), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(Projection * View, Planes);
+
+	std::vector<float> X(Count), Y(Count), Z(Count), R(Count), EX(Count), EY(Count), EZ(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center = glm::linearRand(glm::vec3(-100), glm::vec3(100));
+		X[i] = Center.x;
+		Y[i] = Center.y;
+		Z[i] = Center.z;
+		R[i] = glm::linearRand(0.f, 10.f);
+		EX[i] = glm::linearRand(0.f, 10.f);
+		EY[i] = glm::linearRand(0.f, 10.f);
+		EZ[i] = glm::linearRand(0.f, 10.f);
+	}
+
+	std::vector<glm::uint32> Spheres((Count + 31) / 32, 0xFFFFFFFF);
+	std::vector<glm::uint32> Boxes((Count + 31) / 32, 0xFFFFFFFF);
+	glm::frustumCullSpheres(Planes, &X[0], &Y[0], &Z[0], &R[0], Count, &Spheres[0]);
+	glm::frustumCullBoxes(Planes, &X[0], &Y[0], &Z[0], &EX[0], &EY[0], &EZ[0], Count, &Boxes[0]);
+
+	std::size_t Visible = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::vec3 const Center(X[i], Y[i], Z[i]);
+		glm::vec3 const Extent(EX[i], EY[i], EZ[i]);
+
+		bool SphereRef = true;
+		bool BoxRef = true;
+		bool BoxMargin = false;
+		for(int p = 0; p < 6; ++p)
+		{
+			float const Distance = plane_distance(Planes[p], Center);
+			float const Radius = glm::dot(glm::abs(glm::vec3(Planes[p])), Extent);
+			SphereRef = SphereRef && Distance >= -R[i];
+			BoxRef = BoxRef && Distance + Radius >= 0.f;
+			BoxMargin = BoxMargin || glm::abs(Distance + Radius) < 0.001f || glm::abs(Distance + R[i]) < 0.001f;
+		}
+		if(BoxMargin)
+			continue;
+
+		bool const SphereVisible = (Spheres[i / 32] >> (i % 32)) & 1;
+		bool const BoxVisible = (Boxes[i / 32] >> (i % 32)) & 1;
+		Error += SphereVisible == SphereRef ? 0 : 1;
+		Error += BoxVisible == BoxRef ? 0 : 1;
+		Visible += SphereVisible ? 1 : 0;
+	}
+
+	// Bits past the last object are cleared
+	if(Count % 32)
+	{
+		Error += (Spheres.back() >> (Count % 32)) == 0 ? 0 : 1;
+		Error += (Boxes.back() >> (Count % 32)) == 0 ? 0 : 1;
+	}
+
+	Error += Visible > 0 && Visible < Count ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_planes();
+	Error += test_cull(1000);
+	Error += test_cull(1003);
+	Error += test_cull(7);
+
+	return Error;
+}
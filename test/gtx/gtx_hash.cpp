@@ -0,0 +1,97 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#if GLM_HAS_CXX11_STL
+#include <glm/gtx/hash.hpp>
+#include <unordered_map>
+#include <unordered_set>
+
+static int test_zero()
+{
+	int Error = 0;
+
+	Error += glm::hashMix(glm::vec3(-0.0f, 1.0f, 2.0f)) == glm::hashMix(glm::vec3(0.0f, 1.0f, 2.0f)) ? 0 : 1;
+	Error += glm::hashMix(glm::dvec2(1.0, -0.0)) == glm::hashMix(glm::dvec2(1.0, 0.0)) ? 0 : 1;
+	Error += glm::hashMix(glm::vec<2, long double>(-0.0L, 1.0L)) == glm::hashMix(glm::vec<2, long double>(0.0L, 1.0L)) ? 0 : 1;
+
+	std::hash<glm::vec4> Hasher;
+	Error += Hasher(glm::vec4(-0.0f)) == Hasher(glm::vec4(0.0f)) ? 0 : 1;
+
+	std::unordered_map<glm::vec2, int> Map;
+	Map[glm::vec2(0.0f, 1.0f)] = 1;
+	Error += Map.count(glm::vec2(-0.0f, 1.0f)) == 1 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_distribution()
+{
+	int Error = 0;
+
+	// Fractional, negative and out of the 64 bits integer range long doubles
+	typedef glm::vec<1, long double> ldvec1;
+	Error += glm::hashMix(ldvec1(0.25L)) != glm::hashMix(ldvec1(0.75L)) ? 0 : 1;
+	Error += glm::hashMix(ldvec1(0.25L)) != glm::hashMix(ldvec1(-0.25L)) ? 0 : 1;
+	Error += glm::hashMix(ldvec1(1e30L)) != glm::hashMix(ldvec1(2e30L)) ? 0 : 1;
+	Error += glm::hashMix(ldvec1(1.0L)) != glm::hashMix(ldvec1(1.0L + std::numeric_limits<long double>::epsilon())) ? 0 : 1;
+
+	// Permuted components and neighbor cells must not collide
+	Error += glm::hashMix(glm::ivec3(1, 2, 3)) != glm::hashMix(glm::ivec3(3, 2, 1)) ? 0 : 1;
+	Error += glm::hashMix(glm::ivec2(0, 1)) != glm::hashMix(glm::ivec2(1, 0)) ? 0 : 1;
+	Error += glm::hashMix(glm::ivec2(0)) != glm::hashMix(glm::ivec3(0)) ? 0 : 1;
+
+	std::unordered_set<std::size_t> Hashes;
+	std::unordered_set<std::size_t> Buckets;
+	for(int z = -8; z < 8; ++z)
+	for(int y = -8; y < 8; ++y)
+	for(int x = -8; x < 8; ++x)
+	{
+		glm::uint64 const Hash = glm::hashMix(glm::ivec3(x, y, z));
+		Hashes.insert(static_cast<std::size_t>(Hash));
+		Buckets.insert(static_cast<std::size_t>(Hash & 8191));
+	}
+	Error += Hashes.size() == 4096 ? 0 : 1;
+
+	// 4096 keys in 8192 buckets, a uniform hash fills about 3220 of them
+	Error += Buckets.size() > 3000 ? 0 : 1;
+
+	return Error;
+}
+
+static int test_std_hash()
+{
+	int Error = 0;
+
+	std::unordered_map<glm::ivec3, int> Map;
+	for(int i = 0; i < 100; ++i)
+		Map[glm::ivec3(i, -i, i * 7)] = i;
+	for(int i = 0; i < 100; ++i)
+		Error += Map[glm::ivec3(i, -i, i * 7)] == i ? 0 : 1;
+
+	std::hash<glm::quat> QuatHasher;
+	Error += QuatHasher(glm::quat(1.0f, 0.0f, 0.0f, 0.0f)) == QuatHasher(glm::quat(1.0f, -0.0f, 0.0f, 0.0f)) ? 0 : 1;
+
+	std::hash<glm::mat4> MatHasher;
+	Error += MatHasher(glm::mat4(1.0f)) != MatHasher(glm::mat4(2.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_zero();
+	Error += test_distribution();
+	Error += test_std_hash();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
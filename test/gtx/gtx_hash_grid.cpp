@@ -0,0 +1,120 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#if GLM_HAS_CXX11_STL
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/hash_grid.hpp>
+#include <algorithm>
+#include <vector>
+
+static std::vector<glm::uint32> brute_force(std::vector<glm::vec3> const& Points, glm::vec3 const& Center, float Radius)
+{
+	std::vector<glm::uint32> Result;
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		if(glm::dot(Points[i] - Center, Points[i] - Center) <= Radius * Radius)
+			Result.push_back(static_cast<glm::uint32>(i));
+	return Result;
+}
+
+static int test_build()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Points;
+	for(int i = 0; i < 1000; ++i)
+		Points.push_back(glm::linearRand(glm::vec3(-10.0f), glm::vec3(10.0f)));
+
+	glm::hash_grid<float> Grid;
+	glm::buildHashGrid(Grid, &Points[0], Points.size(), 1.0f);
+
+	Error += Grid.points.size() == Points.size() ? 0 : 1;
+	Error += (Grid.cells.size() & (Grid.cells.size() - 1)) == 0 ? 0 : 1;
+	Error += Grid.cells.size() >= Points.size() * 2 ? 0 : 1;
+
+	// Every point lies in its cell and maps back to its input
+	std::size_t Total = 0;
+	for(std::size_t c = 0; c < Grid.cells.size(); ++c)
+	{
+		glm::hash_grid<float>::cell const& Cell = Grid.cells[c];
+		Total += Cell.count;
+		for(glm::uint32 i = Cell.first; i < Cell.first + Cell.count; ++i)
+		{
+			Error += glm::hashGridCell(Grid, Grid.points[i]) == Cell.key ? 0 : 1;
+			Error += Points[Grid.pointIndices[i]] == Grid.points[i] ? 0 : 1;
+		}
+	}
+	Error += Total == Points.size() ? 0 : 1;
+
+	return Error;
+}
+
+static int test_findNeighbors()
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Points;
+	for(int i = 0; i < 2000; ++i)
+		Points.push_back(glm::linearRand(glm::vec3(-5.0f), glm::vec3(5.0f)));
+
+	// Points on cell boundaries, including both signs of zero
+	Points.push_back(glm::vec3(0.0f));
+	Points.push_back(glm::vec3(-0.0f, 0.5f, -0.0f));
+	Points.push_back(glm::vec3(-1.0f, 1.0f, -2.0f));
+
+	glm::hash_grid<float> Grid;
+	glm::buildHashGrid(Grid, &Points[0], Points.size(), 0.5f);
+
+	float const Radii[] = {0.0f, 0.25f, 0.5f, 1.3f, 100.0f};
+	for(std::size_t r = 0; r < sizeof(Radii) / sizeof(Radii[0]); ++r)
+	for(int i = 0; i < 50; ++i)
+	{
+		glm::vec3 const Center = i < 3 ? Points[Points.size() - 1 - static_cast<std::size_t>(i)] : glm::linearRand(glm::vec3(-6.0f), glm::vec3(6.0f));
+
+		std::vector<glm::uint32> Found;
+		std::size_t const Count = glm::findNeighbors(Grid, Center, Radii[r], Found);
+		Error += Count == Found.size() ? 0 : 1;
+
+		std::sort(Found.begin(), Found.end());
+		Error += Found == brute_force(Points, Center, Radii[r]) ? 0 : 1;
+	}
+
+	// Appends to the existing content
+	std::vector<glm::uint32> Found(1, 42u);
+	glm::findNeighbors(Grid, glm::vec3(0.0f), 0.0f, Found);
+	Error += Found.size() == 2 && Found[0] == 42u && Found[1] == 2000u ? 0 : 1;
+
+	return Error;
+}
+
+static int test_empty()
+{
+	int Error = 0;
+
+	glm::hash_grid<double> Grid;
+	glm::buildHashGrid(Grid, static_cast<glm::dvec3 const*>(0), 0, 1.0);
+
+	std::vector<glm::uint32> Found;
+	Error += glm::findNeighbors(Grid, glm::dvec3(0.0), 10.0, Found) == 0 ? 0 : 1;
+	Error += Found.empty() ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_build();
+	Error += test_findNeighbors();
+	Error += test_empty();
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
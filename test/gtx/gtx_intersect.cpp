@@ -43,12 +43,112 @@ int test_intersectLineTriangle()
 	return Error;
 }
 
+int test_intersectRayAABB()
+{
+	int Error = 0;
+
+	glm::vec3 const BoxMin(-1, -1, -1);
+	glm::vec3 const BoxMax(1, 1, 1);
+
+	{
+		glm::ray<float> const Ray(glm::vec3(-3, 0, 0), glm::vec3(1, 0, 0));
+		float Near = 0, Far = 0;
+		Error += glm::intersectRayAABB(Ray, BoxMin, BoxMax, Near, Far) ? 0 : 1;
+		Error += glm::abs(Near - 2.f) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+		Error += glm::abs(Far - 4.f) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+	}
+
+	{
+		glm::ray<float> const Ray(glm::vec3(-3, 0, 0), glm::vec3(-1, 0, 0));
+		float Near = 0, Far = 0;
+		Error += glm::intersectRayAABB(Ray, BoxMin, BoxMax, Near, Far) ? 1 : 0;
+	}
+
+	// Axis aligned ray starting on a slab plane: 0 * inf produces a NaN that must not reject the box
+	{
+		glm::ray<float> const Ray(glm::vec3(-3, 1, 0), glm::vec3(1, 0, 0));
+		float Near = 0, Far = 0;
+		Error += glm::intersectRayAABB(Ray, BoxMin, BoxMax, Near, Far) ? 0 : 1;
+		Error += glm::abs(Near - 2.f) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+	}
+
+	{
+		glm::ray<float> const Ray(glm::vec3(-3, 1.5f, 0), glm::vec3(1, -0.0f, 0));
+		float Near = 0, Far = 0;
+		Error += glm::intersectRayAABB(Ray, BoxMin, BoxMax, Near, Far) ? 1 : 0;
+	}
+
+	return Error;
+}
+
+template<glm::length_t L>
+int test_intersectRayAABB_packet()
+{
+	int Error = 0;
+
+	// One ray against L boxes, one box per lane slid along the y axis
+	{
+		glm::ray<float> const Ray(glm::vec3(0, 0, -5), glm::vec3(0, 0, 1));
+
+		glm::aabb_packet<L, float> Boxes;
+		for(glm::length_t i = 0; i < L - 1; ++i)
+			Boxes.set(i, glm::vec3(-1, -1 + i, -1), glm::vec3(1, i, 1));
+
+		float Near[L];
+		int const Mask = glm::intersectRayAABB(Ray, Boxes, 100.f, Near);
+
+		for(glm::length_t i = 0; i < L; ++i)
+		{
+			float NearRef = 0, FarRef = 0;
+			bool const HitRef = i < L - 1 && glm::intersectRayAABB(Ray, glm::vec3(-1, -1 + i, -1), glm::vec3(1, i, 1), NearRef, FarRef);
+			Error += ((Mask >> i) & 1) == (HitRef ? 1 : 0) ? 0 : 1;
+			if(HitRef)
+				Error += glm::abs(Near[i] - NearRef) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+		}
+
+		// Lanes 0 and 1 touch the origin axis, lane 1 from the boundary
+		Error += (Mask & 3) == 3 ? 0 : 1;
+
+		int const Short = glm::intersectRayAABB(Ray, Boxes, 3.f, Near);
+		Error += Short == 0 ? 0 : 1;
+	}
+
+	// L rays against one box
+	{
+		glm::ray_packet<L, float> Rays;
+		float MaxDistance[L];
+		for(glm::length_t i = 0; i < L; ++i)
+		{
+			float const Offset = static_cast<float>(i) * 0.5f - 1.f;
+			Rays.set(i, glm::ray<float>(glm::vec3(-5, Offset, 0), glm::vec3(1, 0, 0)));
+			MaxDistance[i] = 100.f;
+		}
+
+		float Near[L];
+		int const Mask = glm::intersectRayAABB(Rays, glm::vec3(-1), glm::vec3(1), MaxDistance, Near);
+
+		for(glm::length_t i = 0; i < L; ++i)
+		{
+			float const Offset = static_cast<float>(i) * 0.5f - 1.f;
+			bool const HitRef = Offset <= 1.f;
+			Error += ((Mask >> i) & 1) == (HitRef ? 1 : 0) ? 0 : 1;
+			if(HitRef)
+				Error += glm::abs(Near[i] - 4.f) <= std::numeric_limits<float>::epsilon() ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_intersectRayTriangle();
 	Error += test_intersectLineTriangle();
+	Error += test_intersectRayAABB();
+	Error += test_intersectRayAABB_packet<4>();
+	Error += test_intersectRayAABB_packet<8>();
 
 	return Error;
 }
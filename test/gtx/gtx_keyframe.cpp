@@ -0,0 +1,229 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/quaternion_trigonometric.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtx/keyframe.hpp>
+#include <vector>
+#include "batch_counts.hpp"
+
+template<typename T, glm::qualifier Q>
+static bool equal_rotation(glm::qua<T, Q> const& a, glm::qua<T, Q> const& b, T Epsilon)
+{
+	return glm::all(glm::equal(a, b, Epsilon)) || glm::all(glm::equal(a, -b, Epsilon));
+}
+
+// Times sampled by the tests: before the keys, forward, backward, jumps and after the keys
+template<typename T>
+static std::vector<T> sample_times()
+{
+	T const Times[] = {
+		static_cast<T>(-1), static_cast<T>(0), static_cast<T>(0.1), static_cast<T>(0.35), static_cast<T>(0.5), static_cast<T>(0.9),
+		static_cast<T>(1.6), static_cast<T>(1.2), static_cast<T>(0.95), static_cast<T>(3.4), static_cast<T>(0.2), static_cast<T>(2.5),
+		static_cast<T>(4), static_cast<T>(9), static_cast<T>(2)};
+	return std::vector<T>(Times, Times + sizeof(Times) / sizeof(Times[0]));
+}
+
+template<typename T, glm::qualifier Q>
+static int test_track()
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	T const Times[] = {static_cast<T>(0), static_cast<T>(0.5), static_cast<T>(1.5), static_cast<T>(2)};
+
+	// Keys and derivatives of a cubic, reproduced exactly by the Hermite interpolation
+	vec3 Values[4], Tangents[4];
+	for(std::size_t k = 0; k < 4; ++k)
+	{
+		T const t = Times[k];
+		Values[k] = vec3(t * t * t - t, static_cast<T>(2) * t, static_cast<T>(1) - t * t);
+		Tangents[k] = vec3(static_cast<T>(3) * t * t - static_cast<T>(1), static_cast<T>(2), static_cast<T>(-2) * t);
+	}
+
+	glm::keyframe_track<3, T, Q> Step, Linear, Hermite, CatmullRom;
+	glm::buildKeyframeTrack(Step, glm::keyframe_step, Times, Values, static_cast<vec3 const*>(NULL), 4);
+	glm::buildKeyframeTrack(Linear, glm::keyframe_linear, Times, Values, static_cast<vec3 const*>(NULL), 4);
+	glm::buildKeyframeTrack(Hermite, glm::keyframe_hermite, Times, Values, Tangents, 4);
+	glm::buildKeyframeTrack(CatmullRom, glm::keyframe_hermite, Times, Values, static_cast<vec3 const*>(NULL), 4);
+
+	Error += Step.times.size() == 4 && Step.values[1].size() == 4 && Step.tangents[1].empty() ? 0 : 1;
+	Error += Hermite.tangents[2].size() == 4 ? 0 : 1;
+
+	// Finite differences of the neighbor keys
+	Error += glm::equal(CatmullRom.tangents[0][1], (Values[2].x - Values[0].x) / Times[2], Epsilon) ? 0 : 1;
+	Error += glm::equal(CatmullRom.tangents[2][0], (Values[1].z - Values[0].z) / Times[1], Epsilon) ? 0 : 1;
+
+	std::vector<T> const Samples = sample_times<T>();
+	std::size_t StepSegment = 0, LinearSegment = 0, HermiteSegment = 0, CatmullRomSegment = 0;
+	for(std::size_t i = 0; i < Samples.size(); ++i)
+	{
+		T const Time = Samples[i];
+		T const t = glm::clamp(Time, Times[0], Times[3]);
+
+		std::size_t k = 0;
+		while(k < 3 && Times[k + 1] <= t)
+			++k;
+
+		Error += glm::all(glm::equal(glm::sampleTrack(Step, Time, StepSegment), Values[k], Epsilon)) ? 0 : 1;
+		Error += StepSegment == k ? 0 : 1;
+
+		vec3 const Expected = k == 3 ? Values[3] : glm::mix(Values[k], Values[k + 1], (t - Times[k]) / (Times[k + 1] - Times[k]));
+		Error += glm::all(glm::equal(glm::sampleTrack(Linear, Time, LinearSegment), Expected, Epsilon)) ? 0 : 1;
+
+		vec3 const Cubic(t * t * t - t, static_cast<T>(2) * t, static_cast<T>(1) - t * t);
+		Error += glm::all(glm::equal(glm::sampleTrack(Hermite, Time, HermiteSegment), Cubic, Epsilon)) ? 0 : 1;
+
+		// A fresh cursor finds the same segment by binary search
+		std::size_t Fresh = 0;
+		Error += glm::all(glm::equal(glm::sampleTrack(CatmullRom, Time, CatmullRomSegment), glm::sampleTrack(CatmullRom, Time, Fresh), Epsilon)) ? 0 : 1;
+		Error += Fresh == CatmullRomSegment ? 0 : 1;
+	}
+
+	// A single key is constant
+	glm::keyframe_track<3, T, Q> Single;
+	glm::buildKeyframeTrack(Single, glm::keyframe_hermite, Times, Values, static_cast<vec3 const*>(NULL), 1);
+	for(std::size_t i = 0; i < Samples.size(); ++i)
+	{
+		std::size_t Segment = 0;
+		Error += glm::all(glm::equal(glm::sampleTrack(Single, Samples[i], Segment), Values[0], Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_quat_track()
+{
+	typedef glm::qua<T, Q> quat;
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	T const Times[] = {static_cast<T>(0), static_cast<T>(1), static_cast<T>(1.5), static_cast<T>(3)};
+	quat const Values[] = {
+		glm::angleAxis(static_cast<T>(0.3), glm::normalize(vec3(1, 2, 3))),
+		-glm::angleAxis(static_cast<T>(1.2), glm::normalize(vec3(-1, 0, 2))),
+		glm::angleAxis(static_cast<T>(2.5), glm::normalize(vec3(0, 1, 0))),
+		glm::angleAxis(static_cast<T>(-0.7), glm::normalize(vec3(3, -1, 1)))};
+
+	glm::keyframe_quat_track<T, Q> Step, Linear, Hermite;
+	glm::buildKeyframeTrack(Step, glm::keyframe_step, Times, Values, 4);
+	glm::buildKeyframeTrack(Linear, glm::keyframe_linear, Times, Values, 4);
+	glm::buildKeyframeTrack(Hermite, glm::keyframe_hermite, Times, Values, 4);
+
+	Error += Linear.controls[0].empty() && Hermite.controls[3].size() == 4 ? 0 : 1;
+
+	// Keys in the hemisphere of the previous key
+	for(std::size_t k = 1; k < 4; ++k)
+	{
+		T Dot = static_cast<T>(0);
+		for(glm::length_t c = 0; c < 4; ++c)
+			Dot += Linear.values[c][k - 1] * Linear.values[c][k];
+		Error += Dot >= static_cast<T>(0) ? 0 : 1;
+	}
+
+	std::vector<T> const Samples = sample_times<T>();
+	std::size_t StepSegment = 0, LinearSegment = 0, HermiteSegment = 0;
+	for(std::size_t i = 0; i < Samples.size(); ++i)
+	{
+		T const Time = Samples[i];
+		T const t = glm::clamp(Time, Times[0], Times[3]);
+
+		std::size_t k = 0;
+		while(k < 3 && Times[k + 1] <= t)
+			++k;
+
+		Error += equal_rotation(glm::sampleTrack(Step, Time, StepSegment), Values[k], Epsilon) ? 0 : 1;
+
+		quat const Expected = k == 3 ? Values[3] : glm::slerp(Values[k], Values[k + 1], (t - Times[k]) / (Times[k + 1] - Times[k]));
+		Error += equal_rotation(glm::sampleTrack(Linear, Time, LinearSegment), Expected, Epsilon) ? 0 : 1;
+
+		quat const Squad = glm::sampleTrack(Hermite, Time, HermiteSegment);
+		Error += glm::equal(glm::length(Squad), static_cast<T>(1), Epsilon) ? 0 : 1;
+		if(t == Times[k])
+			Error += equal_rotation(Squad, Values[k], Epsilon) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+// sampleTracks against sampleTrack, for tracks of all interpolations with various numbers of keys
+template<typename T, glm::qualifier Q>
+static int test_tracks(std::size_t Count)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::qua<T, Q> quat;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	glm::keyframe_interpolation const Interpolations[] = {glm::keyframe_step, glm::keyframe_linear, glm::keyframe_hermite};
+
+	std::vector<glm::keyframe_track<3, T, Q> > Tracks(Count);
+	std::vector<glm::keyframe_quat_track<T, Q> > QuatTracks(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		std::size_t const Keys = 1 + i % 6;
+		std::vector<T> Times(Keys, static_cast<T>(0));
+		std::vector<vec3> Values(Keys, vec3(static_cast<T>(0)));
+		std::vector<quat> Quats(Keys, quat(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+		for(std::size_t k = 0; k < Keys; ++k)
+		{
+			T const a = static_cast<T>(i + k * 3);
+			Times[k] = static_cast<T>(k) * static_cast<T>(0.7) + static_cast<T>(i % 3) * static_cast<T>(0.2);
+			Values[k] = vec3(glm::sin(a), glm::cos(a * static_cast<T>(0.5)), a * static_cast<T>(0.1));
+			Quats[k] = glm::angleAxis(a * static_cast<T>(0.9), glm::normalize(vec3(glm::sin(a), static_cast<T>(1), glm::cos(a))));
+		}
+		glm::buildKeyframeTrack(Tracks[i], Interpolations[i % 3], &Times[0], &Values[0], static_cast<vec3 const*>(NULL), Keys);
+		glm::buildKeyframeTrack(QuatTracks[i], Interpolations[(i / 3) % 3], &Times[0], &Quats[0], Keys);
+	}
+
+	std::vector<std::size_t> Segments(Count, 0), QuatSegments(Count, 0);
+	std::vector<vec3> Out(Count, vec3(static_cast<T>(0)));
+	std::vector<quat> QuatOut(Count, quat(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+
+	std::vector<T> const Samples = sample_times<T>();
+	for(std::size_t s = 0; s < Samples.size(); ++s)
+	{
+		glm::sampleTracks(&Tracks[0], Count, Samples[s], &Segments[0], &Out[0]);
+		glm::sampleTracks(&QuatTracks[0], Count, Samples[s], &QuatSegments[0], &QuatOut[0]);
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			std::size_t Segment = 0, QuatSegment = 0;
+			Error += glm::all(glm::equal(Out[i], glm::sampleTrack(Tracks[i], Samples[s], Segment), Epsilon)) ? 0 : 1;
+			Error += Segments[i] == Segment ? 0 : 1;
+			Error += equal_rotation(QuatOut[i], glm::sampleTrack(QuatTracks[i], Samples[s], QuatSegment), Epsilon) ? 0 : 1;
+			Error += QuatSegments[i] == QuatSegment ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+
+struct test_sample_tracks
+{
+	template<typename T, glm::qualifier Q>
+	static int call(std::size_t Count)
+	{
+		return test_tracks<T, Q>(Count);
+	}
+};
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_track<float, glm::defaultp>();
+	Error += test_track<double, glm::defaultp>();
+	Error += test_quat_track<float, glm::defaultp>();
+	Error += test_quat_track<double, glm::defaultp>();
+
+	Error += test_batch_counts<test_sample_tracks>();
+
+	return Error;
+}
@@ -0,0 +1,138 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#define GLM_BATCH_STREAM_THRESHOLD 1024
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtx/matrix_batch.hpp>
+#include <vector>
+#include "batch_counts.hpp"
+
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> make_matrix(std::size_t i)
+{
+	T const f = static_cast<T>(i % 17);
+	glm::mat<4, 4, T, Q> m = glm::translate(glm::mat<4, 4, T, Q>(static_cast<T>(1)), glm::vec<3, T, Q>(f, -f, static_cast<T>(1)));
+	m = glm::rotate(m, f * static_cast<T>(0.1), glm::vec<3, T, Q>(0, 0, 1));
+	m[0][3] = static_cast<T>(0.01) * f;
+	return m;
+}
+
+// The position is followed by a normal and texture coordinates
+template<typename T, glm::qualifier Q>
+struct vertex
+{
+	glm::vec<3, T, Q> Position;
+	glm::vec<3, T, Q> Normal;
+	T TexCoord[2];
+};
+
+// Counts around the stream threshold and the prefetch distance
+template<typename T, glm::qualifier Q>
+static int test_mul_mat(std::size_t Count)
+{
+	typedef glm::mat<4, 4, T, Q> mat4;
+
+	int Error = 0;
+
+	mat4 const M = make_matrix<T, Q>(3);
+	std::vector<mat4> A(Count), B(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		A[i] = make_matrix<T, Q>(i);
+		B[i] = make_matrix<T, Q>(i + 5);
+	}
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	glm::mulBatch(M, &A[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], M * A[i], Epsilon)) ? 0 : 1;
+
+	glm::mulBatch(&A[0], &B[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], A[i] * B[i], Epsilon)) ? 0 : 1;
+
+	// In place
+	std::vector<mat4> C(A);
+	glm::mulBatch(&C[0], &B[0], Count, &C[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(C[i], A[i] * B[i], Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_mul_vec(std::size_t Count)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::vec<4, T, Q> vec4;
+
+	int Error = 0;
+
+	glm::mat<4, 4, T, Q> const M = make_matrix<T, Q>(7);
+	std::vector<vec4> In(Count), Out(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		In[i] = vec4(static_cast<T>(i), static_cast<T>(1), -static_cast<T>(i % 5), static_cast<T>(1));
+
+	T const Epsilon = static_cast<T>(0.001);
+
+	glm::mulBatch(M, &In[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], M * In[i], Epsilon)) ? 0 : 1;
+
+	std::vector<vec4> InPlace(In);
+	glm::mulBatch(M, &InPlace[0], Count, &InPlace[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(InPlace[i], M * In[i], Epsilon)) ? 0 : 1;
+
+	// Interleaved vertices
+	typedef vertex<T, Q> vertex_type;
+	std::vector<vertex_type> Vertices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Vertices[i].Position = vec3(In[i]);
+		Vertices[i].Normal = vec3(0, 0, 1);
+		Vertices[i].TexCoord[0] = Vertices[i].TexCoord[1] = static_cast<T>(i);
+	}
+
+	std::vector<vec3> Positions(Count);
+	glm::mulBatch(M, &Vertices[0].Position, sizeof(vertex_type), Count, &Positions[0], sizeof(vec3));
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Positions[i], vec3(M * In[i]), Epsilon)) ? 0 : 1;
+
+	glm::mulBatch(M, &Vertices[0].Position, sizeof(vertex_type), Count, &Vertices[0].Position, sizeof(vertex_type));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Vertices[i].Position, vec3(M * In[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Vertices[i].Normal, vec3(0, 0, 1), static_cast<T>(0))) ? 0 : 1;
+	}
+
+	// Strided vec4 read into a contiguous output
+	std::vector<vec4> Pairs(Count * 2, vec4(0));
+	for(std::size_t i = 0; i < Count; ++i)
+		Pairs[i * 2] = In[i];
+	glm::mulBatch(M, &Pairs[0], sizeof(vec4) * 2, Count, &Out[0], sizeof(vec4));
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], M * In[i], Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+struct test_mul
+{
+	template<typename T, glm::qualifier Q>
+	static int call(std::size_t Count)
+	{
+		return test_mul_mat<T, Q>(Count) + test_mul_vec<T, Q>(Count);
+	}
+};
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_batch_counts<test_mul>();
+
+	return Error;
+}
@@ -1,7 +1,23 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtx/matrix_decompose.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
 
-int main()
+template<typename T>
+static glm::mat<4, 4, T, glm::defaultp> compose(glm::vec<3, T, glm::defaultp> const& t, glm::qua<T, glm::defaultp> const& r, glm::vec<3, T, glm::defaultp> const& s)
+{
+	glm::mat<4, 4, T, glm::defaultp> const Identity(static_cast<T>(1));
+	return glm::translate(Identity, t) * glm::mat4_cast(r) * glm::scale(Identity, s);
+}
+
+template<typename T>
+static bool same_rotation(glm::qua<T, glm::defaultp> const& a, glm::qua<T, glm::defaultp> const& b, T Epsilon)
+{
+	return glm::abs(glm::abs(glm::dot(a, b)) - static_cast<T>(1)) < Epsilon;
+}
+
+static int test_decompose()
 {
 	int Error(0);
 
@@ -17,3 +33,150 @@ int main()
 
 	return Error;
 }
+
+template<typename T>
+static int test_decompose_affine()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::qua<T, glm::defaultp> quat;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	vec3 const Axes[] = {vec3(1, 0, 0), vec3(0, 1, 0), vec3(0, 0, 1), glm::normalize(vec3(1, 2, 3)), glm::normalize(vec3(-3, 1, 1))};
+	T const Angles[] = {static_cast<T>(0), static_cast<T>(0.5), static_cast<T>(2), static_cast<T>(3.1), static_cast<T>(-2.5)};
+
+	for(std::size_t a = 0; a < sizeof(Axes) / sizeof(Axes[0]); ++a)
+	for(std::size_t b = 0; b < sizeof(Angles) / sizeof(Angles[0]); ++b)
+	{
+		quat const r = glm::angleAxis(Angles[b], Axes[a]);
+		vec3 const t(1, -2, 3);
+		vec3 const s(2, static_cast<T>(0.5), 3);
+
+		vec3 Scale, Translation;
+		quat Orientation;
+		Error += glm::decomposeAffine(compose(t, r, s), Scale, Orientation, Translation) ? 0 : 1;
+		Error += glm::all(glm::equal(Scale, s, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Translation, t, Epsilon)) ? 0 : 1;
+		Error += same_rotation(Orientation, r, Epsilon) ? 0 : 1;
+
+		Error += glm::decomposePolar(compose(t, r, s), Scale, Orientation, Translation) ? 0 : 1;
+		Error += glm::all(glm::equal(Scale, s, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Translation, t, Epsilon)) ? 0 : 1;
+		Error += same_rotation(Orientation, r, Epsilon) ? 0 : 1;
+
+		// Reflection folded into negative scales
+		Error += glm::decomposeAffine(compose(t, r, -s), Scale, Orientation, Translation) ? 0 : 1;
+		Error += glm::all(glm::equal(Scale, -s, Epsilon)) ? 0 : 1;
+		Error += same_rotation(Orientation, r, Epsilon) ? 0 : 1;
+	}
+
+	// Singular linear part
+	vec3 Scale, Translation;
+	quat Orientation;
+	Error += glm::decomposeAffine(compose(vec3(1), quat(1, 0, 0, 0), vec3(1, 0, 1)), Scale, Orientation, Translation) ? 1 : 0;
+	Error += Orientation == quat(1, 0, 0, 0) ? 0 : 1;
+	Error += glm::decomposePolar(compose(vec3(1), quat(1, 0, 0, 0), vec3(1, 0, 1)), Scale, Orientation, Translation) ? 1 : 0;
+
+	return Error;
+}
+
+template<typename T>
+static int test_decompose_polar_shear()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	mat4 Shear(static_cast<T>(1));
+	Shear[1][0] = static_cast<T>(0.7);
+	Shear[2][1] = static_cast<T>(-0.3);
+	mat4 const m = compose(vec3(4, 5, 6), glm::angleAxis(static_cast<T>(1.2), glm::normalize(vec3(1, 1, 0))), vec3(2, 3, 1)) * Shear;
+
+	mat3 Stretch;
+	glm::qua<T, glm::defaultp> Orientation;
+	vec3 Translation;
+	Error += glm::decomposePolar(m, Stretch, Orientation, Translation) ? 0 : 1;
+	Error += glm::all(glm::equal(Translation, vec3(4, 5, 6), Epsilon)) ? 0 : 1;
+	Error += glm::abs(glm::length(Orientation) - static_cast<T>(1)) < Epsilon ? 0 : 1;
+	Error += glm::all(glm::equal(Stretch, glm::transpose(Stretch), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat3_cast(Orientation) * Stretch, mat3(m), Epsilon)) ? 0 : 1;
+
+	// The closest rotation of a reflection is taken on the opposite matrix
+	mat4 const Reflected = m * glm::scale(mat4(static_cast<T>(1)), vec3(-1));
+	Error += glm::decomposePolar(Reflected, Stretch, Orientation, Translation) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat3_cast(Orientation) * Stretch, mat3(Reflected), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+// Odd count to exercise the SIMD loop and the scalar tail
+template<typename T, glm::qualifier Q>
+static int test_decompose_batch()
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::qua<T, glm::defaultp> quat;
+
+	int Error = 0;
+
+	std::size_t const Count = 23;
+	std::vector<glm::mat<4, 4, T, Q> > Matrices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T const f = static_cast<T>(i);
+		quat const r = glm::angleAxis(f * static_cast<T>(0.7) - static_cast<T>(3), glm::normalize(vec3(f - static_cast<T>(10), 1, static_cast<T>(2) - f)));
+		vec3 const s(static_cast<T>(1) + f, i % 3 == 0 ? -static_cast<T>(1) : static_cast<T>(0.5), static_cast<T>(2));
+		Matrices[i] = glm::mat<4, 4, T, Q>(compose(vec3(f, -f, 1), r, i % 3 == 0 ? -s : s));
+	}
+	Matrices[5] = glm::mat<4, 4, T, Q>(compose(vec3(1), quat(1, 0, 0, 0), vec3(0, 1, 1)));
+	Matrices[18] = glm::mat<4, 4, T, Q>(static_cast<T>(0));
+
+	std::vector<T> Tx(Count), Ty(Count), Tz(Count), Rx(Count), Ry(Count), Rz(Count), Rw(Count), Sx(Count), Sy(Count), Sz(Count);
+	Error += glm::decomposeAffine(&Matrices[0], Count, &Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0]) == Count - 2 ? 0 : 1;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat<4, 4, T, glm::defaultp> const m(Matrices[i]);
+		vec3 Scale, Translation;
+		quat Orientation;
+		bool const Regular = glm::decomposeAffine(m, Scale, Orientation, Translation);
+		Error += Regular == (i != 5 && i != 18) ? 0 : 1;
+
+		Error += glm::all(glm::equal(vec3(Tx[i], Ty[i], Tz[i]), Translation, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(vec3(Sx[i], Sy[i], Sz[i]), Scale, Epsilon)) ? 0 : 1;
+		Error += same_rotation(quat(Rw[i], Rx[i], Ry[i], Rz[i]), Orientation, Epsilon) ? 0 : 1;
+		if(Regular)
+			Error += glm::all(glm::equal(compose(Translation, quat(Rw[i], Rx[i], Ry[i], Rz[i]), Scale), m, static_cast<T>(0.001))) ? 0 : 1;
+	}
+
+	Error += glm::decomposePolar(&Matrices[0], Count, &Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0]) == Count - 2 ? 0 : 1;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		if(i == 5 || i == 18)
+			continue;
+		glm::mat<4, 4, T, glm::defaultp> const m(Matrices[i]);
+		Error += glm::all(glm::equal(compose(vec3(Tx[i], Ty[i], Tz[i]), quat(Rw[i], Rx[i], Ry[i], Rz[i]), vec3(Sx[i], Sy[i], Sz[i])), m, static_cast<T>(0.001))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error(0);
+
+	Error += test_decompose();
+	Error += test_decompose_affine<float>();
+	Error += test_decompose_affine<double>();
+	Error += test_decompose_polar_shear<float>();
+	Error += test_decompose_polar_shear<double>();
+	Error += test_decompose_batch<float, glm::defaultp>();
+	Error += test_decompose_batch<double, glm::defaultp>();
+	Error += test_decompose_batch<float, glm::packed_highp>();
+
+	return Error;
+}
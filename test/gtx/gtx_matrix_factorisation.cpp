@@ -2,6 +2,11 @@
 #include <glm/gtx/matrix_factorisation.hpp>
 #include <glm/gtc/constants.hpp>
 #include <glm/gtc/epsilon.hpp>
+#include <glm/gtc/matrix_access.hpp>
+#include <glm/gtx/component_wise.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
 
 template <glm::length_t C, glm::length_t R, typename T, glm::qualifier Q>
 int test_qr(glm::mat<C, R, T, Q> m)
@@ -79,6 +84,269 @@ int test_rq(glm::mat<C, R, T, Q> m)
 	return Error;
 }
 
+template <typename T, glm::qualifier Q>
+static glm::mat<3, 3, T, Q> make_matrix(std::size_t i)
+{
+	T const f = static_cast<T>(i);
+	glm::mat<3, 3, T, Q> m;
+	for (glm::length_t c = 0; c < 3; c++)
+	for (glm::length_t r = 0; r < 3; r++)
+		m[c][r] = glm::sin(f * static_cast<T>(1.7) + static_cast<T>(c * 3 + r)) * static_cast<T>(1 + i % 4);
+	return m;
+}
+
+template <typename T, glm::qualifier Q>
+static int test_rotation(glm::mat<3, 3, T, Q> const& m, T epsilon)
+{
+	int Error = 0;
+	Error += glm::all(glm::equal(glm::transpose(m) * m, glm::mat<3, 3, T, Q>(static_cast<T>(1)), epsilon)) ? 0 : 1;
+	Error += glm::abs(glm::determinant(m) - static_cast<T>(1)) < epsilon ? 0 : 1;
+	return Error;
+}
+
+template <typename T, glm::qualifier Q>
+static int test_svd(glm::mat<3, 3, T, Q> const& m, glm::mat<3, 3, T, Q> const& u, glm::vec<3, T, Q> const& s, glm::mat<3, 3, T, Q> const& v, T epsilon)
+{
+	int Error = 0;
+
+	glm::mat<3, 3, T, Q> Sigma(static_cast<T>(0));
+	Sigma[0][0] = s.x;
+	Sigma[1][1] = s.y;
+	Sigma[2][2] = s.z;
+	Error += glm::all(glm::equal(u * Sigma * glm::transpose(v), m, epsilon)) ? 0 : 1;
+	Error += test_rotation(u, epsilon);
+	Error += test_rotation(v, epsilon);
+
+	//Test if the singular values are sorted and only the smallest can be negative
+	Error += s.x >= glm::abs(s.y) - epsilon && glm::abs(s.y) >= glm::abs(s.z) - epsilon ? 0 : 1;
+	Error += s.y >= -epsilon ? 0 : 1;
+	Error += (s.z < -epsilon) == (glm::determinant(m) < -epsilon) || glm::abs(s.z) < epsilon ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T, glm::qualifier Q>
+static int test_polar(glm::mat<3, 3, T, Q> const& m, glm::mat<3, 3, T, Q> const& r, glm::mat<3, 3, T, Q> const& s, T epsilon)
+{
+	int Error = 0;
+
+	Error += glm::all(glm::equal(r * s, m, epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(s, glm::transpose(s), epsilon)) ? 0 : 1;
+	Error += test_rotation(r, epsilon);
+
+	return Error;
+}
+
+template <typename T, glm::qualifier Q>
+static int test_svd_polar(T epsilon)
+{
+	typedef glm::mat<3, 3, T, Q> mat3;
+
+	int Error = 0;
+
+	// Includes the identity, a reflection, a singular matrix, a null matrix and repeated singular values
+	std::vector<mat3> Matrices;
+	Matrices.push_back(mat3(static_cast<T>(1)));
+	Matrices.push_back(mat3(static_cast<T>(-1)));
+	Matrices.push_back(mat3(1, 2, 3, 4, 5, 6, 7, 8, 9));
+	Matrices.push_back(mat3(static_cast<T>(0)));
+	Matrices.push_back(mat3(2, 0, 0, 0, 0, 2, 0, 2, 0));
+	Matrices.push_back(mat3(12, 6, -4, -51, 167, 24, 4, -68, -41));
+	for (std::size_t i = 0; i < 13; i++)
+		Matrices.push_back(make_matrix<T, Q>(i));
+
+	std::size_t const Count = Matrices.size();
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		mat3 U, V, R, S;
+		glm::vec<3, T, Q> Sigma;
+		glm::svd_decompose(Matrices[i], U, Sigma, V);
+		Error += test_svd(Matrices[i], U, Sigma, V, epsilon * static_cast<T>(10) * glm::max(Sigma.x, static_cast<T>(1)));
+		glm::polar_decompose(Matrices[i], R, S);
+		if (glm::abs(Sigma.z) > epsilon)
+			Error += test_polar(Matrices[i], R, S, epsilon * static_cast<T>(10) * glm::max(Sigma.x, static_cast<T>(1)));
+	}
+
+	//Batch of odd size to exercise the SIMD lanes and the scalar tail
+	std::vector<mat3> U(Count), V(Count), R(Count), S(Count);
+	std::vector<glm::vec<3, T, Q> > Sigma(Count, glm::vec<3, T, Q>(0));
+	glm::svd_decompose(&Matrices[0], Count, &U[0], &Sigma[0], &V[0]);
+	glm::polar_decompose(&Matrices[0], Count, &R[0], &S[0]);
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		T const Epsilon = epsilon * static_cast<T>(10) * glm::max(Sigma[i].x, static_cast<T>(1));
+		Error += test_svd(Matrices[i], U[i], Sigma[i], V[i], Epsilon);
+		if (glm::abs(Sigma[i].z) > epsilon)
+			Error += test_polar(Matrices[i], R[i], S[i], Epsilon);
+	}
+
+	return Error;
+}
+
+template <typename T, glm::qualifier Q>
+static int test_eigen(glm::mat<3, 3, T, Q> const& m, glm::vec<3, T, Q> const& values, glm::mat<3, 3, T, Q> const& vectors, T epsilon)
+{
+	int Error = 0;
+
+	glm::mat<3, 3, T, Q> Lambda(static_cast<T>(0));
+	Lambda[0][0] = values.x;
+	Lambda[1][1] = values.y;
+	Lambda[2][2] = values.z;
+	Error += glm::all(glm::equal(vectors * Lambda * glm::transpose(vectors), m, epsilon)) ? 0 : 1;
+	Error += test_rotation(vectors, epsilon);
+	Error += values.x >= values.y && values.y >= values.z ? 0 : 1;
+
+	return Error;
+}
+
+template <typename T, glm::qualifier Q>
+static int test_eigen_symmetric(T epsilon)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::mat<3, 3, T, Q> mat3;
+
+	int Error = 0;
+
+	// Includes repeated and null eigenvalues, and the covariance of points on a plane
+	std::vector<mat3> Matrices;
+	Matrices.push_back(mat3(static_cast<T>(1)));
+	Matrices.push_back(mat3(static_cast<T>(0)));
+	Matrices.push_back(mat3(2, 0, 0, 0, 5, 0, 0, 0, 2));
+	Matrices.push_back(mat3(2, 1, 0, 1, 2, 0, 0, 0, 3));
+	Matrices.push_back(mat3(1, 0, 0, 0, 1, 0, 0, 0, static_cast<T>(1.00001)));
+	Matrices.push_back(glm::outerProduct(vec3(1, 2, 3), vec3(1, 2, 3)));
+	Matrices.push_back(glm::outerProduct(vec3(1, 0, 1), vec3(1, 0, 1)) + glm::outerProduct(vec3(0, 1, 0), vec3(0, 1, 0)) * static_cast<T>(3));
+	for (std::size_t i = 0; i < 14; i++)
+	{
+		mat3 const m = make_matrix<T, Q>(i);
+		Matrices.push_back(m + glm::transpose(m));
+	}
+
+	std::size_t const Count = Matrices.size();
+	std::vector<vec3> Values(Count, vec3(0));
+	std::vector<mat3> Vectors(Count, mat3(static_cast<T>(0)));
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		glm::eigen_decompose_symmetric(Matrices[i], Values[i], Vectors[i]);
+		Error += test_eigen(Matrices[i], Values[i], Vectors[i], epsilon * static_cast<T>(10) * glm::max(glm::compMax(glm::abs(Values[i])), static_cast<T>(1)));
+	}
+
+	Error += glm::all(glm::equal(Values[2], vec3(5, 2, 2), epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Values[3], vec3(3, 3, 1), epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Values[5], vec3(14, 0, 0), epsilon * static_cast<T>(100))) ? 0 : 1;
+
+	// The normal of the plane x = z is the eigenvector of the smallest eigenvalue
+	Error += glm::abs(Values[6].z) < epsilon ? 0 : 1;
+	Error += glm::abs(glm::abs(glm::dot(Vectors[6][2], glm::normalize(vec3(1, 0, -1)))) - static_cast<T>(1)) < epsilon ? 0 : 1;
+
+	//Batch of odd size to exercise the SIMD lanes and the scalar tail
+	std::vector<vec3> BatchValues(Count, vec3(0));
+	std::vector<mat3> BatchVectors(Count, mat3(static_cast<T>(0)));
+	glm::eigen_decompose_symmetric(&Matrices[0], Count, &BatchValues[0], &BatchVectors[0]);
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		T const Epsilon = epsilon * static_cast<T>(10) * glm::max(glm::compMax(glm::abs(BatchValues[i])), static_cast<T>(1));
+		Error += test_eigen(Matrices[i], BatchValues[i], BatchVectors[i], Epsilon);
+		Error += glm::all(glm::equal(BatchValues[i], Values[i], Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+template <glm::length_t N, typename T, glm::qualifier Q>
+static glm::mat<N, N, T, Q> make_square(std::size_t i)
+{
+	T const f = static_cast<T>(i);
+	glm::mat<N, N, T, Q> m;
+	for (glm::length_t c = 0; c < N; c++)
+	for (glm::length_t r = 0; r < N; r++)
+		m[c][r] = glm::sin(f * static_cast<T>(2.3) + static_cast<T>((c * N + r) * (c * N + r)) * static_cast<T>(0.9)) * static_cast<T>(1 + i % 3);
+	return m;
+}
+
+template <glm::length_t N, typename T, glm::qualifier Q>
+static int test_solve(T epsilon)
+{
+	typedef glm::vec<N, T, Q> vecN;
+	typedef glm::mat<N, N, T, Q> matN;
+
+	int Error = 0;
+
+	// A permutation needs pivoting, the other matrices are random
+	std::vector<matN> Matrices;
+	std::vector<vecN> B;
+	matN Permutation(static_cast<T>(0));
+	for (glm::length_t c = 0; c < N; c++)
+		Permutation[c][(c + 1) % N] = static_cast<T>(1);
+	Matrices.push_back(Permutation);
+	for (std::size_t i = 0; i < 20; i++)
+		Matrices.push_back(make_square<N, T, Q>(i));
+	for (std::size_t i = 0; i < Matrices.size(); i++)
+		B.push_back(glm::column(make_square<N, T, Q>(i + 7), 0));
+
+	std::size_t const Count = Matrices.size();
+	std::vector<vecN> X(Count, vecN(0));
+	glm::solve(&Matrices[0], &B[0], Count, &X[0]);
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		T const Epsilon = epsilon * glm::max(glm::compMax(glm::abs(X[i])), static_cast<T>(1));
+		vecN const x = glm::solve(Matrices[i], B[i]);
+		Error += glm::all(glm::equal(Matrices[i] * x, B[i], Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Matrices[i] * X[i], B[i], Epsilon)) ? 0 : 1;
+
+		matN LU;
+		glm::vec<N, int, Q> Pivots(0);
+		Error += glm::lu_decompose(Matrices[i], LU, Pivots) ? 0 : 1;
+		Error += glm::all(glm::equal(Matrices[i] * glm::lu_solve(LU, Pivots, B[i]), B[i], Epsilon)) ? 0 : 1;
+	}
+
+	matN LU;
+	glm::vec<N, int, Q> Pivots(0);
+	Error += glm::lu_decompose(matN(static_cast<T>(0)), LU, Pivots) ? 1 : 0;
+
+	return Error;
+}
+
+template <glm::length_t N, typename T, glm::qualifier Q>
+static int test_cholesky(T epsilon)
+{
+	typedef glm::vec<N, T, Q> vecN;
+	typedef glm::mat<N, N, T, Q> matN;
+
+	int Error = 0;
+
+	// Symmetric positive definite matrices, and indefinite ones every third matrix
+	std::size_t const Count = 21;
+	std::vector<matN> Matrices;
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		matN const m = make_square<N, T, Q>(i);
+		Matrices.push_back(m * glm::transpose(m) + matN(static_cast<T>(i % 3 == 2 ? -20 : 1)));
+	}
+
+	std::vector<matN> L(Count, matN(static_cast<T>(0)));
+	Error += glm::cholesky(&Matrices[0], Count, &L[0]) == Count - Count / 3 ? 0 : 1;
+	for (std::size_t i = 0; i < Count; i++)
+	{
+		matN l;
+		bool const Definite = glm::cholesky(Matrices[i], l);
+		Error += Definite == (i % 3 != 2) ? 0 : 1;
+		if (!Definite)
+			continue;
+
+		Error += glm::all(glm::equal(l * glm::transpose(l), Matrices[i], epsilon * static_cast<T>(10))) ? 0 : 1;
+		Error += glm::all(glm::equal(L[i], l, epsilon)) ? 0 : 1;
+		for (glm::length_t c = 1; c < N; c++)
+		for (glm::length_t r = 0; r < c; r++)
+			Error += l[c][r] == static_cast<T>(0) ? 0 : 1;
+
+		vecN const b = glm::column(make_square<N, T, Q>(i + 3), 1);
+		Error += glm::all(glm::equal(Matrices[i] * glm::cholesky_solve(l, b), b, epsilon * static_cast<T>(10))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
 int main()
 {
 	int Error = 0;
@@ -101,5 +369,27 @@ int main()
 	//Test QR triangular 2
 	Error += test_rq(glm::dmat4x3(12.0, 6.0, -4.0, -51.0, 167.0, 24.0, 4.0, -68.0, -41.0, 7.0, 2.0, 15.0)) ? 1 : 0;
 
+	//Test QR with nearly dependent columns
+	Error += test_qr(glm::dmat3(1.0, 1.0, 1.0, 1.0, 1.0 + 1e-9, 1.0, 1.0, 1.0, 1.0 + 1e-9)) ? 1 : 0;
+
+	Error += test_svd_polar<float, glm::defaultp>(0.0001f);
+	Error += test_svd_polar<double, glm::defaultp>(0.0000001);
+	Error += test_eigen_symmetric<float, glm::defaultp>(0.0001f);
+	Error += test_eigen_symmetric<double, glm::defaultp>(0.0000001);
+	Error += test_solve<2, float, glm::defaultp>(0.001f);
+	Error += test_solve<3, float, glm::defaultp>(0.001f);
+	Error += test_solve<4, float, glm::defaultp>(0.001f);
+	Error += test_solve<4, double, glm::defaultp>(0.0000001);
+	Error += test_cholesky<2, float, glm::defaultp>(0.0001f);
+	Error += test_cholesky<3, float, glm::defaultp>(0.0001f);
+	Error += test_cholesky<4, float, glm::defaultp>(0.0001f);
+	Error += test_cholesky<3, double, glm::defaultp>(0.0000001);
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += test_svd_polar<float, glm::aligned_highp>(0.0001f);
+		Error += test_eigen_symmetric<float, glm::aligned_highp>(0.0001f);
+		Error += test_solve<4, float, glm::aligned_highp>(0.001f);
+		Error += test_cholesky<4, float, glm::aligned_highp>(0.0001f);
+#	endif
+
 	return Error;
 }
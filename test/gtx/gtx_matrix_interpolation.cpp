@@ -1,8 +1,13 @@
 #define GLM_ENABLE_EXPERIMENTAL
 #include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/scalar_relational.hpp>
 #include <glm/gtx/matrix_interpolation.hpp>
 
 #include <iostream>
+#include <vector>
+#include "batch_counts.hpp"
 
 static int test_axisAngle()
 {
@@ -46,12 +51,105 @@ static int test_rotate()
 	return 0;
 }
 
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> trs(glm::vec<3, T, Q> const& Translation, glm::qua<T, Q> const& Orientation, glm::vec<3, T, Q> const& Scale)
+{
+	return glm::translate(glm::mat<4, 4, T, Q>(static_cast<T>(1)), Translation) * glm::mat4_cast(Orientation) * glm::scale(glm::mat<4, 4, T, Q>(static_cast<T>(1)), Scale);
+}
+
+template<typename T, glm::qualifier Q>
+static int test_interpolator()
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::qua<T, Q> quat;
+	typedef glm::mat<4, 4, T, Q> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	T const Angle = static_cast<T>(2);
+	vec3 const Axis = glm::normalize(vec3(1, -2, 3));
+	quat const Orientation = glm::angleAxis(static_cast<T>(0.7), glm::normalize(vec3(0, 1, 1)));
+	vec3 const Translation1(1, 2, 3), Translation2(-4, 0, 5);
+	vec3 const Scale1(1, 2, static_cast<T>(0.5)), Scale2(3, 1, 1);
+
+	mat4 const m1 = trs(Translation1, Orientation, Scale1);
+	mat4 const m2 = trs(Translation2, glm::angleAxis(Angle, Axis) * Orientation, Scale2);
+
+	glm::matrix_interpolator<T, Q> Interpolator;
+	Error += glm::buildMatrixInterpolator(Interpolator, m1, m2) ? 0 : 1;
+	Error += glm::equal(Interpolator.angle, Angle, Epsilon) ? 0 : 1;
+
+	T const Deltas[] = {static_cast<T>(0), static_cast<T>(0.25), static_cast<T>(0.5), static_cast<T>(1), static_cast<T>(1.5)};
+	for(std::size_t i = 0; i < sizeof(Deltas) / sizeof(Deltas[0]); ++i)
+	{
+		T const Delta = Deltas[i];
+		mat4 const Expected = trs(glm::mix(Translation1, Translation2, Delta), glm::angleAxis(Angle * Delta, Axis) * Orientation, glm::mix(Scale1, Scale2, Delta));
+		Error += glm::all(glm::equal(glm::interpolate(Interpolator, Delta), Expected, Epsilon)) ? 0 : 1;
+	}
+
+	// Orientations in opposite hemispheres are interpolated along the shortest arc
+	mat4 const m3 = trs(Translation1, -(glm::angleAxis(static_cast<T>(0.5), Axis) * Orientation), Scale1);
+	Error += glm::buildMatrixInterpolator(Interpolator, m1, m3) ? 0 : 1;
+	Error += glm::equal(Interpolator.angle, static_cast<T>(0.5), Epsilon) ? 0 : 1;
+
+	// The same matrix twice is constant
+	Error += glm::buildMatrixInterpolator(Interpolator, m2, m2) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::interpolate(Interpolator, static_cast<T>(0.3)), m2, Epsilon)) ? 0 : 1;
+
+	// A singular matrix
+	Error += glm::buildMatrixInterpolator(Interpolator, m1, trs(Translation2, Orientation, vec3(1, 0, 1))) ? 1 : 0;
+
+	return Error;
+}
+
+// The batch interpolation against the scalar interpolation
+template<typename T, glm::qualifier Q>
+static int test_interpolator_batch(std::size_t Count)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::mat<4, 4, T, Q> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	mat4 const m1 = trs(vec3(1, 2, 3), glm::angleAxis(static_cast<T>(-1), glm::normalize(vec3(2, 1, 0))), vec3(1, 1, 2));
+	mat4 const m2 = trs(vec3(0, -1, 2), glm::angleAxis(static_cast<T>(2.5), glm::normalize(vec3(0, 1, 3))), vec3(2, 1, 1));
+
+	glm::matrix_interpolator<T, Q> Interpolator;
+	Error += glm::buildMatrixInterpolator(Interpolator, m1, m2) ? 0 : 1;
+
+	std::vector<T> Deltas(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Deltas[i] = static_cast<T>(-0.25) + static_cast<T>(1.5) * static_cast<T>(i) / static_cast<T>(Count);
+
+	std::vector<mat4> Out(Count, mat4(static_cast<T>(1)));
+	glm::interpolate(Interpolator, &Deltas[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::interpolate(Interpolator, Deltas[i]), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+struct test_interpolate_batch
+{
+	template<typename T, glm::qualifier Q>
+	static int call(std::size_t Count)
+	{
+		return test_interpolator_batch<T, Q>(Count);
+	}
+};
+
 int main()
 {
 	int Error = 0;
 
 	Error += test_axisAngle();
 	Error += test_rotate();
+	Error += test_interpolator<float, glm::defaultp>();
+	Error += test_interpolator<double, glm::defaultp>();
+
+	Error += test_batch_counts<test_interpolate_batch>();
 
 	return Error;
 }
@@ -0,0 +1,95 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/matrix_trs.hpp>
+#include <vector>
+
+template<typename T, glm::qualifier Q>
+static glm::mat<4, 4, T, Q> compose(glm::vec<3, T, Q> const& t, glm::qua<T, Q> const& r, glm::vec<3, T, Q> const& s)
+{
+	glm::mat<4, 4, T, Q> const Identity(static_cast<T>(1));
+	return glm::translate(Identity, t) * glm::mat4_cast(r) * glm::scale(Identity, s);
+}
+
+template<typename T, glm::qualifier Q>
+static int test_trs()
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::mat<4, 4, T, Q> mat4;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.0001);
+	vec3 const t(1, -2, 3);
+	glm::qua<T, Q> const r(glm::angleAxis(static_cast<T>(0.7), glm::normalize(vec3(1, 2, 3))));
+	vec3 const s(2, static_cast<T>(0.5), 3);
+
+	mat4 const m = compose(t, r, s);
+	Error += glm::all(glm::equal(glm::trs(t, r, s), m, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::inverseTRS(t, r, s), glm::inverse(m), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(glm::affineTRS(t, r, s)), m, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::mat4_cast(glm::affineInverseTRS(t, r, s)), glm::inverse(m), Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::trs(t, r, s) * glm::inverseTRS(t, r, s), mat4(static_cast<T>(1)), Epsilon)) ? 0 : 1;
+
+	mat4 const Identity(static_cast<T>(1));
+	Error += glm::all(glm::equal(glm::trs(vec3(0), glm::qua<T, Q>(1, 0, 0, 0), vec3(1)), Identity, static_cast<T>(0))) ? 0 : 1;
+
+	return Error;
+}
+
+// Odd count to exercise the SIMD loop and the scalar tail
+template<typename T, glm::qualifier Q>
+static int test_trs_batch()
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	std::size_t const Count = 11;
+	std::vector<T> Tx(Count), Ty(Count), Tz(Count), Rx(Count), Ry(Count), Rz(Count), Rw(Count), Sx(Count), Sy(Count), Sz(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T const f = static_cast<T>(i);
+		glm::qua<T, Q> const r(glm::angleAxis(f * static_cast<T>(0.4), glm::normalize(vec3(1, f, 2))));
+		Tx[i] = f; Ty[i] = -f; Tz[i] = static_cast<T>(2) * f;
+		Rx[i] = r.x; Ry[i] = r.y; Rz[i] = r.z; Rw[i] = r.w;
+		Sx[i] = static_cast<T>(1) + f; Sy[i] = static_cast<T>(0.5); Sz[i] = static_cast<T>(3) - f * static_cast<T>(0.1);
+	}
+
+	std::vector<glm::mat<4, 4, T, Q> > Matrices(Count), InverseMatrices(Count);
+	std::vector<glm::affine<T, Q> > Affines(Count), InverseAffines(Count);
+	glm::trs(&Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0], Count, &Matrices[0]);
+	glm::trs(&Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0], Count, &Affines[0]);
+	glm::inverseTRS(&Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0], Count, &InverseMatrices[0]);
+	glm::inverseTRS(&Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0], Count, &InverseAffines[0]);
+
+	T const Epsilon = static_cast<T>(0.0001);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::mat<4, 4, T, Q> const m = compose(vec3(Tx[i], Ty[i], Tz[i]), glm::qua<T, Q>(Rw[i], Rx[i], Ry[i], Rz[i]), vec3(Sx[i], Sy[i], Sz[i]));
+		glm::mat<4, 4, T, Q> const n = glm::inverse(m);
+
+		Error += glm::all(glm::equal(Matrices[i], m, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4_cast(Affines[i]), m, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(InverseMatrices[i], n, Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::mat4_cast(InverseAffines[i]), n, Epsilon)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_trs<float, glm::defaultp>();
+	Error += test_trs<double, glm::defaultp>();
+	Error += test_trs_batch<float, glm::defaultp>();
+	Error += test_trs_batch<double, glm::defaultp>();
+	Error += test_trs_batch<float, glm::packed_highp>();
+
+	return Error;
+}
@@ -41,6 +41,51 @@ int test_quat_shortMix()
 	return Error;
 }
 
+// Largest angle between the rotations of fastSlerp and slerp, for angles between the quaternions up to 2 pi
+template<typename T, glm::qualifier Q>
+static double quat_fastSlerp_error()
+{
+	double Error = 0.0;
+
+	for(int i = 0; i <= 64; ++i)
+	for(int j = 0; j <= 32; ++j)
+	{
+		double const Angle = glm::two_pi<double>() * static_cast<double>(i) / 64.0;
+		double const a = static_cast<double>(j) / 32.0;
+		glm::dvec3 const Axis = glm::normalize(glm::dvec3(1.0, static_cast<double>(i % 5) - 2.0, 0.5));
+		glm::dquat const x = glm::angleAxis(static_cast<double>(j) * 0.1, glm::dvec3(0, 1, 0));
+		glm::dquat const y = x * glm::angleAxis(Angle, Axis);
+
+		glm::qua<T, Q> const Approx = glm::fastSlerp(glm::qua<T, Q>(x), glm::qua<T, Q>(y), static_cast<T>(a));
+		glm::dquat const Exact = glm::slerp(x, y, a);
+		glm::dquat const Result(Approx.w, Approx.x, Approx.y, Approx.z);
+		glm::dquat const Diff = glm::dot(Result, Exact) < 0.0 ? Result + Exact : Result - Exact;
+		Error = glm::max(Error, 4.0 * glm::asin(glm::min(glm::length(Diff) * 0.5, 1.0)));
+	}
+
+	return Error;
+}
+
+int test_quat_fastSlerp()
+{
+	int Error = 0;
+
+	Error += quat_fastSlerp_error<double, glm::defaultp>() < 6e-5 ? 0 : 1;
+	Error += quat_fastSlerp_error<float, glm::defaultp>() < 6e-5 ? 0 : 1;
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		Error += quat_fastSlerp_error<float, glm::aligned_highp>() < 6e-5 ? 0 : 1;
+#	endif
+
+	glm::quat const A = glm::angleAxis(0.0f, glm::vec3(0, 0, 1));
+	glm::quat const B = glm::angleAxis(glm::pi<float>() * 0.5f, glm::vec3(0, 0, 1));
+	Error += glm::all(glm::equal(glm::fastSlerp(A, B, 0.0f), A, 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::fastSlerp(A, B, 1.0f), B, 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::fastSlerp(A, -B, 1.0f), B, 0.00001f)) ? 0 : 1;
+	Error += glm::all(glm::equal(glm::fastSlerp(A, B, 0.3f), glm::slerp(A, B, 0.3f), 0.0001f)) ? 0 : 1;
+
+	return Error;
+}
+
 int test_orientation()
 {
 	int Error = 0;
@@ -102,6 +147,7 @@ int main()
 	Error += test_orientation();
 	Error += test_quat_fastMix();
 	Error += test_quat_shortMix();
+	Error += test_quat_fastSlerp();
 
 	return Error;
 }
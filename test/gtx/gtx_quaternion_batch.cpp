@@ -0,0 +1,204 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/quaternion_common.hpp>
+#include <glm/ext/quaternion_geometric.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/quaternion_trigonometric.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/scalar_constants.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+#include <vector>
+#include "batch_counts.hpp"
+
+// Pairs at every angle, including the opposite hemisphere, identical and nearly identical quaternions
+template<typename T, glm::qualifier Q>
+static void make_pair(std::size_t i, glm::qua<T, Q>& x, glm::qua<T, Q>& y)
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	T const f = static_cast<T>(i % 23);
+	vec3 const Axis = glm::normalize(vec3(static_cast<T>(1), f * static_cast<T>(0.3) - static_cast<T>(2), static_cast<T>(i % 3)));
+	x = glm::angleAxis(f * static_cast<T>(0.27), Axis);
+	switch(i % 5)
+	{
+	case 0:
+		y = x;
+		break;
+	case 1:
+		y = -(x * glm::angleAxis(static_cast<T>(0.0001), vec3(0, 1, 0)));
+		break;
+	case 2:
+		y = -(x * glm::angleAxis(f * static_cast<T>(0.13), vec3(0, 0, 1)));
+		break;
+	default:
+		y = x * glm::angleAxis(f * static_cast<T>(0.13) + static_cast<T>(0.5), vec3(Axis.z, Axis.x, Axis.y));
+		break;
+	}
+}
+
+template<typename T, glm::qualifier Q>
+static int test_batch(std::size_t Count)
+{
+	typedef glm::qua<T, Q> quat;
+
+	int Error = 0;
+
+	std::vector<quat> X(Count, quat(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+	std::vector<quat> Y(X), Out(X);
+	std::vector<T> A(Count, static_cast<T>(0));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		make_pair(i, X[i], Y[i]);
+		A[i] = static_cast<T>(i % 9) / static_cast<T>(8);
+	}
+
+	T const Epsilon = static_cast<T>(0.00002);
+
+	glm::slerpBatch(&X[0], &Y[0], &A[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::slerp(X[i], Y[i], A[i]), Epsilon)) ? 0 : 1;
+
+	glm::nlerpBatch(&X[0], &Y[0], &A[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		quat const Z = glm::dot(X[i], Y[i]) < static_cast<T>(0) ? -Y[i] : Y[i];
+		Error += glm::all(glm::equal(Out[i], glm::normalize(X[i] * (static_cast<T>(1) - A[i]) + Z * A[i]), Epsilon)) ? 0 : 1;
+		Error += glm::abs(glm::length(Out[i]) - static_cast<T>(1)) < Epsilon ? 0 : 1;
+	}
+
+	glm::fastSlerpBatch(&X[0], &Y[0], &A[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Out[i], glm::fastSlerp(X[i], Y[i], A[i]), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Out[i], glm::slerp(X[i], Y[i], A[i]), static_cast<T>(0.0001))) ? 0 : 1;
+	}
+
+	// In place
+	std::vector<quat> C(X);
+	glm::slerpBatch(&C[0], &Y[0], &A[0], Count, &C[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(C[i], glm::slerp(X[i], Y[i], A[i]), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static int test_cast(std::size_t Count)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::qua<T, Q> quat;
+	typedef glm::mat<3, 3, T, Q> mat3;
+	typedef glm::mat<3, 4, T, Q> mat3x4;
+	typedef glm::mat<4, 4, T, Q> mat4;
+
+	int Error = 0;
+
+	// Each component in turn is the largest, with half turns about the axes
+	std::vector<quat> X(Count, quat(static_cast<T>(1), static_cast<T>(0), static_cast<T>(0), static_cast<T>(0)));
+	std::vector<quat> Y(X), Out(X);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		make_pair(i, X[i], Y[i]);
+		if(i % 7 < 3)
+			X[i] = glm::angleAxis(glm::pi<T>() - static_cast<T>(i % 5) * static_cast<T>(0.1), vec3(i % 7 == 0, i % 7 == 1, i % 7 == 2));
+	}
+
+	T const Epsilon = static_cast<T>(0.00001);
+
+	std::vector<mat3> M3(Count, mat3(1));
+	glm::mat3CastBatch(&X[0], Count, &M3[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(M3[i], glm::mat3_cast(X[i]), Epsilon)) ? 0 : 1;
+
+	std::vector<mat3x4> M34(Count, mat3x4(1));
+	glm::mat3x4CastBatch(&X[0], Count, &M34[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(M34[i], mat3x4(glm::transpose(glm::mat4_cast(X[i]))), Epsilon)) ? 0 : 1;
+
+	std::vector<mat4> M4(Count, mat4(1));
+	glm::mat4CastBatch(&X[0], Count, &M4[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(M4[i], glm::mat4_cast(X[i]), Epsilon)) ? 0 : 1;
+
+	glm::quatCastBatch(&M3[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Out[i], glm::quat_cast(M3[i]), Epsilon)) ? 0 : 1;
+		Error += glm::abs(glm::dot(Out[i], X[i])) > static_cast<T>(1) - Epsilon ? 0 : 1;
+	}
+
+	glm::quatCastBatch(&M34[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::quat_cast(M3[i]), Epsilon)) ? 0 : 1;
+
+	glm::quatCastBatch(&M4[0], Count, &Out[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Out[i], glm::quat_cast(M4[i]), Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+// Both interpolations reach the end points and take the shortest path
+template<typename T, glm::qualifier Q>
+static int test_shortest_path()
+{
+	typedef glm::qua<T, Q> quat;
+	typedef glm::vec<3, T, Q> vec3;
+
+	int Error = 0;
+
+	T const Epsilon = static_cast<T>(0.00002);
+	T const Angle = static_cast<T>(2.5);
+	quat const x = glm::angleAxis(static_cast<T>(0), vec3(0, 0, 1));
+	quat const y = glm::angleAxis(Angle, vec3(0, 0, 1));
+	quat const Half = glm::angleAxis(Angle * static_cast<T>(0.5), vec3(0, 0, 1));
+
+	quat const X[] = {x, x, x, x, x};
+	quat const Y[] = {y, -y, -y, y, -y};
+	T const A[] = {static_cast<T>(0.5), static_cast<T>(0.5), static_cast<T>(0), static_cast<T>(1), static_cast<T>(1)};
+	quat Out[5];
+
+	glm::slerpBatch(X, Y, A, 5, Out);
+	Error += glm::all(glm::equal(Out[0], Half, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[1], Half, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[2], x, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[3], y, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[4], y, Epsilon)) ? 0 : 1;
+
+	glm::nlerpBatch(X, Y, A, 5, Out);
+	Error += glm::all(glm::equal(Out[0], Half, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[1], Half, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[2], x, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[3], y, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[4], y, Epsilon)) ? 0 : 1;
+
+	glm::fastSlerpBatch(X, Y, A, 5, Out);
+	Error += glm::all(glm::equal(Out[0], Half, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[1], Half, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[2], x, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[3], y, Epsilon)) ? 0 : 1;
+	Error += glm::all(glm::equal(Out[4], y, Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+struct test_batches
+{
+	template<typename T, glm::qualifier Q>
+	static int call(std::size_t Count)
+	{
+		return test_batch<T, Q>(Count) + test_cast<T, Q>(Count);
+	}
+};
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_batch_counts<test_batches>();
+
+	Error += test_shortest_path<float, glm::defaultp>();
+	Error += test_shortest_path<double, glm::defaultp>();
+
+	return Error;
+}
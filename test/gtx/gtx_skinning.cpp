@@ -0,0 +1,267 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+#include <glm/gtx/skinning.hpp>
+#include <glm/ext/scalar_uint_sized.hpp>
+#include <vector>
+#include "batch_counts.hpp"
+
+template<typename T, glm::qualifier Q>
+static glm::tdualquat<T, Q> make_bone(std::size_t i)
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	T const f = static_cast<T>(i);
+	glm::qua<T, Q> const Orientation = glm::angleAxis(f * static_cast<T>(0.7), glm::normalize(vec3(static_cast<T>(1), f - static_cast<T>(2), static_cast<T>(0.5))));
+	glm::tdualquat<T, Q> const Bone(Orientation, vec3(f, -f * static_cast<T>(0.5), static_cast<T>(1)));
+	// Half of the bones in the opposite hemisphere, they represent the same transformations
+	return i % 2 ? -Bone : Bone;
+}
+
+// Reference blend in double precision
+template<typename T, glm::qualifier Q>
+static glm::ddualquat blend(std::vector<glm::tdualquat<T, Q> > const& Bones, glm::u16vec4 const& Index, glm::vec<4, T, Q> const& Weight)
+{
+	glm::ddualquat const First(Bones[Index.x]);
+	glm::ddualquat Result = First * static_cast<double>(Weight.x);
+	for(glm::length_t k = 1; k < 4; ++k)
+	{
+		glm::ddualquat const Bone(Bones[Index[k]]);
+		double const w = static_cast<double>(Weight[k]);
+		Result = Result + Bone * (glm::dot(First.real, Bone.real) < 0.0 ? -w : w);
+	}
+	return glm::normalize(Result);
+}
+
+template<typename T, glm::qualifier Q>
+static int test_dual_quaternion(std::size_t Count)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::vec<4, T, Q> vec4;
+
+	int Error = 0;
+
+	std::size_t const BoneCount = 11;
+	std::vector<glm::tdualquat<T, Q> > Bones;
+	for(std::size_t i = 0; i < BoneCount; ++i)
+		Bones.push_back(make_bone<T, Q>(i));
+
+	std::vector<glm::u16vec4> Indices(Count, glm::u16vec4(0));
+	std::vector<vec4> Weights(Count, vec4(0));
+	std::vector<vec3> Positions(Count, vec3(0)), Normals(Count, vec3(0)), OutPositions(Count, vec3(0)), OutNormals(Count, vec3(0));
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Indices[i] = glm::u16vec4(i % BoneCount, (i + 3) % BoneCount, (i * 7 + 1) % BoneCount, (i * 5) % BoneCount);
+		// Single influences, null weights and weights of different magnitudes
+		Weights[i] = i % 4 == 0 ? vec4(1, 0, 0, 0) : glm::normalize(vec4(static_cast<T>(4), static_cast<T>(i % 3), static_cast<T>(1), static_cast<T>(i % 4) * static_cast<T>(0.5)));
+		Weights[i] /= Weights[i].x + Weights[i].y + Weights[i].z + Weights[i].w;
+		Positions[i] = vec3(static_cast<T>(i % 5), -static_cast<T>(i % 7), static_cast<T>(1));
+		Normals[i] = glm::normalize(vec3(static_cast<T>(1), static_cast<T>(i % 3), -static_cast<T>(1)));
+	}
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	glm::dualQuaternionSkinning(&Bones[0], &Indices[0], &Weights[0], &Positions[0], &Normals[0], Count, &OutPositions[0], &OutNormals[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		glm::ddualquat const Blend = blend(Bones, Indices[i], Weights[i]);
+		Error += glm::all(glm::equal(glm::dvec3(OutPositions[i]), Blend * glm::dvec3(Positions[i]), static_cast<double>(Epsilon))) ? 0 : 1;
+		Error += glm::all(glm::equal(glm::dvec3(OutNormals[i]), Blend.real * glm::dvec3(Normals[i]), static_cast<double>(Epsilon))) ? 0 : 1;
+	}
+
+	// A single influence is the transformation of its bone
+	for(std::size_t i = 0; i < Count; i += 4)
+		Error += glm::all(glm::equal(OutPositions[i], Bones[Indices[i].x] * Positions[i], Epsilon)) ? 0 : 1;
+
+	// In place and without normals
+	std::vector<vec3> InPlace(Positions);
+	glm::dualQuaternionSkinning(&Bones[0], &Indices[0], &Weights[0], &InPlace[0], static_cast<vec3 const*>(0), Count, &InPlace[0], static_cast<vec3*>(0));
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(InPlace[i], OutPositions[i], Epsilon)) ? 0 : 1;
+
+	return Error;
+}
+
+template<typename T, glm::qualifier Q>
+static glm::affine<T, Q> make_affine_bone(std::size_t i)
+{
+	typedef glm::vec<3, T, Q> vec3;
+
+	// Rotations with a non uniform scale
+	glm::mat<3, 3, T, Q> const Scale(vec3(1, 0, 0), vec3(0, static_cast<T>(i % 3 + 1), 0), vec3(0, 0, static_cast<T>(0.5)));
+	glm::mat<3, 3, T, Q> const Linear = glm::mat3_cast(make_bone<T, Q>(i).real) * Scale;
+	return glm::affine<T, Q>(Linear, vec3(static_cast<T>(i), -static_cast<T>(i % 4), static_cast<T>(1)));
+}
+
+template<typename T, glm::qualifier Q>
+struct vertex
+{
+	glm::vec<3, T, Q> Position;
+	glm::vec<3, T, Q> Normal;
+	glm::vec<4, T, Q> Tangent;
+	T Weights[8];
+	glm::uint8 Indices[8];
+
+	vertex()
+		: Position(0), Normal(0), Tangent(0)
+	{
+		for(std::size_t k = 0; k < 8; ++k)
+		{
+			Weights[k] = static_cast<T>(0);
+			Indices[k] = 0;
+		}
+	}
+};
+
+template<typename T, glm::qualifier Q>
+static int test_linear_blend(std::size_t Count, glm::length_t Influences)
+{
+	typedef glm::vec<3, T, Q> vec3;
+	typedef glm::vec<4, T, Q> vec4;
+	typedef glm::vec<3, T, Q> const cvec3;
+
+	int Error = 0;
+
+	std::size_t const BoneCount = 13;
+	std::vector<glm::affine<T, Q> > Bones;
+	std::vector<glm::mat<3, 4, T, Q> > Columns;
+	for(std::size_t i = 0; i < BoneCount; ++i)
+	{
+		Bones.push_back(make_affine_bone<T, Q>(i));
+		Columns.push_back(glm::mat3x4_cast(Bones.back()));
+	}
+
+	// Packed arrays of attributes
+	std::size_t const Size = static_cast<std::size_t>(Influences);
+	std::vector<glm::uint16> Indices(Count * Size, 0);
+	std::vector<T> Weights(Count * Size, 0);
+	std::vector<vec3> Positions(Count, vec3(0)), Normals(Count, vec3(0)), Tangents(Count, vec3(0)), OutPositions(Count, vec3(0)), OutNormals(Count, vec3(0)), OutTangents(Count, vec3(0));
+	// Interleaved vertices skinned in place
+	std::vector<vertex<T, Q> > Vertices(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		T Sum = static_cast<T>(0);
+		for(std::size_t k = 0; k < Size; ++k)
+		{
+			Indices[i * Size + k] = static_cast<glm::uint16>((i * 7 + k * 5 + 1) % BoneCount);
+			Weights[i * Size + k] = k == 0 ? static_cast<T>(2) : static_cast<T>((i + k) % 4);
+			Sum += Weights[i * Size + k];
+		}
+		for(std::size_t k = 0; k < Size; ++k)
+			Weights[i * Size + k] /= Sum;
+		Positions[i] = vec3(static_cast<T>(i % 5), -static_cast<T>(i % 7), static_cast<T>(1));
+		Normals[i] = glm::normalize(vec3(static_cast<T>(1), static_cast<T>(i % 3), -static_cast<T>(1)));
+		Tangents[i] = glm::normalize(vec3(static_cast<T>(i % 2), static_cast<T>(1), static_cast<T>(i % 3)));
+
+		Vertices[i].Position = Positions[i];
+		Vertices[i].Normal = Normals[i];
+		Vertices[i].Tangent = vec4(Tangents[i], -static_cast<T>(1));
+		for(std::size_t k = 0; k < Size; ++k)
+		{
+			Vertices[i].Indices[k] = static_cast<glm::uint8>(Indices[i * Size + k]);
+			Vertices[i].Weights[k] = Weights[i * Size + k];
+		}
+	}
+
+	glm::skinning_streams<T, Q, glm::uint16> Streams;
+	Streams.indices = glm::influenceStream<glm::uint16 const>(&Indices[0], Influences);
+	Streams.weights = glm::vertex_stream<T const>(&Weights[0], sizeof(T) * Size);
+	Streams.influences = Influences;
+	Streams.positions = glm::vertex_stream<cvec3>(&Positions[0]);
+	Streams.normals = glm::vertex_stream<cvec3>(&Normals[0]);
+	Streams.tangents = glm::vertex_stream<cvec3>(&Tangents[0]);
+	Streams.outPositions = glm::vertex_stream<vec3>(&OutPositions[0]);
+	Streams.outNormals = glm::vertex_stream<vec3>(&OutNormals[0]);
+	Streams.outTangents = glm::vertex_stream<vec3>(&OutTangents[0]);
+	glm::linearBlendSkinning(&Bones[0], Streams, Count);
+
+	T const Epsilon = static_cast<T>(0.0001);
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		vec4 Position(0), Normal(0), Tangent(0);
+		for(std::size_t k = 0; k < Size; ++k)
+		{
+			glm::mat<4, 4, T, Q> const Bone = glm::mat4_cast(Bones[Indices[i * Size + k]]);
+			T const w = Weights[i * Size + k];
+			Position += Bone * vec4(Positions[i], 1) * w;
+			Normal += Bone * vec4(Normals[i], 0) * w;
+			Tangent += Bone * vec4(Tangents[i], 0) * w;
+		}
+		Error += glm::all(glm::equal(OutPositions[i], vec3(Position), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(OutNormals[i], vec3(Normal), Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(OutTangents[i], vec3(Tangent), Epsilon)) ? 0 : 1;
+	}
+
+	// mat3x4 bones, positions only
+	std::vector<vec3> Columned(Count, vec3(0));
+	glm::skinning_streams<T, Q, glm::uint16> PositionStreams;
+	PositionStreams.indices = Streams.indices;
+	PositionStreams.weights = Streams.weights;
+	PositionStreams.influences = Influences;
+	PositionStreams.positions = Streams.positions;
+	PositionStreams.outPositions = glm::vertex_stream<vec3>(&Columned[0]);
+	glm::linearBlendSkinning(&Columns[0], PositionStreams, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Columned[i], OutPositions[i], Epsilon)) ? 0 : 1;
+
+	// Interleaved vertices in place, the handedness of the tangents is preserved
+	std::size_t const Stride = sizeof(vertex<T, Q>);
+	glm::skinning_streams<T, Q, glm::uint8> Interleaved;
+	Interleaved.indices = glm::vertex_stream<glm::uint8 const>(&Vertices[0].Indices[0], Stride);
+	Interleaved.weights = glm::vertex_stream<T const>(&Vertices[0].Weights[0], Stride);
+	Interleaved.influences = Influences;
+	Interleaved.positions = glm::vertex_stream<cvec3>(&Vertices[0].Position, Stride);
+	Interleaved.normals = glm::vertex_stream<cvec3>(&Vertices[0].Normal, Stride);
+	Interleaved.tangents = glm::vertex_stream<cvec3>(reinterpret_cast<cvec3*>(&Vertices[0].Tangent), Stride);
+	Interleaved.outPositions = glm::vertex_stream<vec3>(&Vertices[0].Position, Stride);
+	Interleaved.outNormals = glm::vertex_stream<vec3>(&Vertices[0].Normal, Stride);
+	Interleaved.outTangents = glm::vertex_stream<vec3>(reinterpret_cast<vec3*>(&Vertices[0].Tangent), Stride);
+	glm::linearBlendSkinning(&Bones[0], Interleaved, Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Vertices[i].Position, OutPositions[i], Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Vertices[i].Normal, OutNormals[i], Epsilon)) ? 0 : 1;
+		Error += glm::all(glm::equal(Vertices[i].Tangent, vec4(OutTangents[i], -1), Epsilon)) ? 0 : 1;
+	}
+
+#	if GLM_HAS_CXX11_STL
+	{
+		std::vector<vec3> Parallel(Count, vec3(0));
+		PositionStreams.outPositions = glm::vertex_stream<vec3>(&Parallel[0]);
+		glm::linearBlendSkinningParallel(&Bones[0], PositionStreams, Count, 3);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Parallel[i], OutPositions[i], Epsilon)) ? 0 : 1;
+	}
+#	endif//GLM_HAS_CXX11_STL
+
+	return Error;
+}
+
+struct test_skinning
+{
+	template<typename T, glm::qualifier Q>
+	static int call(std::size_t Count)
+	{
+		int Error = test_dual_quaternion<T, Q>(Count);
+		for(glm::length_t Influences = 1; Influences <= 8; ++Influences)
+			Error += test_linear_blend<T, Q>(Count, Influences);
+		return Error;
+	}
+};
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_batch_counts<test_skinning>();
+
+#	if GLM_HAS_CXX11_STL
+		// Several chunks of vertices per thread
+		Error += test_linear_blend<float, glm::defaultp>(5000, 4);
+#	endif
+
+	return Error;
+}
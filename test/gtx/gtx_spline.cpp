@@ -3,6 +3,10 @@
 #include <glm/vec3.hpp>
 #include <glm/vec4.hpp>
 #include <glm/gtx/spline.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <vector>
+#include "batch_counts.hpp"
 
 namespace catmullRom
 {
@@ -88,6 +92,167 @@ namespace cubic
 	}
 }//catmullRom
 
+namespace cubic_spline
+{
+	template<typename T, glm::qualifier Q>
+	static int test_points(std::size_t Count)
+	{
+		typedef glm::vec<3, T, Q> vec3;
+
+		int Error = 0;
+
+		T const Epsilon = static_cast<T>(0.0001);
+		std::size_t const Points = 6;
+
+		vec3 p[Points], t[Points], v[(Points - 1) * 4];
+		for(std::size_t i = 0; i < Points; ++i)
+		{
+			T const a = static_cast<T>(i);
+			p[i] = vec3(glm::cos(a), glm::sin(a * static_cast<T>(0.7)), a * static_cast<T>(0.3));
+			t[i] = vec3(-glm::sin(a), static_cast<T>(0.5) * glm::cos(a), static_cast<T>(0.3));
+		}
+		for(std::size_t i = 0; i < (Points - 1) * 4; ++i)
+			v[i] = p[i % Points] * static_cast<T>(i % 3) - t[(i + 1) % Points];
+
+		glm::cubic_spline<3, T, Q> CatmullRom, Hermite, Cubic;
+		glm::buildCatmullRomSpline(CatmullRom, p, Points);
+		glm::buildHermiteSpline(Hermite, p, t, Points);
+		glm::buildCubicSpline(Cubic, v, Points - 1);
+		Error += glm::splineSegments(CatmullRom) == Points - 1 && glm::splineSegments(Cubic) == Points - 1 ? 0 : 1;
+
+		// Parameters in the segments, on the ends of the segments and outside of the curve
+		std::vector<T> u(Count, static_cast<T>(0));
+		for(std::size_t i = 0; i < Count; ++i)
+			u[i] = static_cast<T>(i % 23) * static_cast<T>(0.25) - static_cast<T>(0.5);
+
+		std::vector<vec3> Out(Count, vec3(static_cast<T>(0)));
+		std::vector<vec3> Derivatives(Count, vec3(static_cast<T>(0)));
+		std::vector<vec3> SecondDerivatives(Count, vec3(static_cast<T>(0)));
+		for(int Curve = 0; Curve < 3; ++Curve)
+		{
+			glm::cubic_spline<3, T, Q> const& Spline = Curve == 0 ? CatmullRom : (Curve == 1 ? Hermite : Cubic);
+			glm::sampleSpline(Spline, &u[0], Count, &Out[0]);
+			glm::sampleSplineDerivative(Spline, &u[0], Count, &Derivatives[0]);
+			glm::sampleSplineSecondDerivative(Spline, &u[0], Count, &SecondDerivatives[0]);
+
+			for(std::size_t i = 0; i < Count; ++i)
+			{
+				T const Clamped = glm::clamp(u[i], static_cast<T>(0), static_cast<T>(Points - 1));
+				std::size_t const k = glm::min(static_cast<std::size_t>(Clamped), Points - 2);
+				T const s = Clamped - static_cast<T>(k);
+
+				// The derivative of hermite and of the other curves are checked with central differences of the scalar functions
+				T const h = static_cast<T>(0.001);
+				vec3 Expected[3];
+				for(int d = 0; d < 3; ++d)
+				{
+					T const x = s + h * static_cast<T>(d - 1);
+					if(Curve == 0)
+						Expected[d] = glm::catmullRom(p[k > 0 ? k - 1 : 0], p[k], p[k + 1], p[glm::min(k + 2, Points - 1)], x);
+					else if(Curve == 1)
+						Expected[d] = glm::hermite(p[k], t[k], p[k + 1], t[k + 1], x);
+					else
+						Expected[d] = glm::cubic(v[k * 4], v[k * 4 + 1], v[k * 4 + 2], v[k * 4 + 3], x);
+				}
+
+				Error += glm::all(glm::equal(Out[i], Expected[1], Epsilon)) ? 0 : 1;
+				Error += glm::all(glm::equal(Derivatives[i], (Expected[2] - Expected[0]) / (h * static_cast<T>(2)), static_cast<T>(0.01))) ? 0 : 1;
+				Error += glm::all(glm::equal(SecondDerivatives[i], (Expected[2] - Expected[1] * static_cast<T>(2) + Expected[0]) / (h * h), static_cast<T>(0.5))) ? 0 : 1;
+			}
+		}
+
+		// The Hermite curve interpolates the points with the tangents
+		for(std::size_t i = 0; i < Points; ++i)
+		{
+			T const Parameter = static_cast<T>(i);
+			vec3 Point, Tangent;
+			glm::sampleSpline(Hermite, &Parameter, 1, &Point);
+			glm::sampleSplineDerivative(Hermite, &Parameter, 1, &Tangent);
+			Error += glm::all(glm::equal(Point, p[i], Epsilon)) ? 0 : 1;
+			Error += glm::all(glm::equal(Tangent, t[i], Epsilon)) ? 0 : 1;
+		}
+
+		return Error;
+	}
+
+	template<typename T, glm::qualifier Q>
+	static int test_arc_length(std::size_t Count)
+	{
+		typedef glm::vec<2, T, Q> vec2;
+
+		int Error = 0;
+
+		// Collinear points at uneven distances, the length is the distance between the ends
+		vec2 const Line[] = {vec2(0, 0), vec2(1, 0), vec2(3, 0), vec2(3.5, 0)};
+		glm::cubic_spline<2, T, Q> Spline;
+		glm::buildCatmullRomSpline(Spline, Line, 4);
+		glm::buildSplineArcLengths(Spline, 8);
+		Error += Spline.arcLengths.size() == 3 * 8 + 1 ? 0 : 1;
+		Error += glm::equal(glm::splineLength(Spline), static_cast<T>(3.5), static_cast<T>(0.0001)) ? 0 : 1;
+
+		// A curve with varying speed, against its polyline
+		vec2 const Points[] = {vec2(0, 0), vec2(1, 2), vec2(3, 1), vec2(4, 4), vec2(2, 5)};
+		glm::buildCatmullRomSpline(Spline, Points, 5);
+		glm::buildSplineArcLengths(Spline, 4);
+
+		std::size_t const Polyline = 20000;
+		T PolylineLength = static_cast<T>(0);
+		vec2 Previous = Points[0];
+		for(std::size_t i = 1; i <= Polyline; ++i)
+		{
+			T const Parameter = static_cast<T>(4) * static_cast<T>(i) / static_cast<T>(Polyline);
+			vec2 Point;
+			glm::sampleSpline(Spline, &Parameter, 1, &Point);
+			PolylineLength += glm::distance(Previous, Point);
+			Previous = Point;
+		}
+		T const Length = glm::splineLength(Spline);
+		Error += glm::equal(Length, PolylineLength, static_cast<T>(0.001)) ? 0 : 1;
+
+		// Points at uniform distances along the curve are separated by chords of the same length
+		std::vector<T> Lengths(Count + 1, static_cast<T>(0)), u(Count + 1, static_cast<T>(0));
+		for(std::size_t i = 0; i <= Count; ++i)
+			Lengths[i] = Length * static_cast<T>(i) / static_cast<T>(Count + 200);
+		glm::splineLengthToParameter(Spline, &Lengths[0], Count + 1, &u[0]);
+
+		std::vector<vec2> Out(Count + 1, vec2(static_cast<T>(0)));
+		glm::sampleSpline(Spline, &u[0], Count + 1, &Out[0]);
+		T const Step = Length / static_cast<T>(Count + 200);
+		for(std::size_t i = 1; i <= Count; ++i)
+		{
+			Error += u[i] > u[i - 1] ? 0 : 1;
+			Error += glm::equal(glm::distance(Out[i - 1], Out[i]), Step, Step * static_cast<T>(0.001)) ? 0 : 1;
+		}
+
+		// Lengths beyond the curve are clamped to its ends
+		T const Outside[] = {static_cast<T>(-1), Length + static_cast<T>(1)};
+		T OutsideParameters[2] = {static_cast<T>(0), static_cast<T>(0)};
+		glm::splineLengthToParameter(Spline, Outside, 2, OutsideParameters);
+		Error += glm::equal(OutsideParameters[0], static_cast<T>(0), static_cast<T>(0.0001)) ? 0 : 1;
+		Error += glm::equal(OutsideParameters[1], static_cast<T>(4), static_cast<T>(0.0001)) ? 0 : 1;
+
+		return Error;
+	}
+
+	struct test_sample
+	{
+		template<typename T, glm::qualifier Q>
+		static int call(std::size_t Count)
+		{
+			return test_points<T, Q>(Count) + test_arc_length<T, Q>(Count);
+		}
+	};
+
+	int test()
+	{
+		int Error = 0;
+
+		Error += test_batch_counts<test_sample>();
+
+		return Error;
+	}
+}//namespace cubic_spline
+
 int main()
 {
 	int Error(0);
@@ -95,6 +260,7 @@ int main()
 	Error += catmullRom::test();
 	Error += hermite::test();
 	Error += cubic::test();
+	Error += cubic_spline::test();
 
 	return Error;
 }
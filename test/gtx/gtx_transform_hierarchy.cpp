@@ -0,0 +1,249 @@
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtx/transform_hierarchy.hpp>
+#include <vector>
+
+// Breadth first hierarchy: two roots, then each node has a parent in the previous level
+static std::vector<glm::int32> make_parents(std::size_t Levels, std::vector<std::size_t>& LevelOffsets)
+{
+	std::vector<glm::int32> Parents;
+	LevelOffsets.clear();
+	LevelOffsets.push_back(0);
+
+	Parents.push_back(-1);
+	Parents.push_back(-1);
+	LevelOffsets.push_back(Parents.size());
+	for(std::size_t l = 1; l < Levels; ++l)
+	{
+		std::size_t const First = LevelOffsets[l - 1];
+		std::size_t const Size = LevelOffsets[l] - First;
+		for(std::size_t i = 0; i < Size * 3; ++i)
+			Parents.push_back(static_cast<glm::int32>(First + (i * 7) % Size));
+		LevelOffsets.push_back(Parents.size());
+	}
+	return Parents;
+}
+
+template<typename matType>
+static std::vector<matType> make_locals(std::size_t Count)
+{
+	std::vector<matType> Locals(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		float const f = static_cast<float>(i % 13);
+		glm::mat4 const m = glm::rotate(glm::translate(glm::mat4(1.0f), glm::vec3(f * 0.1f, 1.0f, -f * 0.05f)), f * 0.2f, glm::vec3(0, 1, 0));
+		Locals[i] = matType(m);
+	}
+	return Locals;
+}
+
+static int test_propagate()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> Expected;
+	std::vector<glm::int32> const Parents = make_parents(6, Expected);
+	std::size_t const Count = Parents.size();
+	std::vector<glm::mat4> const Locals = make_locals<glm::mat4>(Count);
+
+	std::vector<glm::mat4> Reference(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Reference[i] = Parents[i] < 0 ? Locals[i] : Reference[Parents[i]] * Locals[i];
+
+	std::vector<glm::mat4> Worlds(Count);
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Worlds[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Worlds[i], Reference[i], 0.001f)) ? 0 : 1;
+
+	std::vector<glm::faffine> const AffineLocals = make_locals<glm::faffine>(Count);
+	std::vector<glm::faffine> AffineWorlds(Count);
+	glm::propagateTransforms(&Parents[0], &AffineLocals[0], Count, &AffineWorlds[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(glm::mat4_cast(AffineWorlds[i]), Reference[i], 0.001f)) ? 0 : 1;
+
+#	if GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+		std::vector<glm::mat<4, 4, float, glm::aligned_highp> > AlignedLocals(Count), AlignedWorlds(Count);
+		for(std::size_t i = 0; i < Count; ++i)
+			AlignedLocals[i] = glm::mat<4, 4, float, glm::aligned_highp>(Locals[i]);
+		glm::propagateTransforms(&Parents[0], &AlignedLocals[0], Count, &AlignedWorlds[0]);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(glm::mat4(AlignedWorlds[i]), Reference[i], 0.001f)) ? 0 : 1;
+#	endif//GLM_CONFIG_ALIGNED_GENTYPES == GLM_ENABLE
+
+	return Error;
+}
+
+static int test_propagate_dirty()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> Expected;
+	std::vector<glm::int32> const Parents = make_parents(5, Expected);
+	std::size_t const Count = Parents.size();
+	std::vector<glm::mat4> Locals = make_locals<glm::mat4>(Count);
+
+	std::vector<glm::mat4> Worlds(Count);
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Worlds[0]);
+
+	// Change the local transformation of node 2, only its subtree is recomputed
+	std::size_t const Changed = 2;
+	Locals[Changed] = glm::scale(Locals[Changed], glm::vec3(2.0f));
+	std::vector<glm::uint32> Dirty((Count + 31) / 32, 0);
+	Dirty[Changed / 32] |= 1u << (Changed % 32);
+
+	std::vector<bool> InSubtree(Count, false);
+	std::size_t SubtreeSize = 0;
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		InSubtree[i] = i == Changed || (Parents[i] >= 0 && InSubtree[Parents[i]]);
+		SubtreeSize += InSubtree[i] ? 1 : 0;
+	}
+
+	std::vector<glm::mat4> Stale(Worlds);
+	std::size_t const Updated = glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Dirty[0], &Worlds[0]);
+	Error += Updated == SubtreeSize ? 0 : 1;
+
+	std::vector<glm::mat4> Reference(Count);
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Reference[0]);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Worlds[i], Reference[i], 0.001f)) ? 0 : 1;
+		Error += (((Dirty[i / 32] >> (i % 32)) & 1u) != 0) == InSubtree[i] ? 0 : 1;
+		if(!InSubtree[i])
+			Error += glm::all(glm::equal(Worlds[i], Stale[i], 0.0f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+static int test_levels()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> Expected;
+	std::vector<glm::int32> const Parents = make_parents(5, Expected);
+
+	std::vector<std::size_t> Levels;
+	Error += glm::transformHierarchyLevels(&Parents[0], Parents.size(), Levels) ? 0 : 1;
+	Error += Levels == Expected ? 0 : 1;
+
+	// Topologically sorted but not breadth first
+	glm::int32 const DepthFirst[] = {-1, 0, 1, 0};
+	Error += glm::transformHierarchyLevels(DepthFirst, 4, Levels) ? 1 : 0;
+	Error += Levels.empty() ? 0 : 1;
+
+	// Child before its parent
+	glm::int32 const Unsorted[] = {-1, 2, 0};
+	Error += glm::transformHierarchyLevels(Unsorted, 3, Levels) ? 1 : 0;
+
+	return Error;
+}
+
+#if GLM_HAS_CXX11_STL
+static int test_propagate_parallel()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> Levels;
+	std::vector<glm::int32> const Parents = make_parents(8, Levels);
+	std::size_t const Count = Parents.size();
+	std::vector<glm::mat4> Locals = make_locals<glm::mat4>(Count);
+	std::vector<glm::faffine> AffineLocals = make_locals<glm::faffine>(Count);
+
+	std::vector<glm::mat4> Reference(Count);
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Reference[0]);
+
+	for(unsigned Threads = 1; Threads <= 4; ++Threads)
+	{
+		std::vector<glm::mat4> Worlds(Count);
+		glm::propagateTransformsParallel(&Parents[0], &Locals[0], Levels, static_cast<glm::uint32*>(GLM_NULLPTR), &Worlds[0], Threads);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(Worlds[i], Reference[i], 0.0f)) ? 0 : 1;
+
+		std::vector<glm::faffine> AffineWorlds(Count);
+		glm::propagateTransformsParallel(&Parents[0], &AffineLocals[0], Levels, static_cast<glm::uint32*>(GLM_NULLPTR), &AffineWorlds[0], Threads);
+		for(std::size_t i = 0; i < Count; ++i)
+			Error += glm::all(glm::equal(glm::mat4_cast(AffineWorlds[i]), Reference[i], 0.001f)) ? 0 : 1;
+	}
+
+	// Incremental update of every fifth root child subtree
+	std::vector<glm::uint32> Dirty((Count + 31) / 32, 0);
+	for(std::size_t i = Levels[1]; i < Levels[2]; i += 5)
+	{
+		Locals[i] = glm::translate(Locals[i], glm::vec3(1.0f));
+		Dirty[i / 32] |= 1u << (i % 32);
+	}
+	std::vector<glm::uint32> SequentialDirty(Dirty);
+
+	std::vector<glm::mat4> Sequential(Reference), Parallel(Reference);
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &SequentialDirty[0], &Sequential[0]);
+	glm::propagateTransformsParallel(&Parents[0], &Locals[0], Levels, &Dirty[0], &Parallel[0], 4);
+	Error += Dirty == SequentialDirty ? 0 : 1;
+	for(std::size_t i = 0; i < Count; ++i)
+		Error += glm::all(glm::equal(Sequential[i], Parallel[i], 0.0f)) ? 0 : 1;
+
+	return Error;
+}
+
+// Nodes flagged in every level, whose words straddle the level boundaries and the slices of the threads,
+// so that the threads of a level update flags next to the flags read or written by the other threads
+static int test_propagate_parallel_dirty()
+{
+	int Error = 0;
+
+	std::vector<std::size_t> Levels;
+	std::vector<glm::int32> const Parents = make_parents(9, Levels);
+	std::size_t const Count = Parents.size();
+	std::vector<glm::mat4> const Locals = make_locals<glm::mat4>(Count);
+
+	std::vector<glm::mat4> Previous(Count);
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Previous[0]);
+
+	unsigned const ThreadCounts[] = {2, 3, 4, 8};
+	for(std::size_t t = 0; t < sizeof(ThreadCounts) / sizeof(ThreadCounts[0]); ++t)
+	for(std::size_t Run = 0; Run < 8; ++Run)
+	{
+		std::vector<glm::mat4> Moved(Locals);
+		std::vector<glm::uint32> Dirty((Count + 31) / 32, 0);
+		for(std::size_t i = Run; i < Count; i += 37 + Run)
+		{
+			Moved[i] = glm::translate(Moved[i], glm::vec3(0.5f));
+			Dirty[i / 32] |= 1u << (i % 32);
+		}
+		std::vector<glm::uint32> SequentialDirty(Dirty);
+
+		std::vector<glm::mat4> Reference(Count);
+		glm::propagateTransforms(&Parents[0], &Moved[0], Count, &Reference[0]);
+
+		std::vector<glm::mat4> Sequential(Previous), Parallel(Previous);
+		glm::propagateTransforms(&Parents[0], &Moved[0], Count, &SequentialDirty[0], &Sequential[0]);
+		glm::propagateTransformsParallel(&Parents[0], &Moved[0], Levels, &Dirty[0], &Parallel[0], ThreadCounts[t]);
+
+		Error += Dirty == SequentialDirty ? 0 : 1;
+		for(std::size_t i = 0; i < Count; ++i)
+		{
+			Error += glm::all(glm::equal(Sequential[i], Parallel[i], 0.0f)) ? 0 : 1;
+			Error += glm::all(glm::equal(Parallel[i], Reference[i], 0.0f)) ? 0 : 1;
+		}
+	}
+
+	return Error;
+}
+#endif//GLM_HAS_CXX11_STL
+
+int main()
+{
+	int Error = 0;
+
+	Error += test_propagate();
+	Error += test_propagate_dirty();
+	Error += test_levels();
+#	if GLM_HAS_CXX11_STL
+		Error += test_propagate_parallel();
+		Error += test_propagate_parallel_dirty();
+#	endif//GLM_HAS_CXX11_STL
+
+	return Error;
+}
@@ -0,0 +1,89 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/affine.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+static int launch_affine(std::size_t Samples)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> Matrices(Samples);
+	std::vector<glm::faffine> Affines(Samples);
+	std::vector<glm::vec3> Points(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::mat4 m = glm::translate(glm::mat4(1), glm::linearRand(glm::vec3(-1), glm::vec3(1)));
+		m = glm::rotate(m, glm::linearRand(-3.f, 3.f), glm::sphericalRand(1.f));
+		Matrices[i] = glm::scale(m, glm::linearRand(glm::vec3(0.5f), glm::vec3(2.0f)));
+		Affines[i] = glm::faffine(Matrices[i]);
+		Points[i] = glm::linearRand(glm::vec3(-1), glm::vec3(1));
+	}
+
+	std::vector<glm::mat4> MatrixResults(Samples);
+	std::vector<glm::faffine> AffineResults(Samples);
+	std::vector<glm::vec3> MatrixPoints(Samples);
+	std::vector<glm::vec3> AffinePoints(Samples);
+
+	// Parent * child products as in a transform hierarchy
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t i = 1; i < Samples; ++i)
+		MatrixResults[i] = Matrices[i - 1] * Matrices[i];
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t i = 1; i < Samples; ++i)
+		AffineResults[i] = Affines[i - 1] * Affines[i];
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		MatrixPoints[i] = glm::vec3(Matrices[i] * glm::vec4(Points[i], 1));
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		AffinePoints[i] = glm::transformPoint(Affines[i], Points[i]);
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		MatrixResults[i] = glm::affineInverse(Matrices[i]);
+	perf_clock::time_point const t5 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		AffineResults[i] = glm::inverse(Affines[i]);
+	perf_clock::time_point const t6 = perf_clock::now();
+
+	printf("%d transforms:\n", static_cast<int>(Samples));
+	printf("- mat4 * mat4: %d us\n", microseconds(t0, t1));
+	printf("- affine * affine: %d us\n", microseconds(t1, t2));
+	printf("- mat4 * vec4: %d us\n", microseconds(t2, t3));
+	printf("- transformPoint: %d us\n", microseconds(t3, t4));
+	printf("- affineInverse(mat4): %d us\n", microseconds(t4, t5));
+	printf("- inverse(affine): %d us\n", microseconds(t5, t6));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::lessThan(glm::abs(MatrixPoints[i] - AffinePoints[i]), glm::vec3(0.001f))) ? 0 : 1;
+		Error += glm::all(glm::lessThan(glm::abs(glm::mat4_cast(AffineResults[i])[3] - MatrixResults[i][3]), glm::vec4(0.01f))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_affine(100000);
+	Error += launch_affine(1000000);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
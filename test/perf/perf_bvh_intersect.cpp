@@ -0,0 +1,126 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/constants.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/bvh.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include <cstdlib>
+#include "perf_clock.hpp"
+
+// Bumpy UV sphere of about TriangleCount triangles
+static std::vector<glm::vec3> make_sphere(std::size_t TriangleCount)
+{
+	std::size_t const Segments = static_cast<std::size_t>(glm::sqrt(static_cast<double>(TriangleCount))) + 1;
+	std::size_t const Rings = TriangleCount / (Segments * 2) + 1;
+
+	std::vector<glm::vec3> Vertices;
+	Vertices.reserve(Rings * Segments * 6);
+	for(std::size_t r = 0; r < Rings; ++r)
+	for(std::size_t s = 0; s < Segments; ++s)
+	{
+		glm::vec3 Corners[4];
+		for(std::size_t c = 0; c < 4; ++c)
+		{
+			float const Theta = glm::pi<float>() * static_cast<float>(r + c / 2) / static_cast<float>(Rings);
+			float const Phi = glm::two_pi<float>() * static_cast<float>(s + c % 2) / static_cast<float>(Segments);
+			float const Radius = 1.0f + 0.05f * glm::sin(Theta * 17.f) * glm::cos(Phi * 13.f);
+			Corners[c] = Radius * glm::vec3(glm::sin(Theta) * glm::cos(Phi), glm::cos(Theta), glm::sin(Theta) * glm::sin(Phi));
+		}
+		Vertices.push_back(Corners[0]); Vertices.push_back(Corners[1]); Vertices.push_back(Corners[2]);
+		Vertices.push_back(Corners[1]); Vertices.push_back(Corners[3]); Vertices.push_back(Corners[2]);
+	}
+	return Vertices;
+}
+
+static int launch_bvh(std::size_t TriangleCount, std::size_t RayCount, std::size_t BruteForceRayCount)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> const Vertices = make_sphere(TriangleCount);
+	std::size_t const Triangles = Vertices.size() / 3;
+
+	std::vector<glm::vec3> Origins(RayCount);
+	std::vector<glm::vec3> Directions(RayCount);
+	for(std::size_t i = 0; i < RayCount; ++i)
+	{
+		Origins[i] = glm::sphericalRand(3.0f);
+		Directions[i] = glm::normalize(glm::ballRand(0.5f) - Origins[i]);
+	}
+
+	glm::bvh<float> Tree;
+	perf_clock::time_point const t0 = perf_clock::now();
+	glm::buildBVH(Tree, &Vertices[0], Triangles);
+	perf_clock::time_point const t1 = perf_clock::now();
+
+	std::vector<float> Distances(RayCount);
+	std::size_t Hits = 0;
+	for(std::size_t i = 0; i < RayCount; ++i)
+	{
+		glm::vec2 Bary;
+		std::size_t Index = 0;
+		Distances[i] = -1.f;
+		Hits += glm::intersectRayBVH(Tree, Origins[i], Directions[i], Bary, Distances[i], Index) ? 1 : 0;
+	}
+	perf_clock::time_point const t2 = perf_clock::now();
+
+	std::size_t Occluded = 0;
+	for(std::size_t i = 0; i < RayCount; ++i)
+		Occluded += glm::intersectRayBVHAny(Tree, Origins[i], Directions[i], std::numeric_limits<float>::max()) ? 1 : 0;
+	perf_clock::time_point const t3 = perf_clock::now();
+
+	Error += Hits == Occluded ? 0 : 1;
+
+	for(std::size_t i = 0; i < BruteForceRayCount; ++i)
+	{
+		float Closest = -1.f;
+		for(std::size_t t = 0; t < Triangles; ++t)
+		{
+			glm::vec2 Bary;
+			float Distance = 0.f;
+			if(glm::intersectRayTriangle(Origins[i], Directions[i], Vertices[t * 3 + 0], Vertices[t * 3 + 1], Vertices[t * 3 + 2], Bary, Distance) &&
+				Distance >= 0.f && (Closest < 0.f || Distance < Closest))
+				Closest = Distance;
+		}
+		Error += Closest == Distances[i] ? 0 : 1;
+	}
+	perf_clock::time_point const t4 = perf_clock::now();
+
+	printf("%d triangles, %d nodes:\n", static_cast<int>(Triangles), static_cast<int>(Tree.nodes.size()));
+	printf("- Build: %.1f ms\n", seconds(t0, t1) * 1000.0);
+	printf("- Closest hit: %.3f Mrays/s\n", static_cast<double>(RayCount) / seconds(t1, t2) * 1e-6);
+	printf("- Any hit: %.3f Mrays/s\n", static_cast<double>(RayCount) / seconds(t2, t3) * 1e-6);
+	printf("- Brute force: %.6f Mrays/s\n", static_cast<double>(BruteForceRayCount) / seconds(t3, t4) * 1e-6);
+
+	return Error;
+}
+
+// Usage: test-perf_bvh_intersect [triangle count], the default size keeps the test short, up to 10M triangles are supported
+int main(int argc, char* argv[])
+{
+	int Error = 0;
+
+	if(argc > 1)
+	{
+		std::size_t const TriangleCount = static_cast<std::size_t>(std::atol(argv[1]));
+		Error += launch_bvh(TriangleCount, 1000000, 16);
+	}
+	else
+	{
+		Error += launch_bvh(1000, 100000, 1000);
+		Error += launch_bvh(100000, 100000, 64);
+	}
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
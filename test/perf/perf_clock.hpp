@@ -0,0 +1,23 @@
+/// Timing helpers shared by the performance tests, to include from a GLM_HAS_CXX11_STL block
+
+#pragma once
+
+#include <cstddef>
+#include <chrono>
+
+typedef std::chrono::high_resolution_clock perf_clock;
+
+static inline double nanoseconds_per_element(perf_clock::time_point t0, perf_clock::time_point t1, std::size_t Elements)
+{
+	return static_cast<double>(std::chrono::duration_cast<std::chrono::nanoseconds>(t1 - t0).count()) / static_cast<double>(Elements);
+}
+
+static inline int microseconds(perf_clock::time_point t0, perf_clock::time_point t1)
+{
+	return static_cast<int>(std::chrono::duration_cast<std::chrono::microseconds>(t1 - t0).count());
+}
+
+static inline double seconds(perf_clock::time_point t0, perf_clock::time_point t1)
+{
+	return std::chrono::duration_cast<std::chrono::duration<double> >(t1 - t0).count();
+}
@@ -0,0 +1,69 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/scalar_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/easing.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// The tweens of a frame, eased by the scalar function one at a time and by easingBatch
+template<typename scalar_function>
+static int launch_easing(char const* Name, scalar_function Function, glm::easing_function Batch, std::vector<float> const& a, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::size_t const Tweens = a.size();
+	std::vector<float> Loop(Tweens), Batched(Tweens);
+
+	std::size_t const Elements = Tweens * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Tweens; ++i)
+		Loop[i] = Function(a[i]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::easingBatch(Batch, &a[0], Tweens, &Batched[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Tweens; ++i)
+		Error += glm::equal(Loop[i], Batched[i], 0.0001f) ? 0 : 1;
+
+	printf("- %s: %.2f, easingBatch: %.2f\n", Name, nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	std::size_t const Tweens = 1 << 14;
+	std::size_t const Iterations = 256;
+
+	std::vector<float> a(Tweens);
+	for(std::size_t i = 0; i < Tweens; ++i)
+		a[i] = glm::linearRand(0.0f, 1.0f);
+
+	printf("%d tweens x %d, ns per tween:\n", static_cast<int>(Tweens), static_cast<int>(Iterations));
+	Error += launch_easing("cubicEaseInOut", glm::cubicEaseInOut<float>, glm::easing_cubic_in_out, a, Iterations);
+	Error += launch_easing("sineEaseInOut", glm::sineEaseInOut<float>, glm::easing_sine_in_out, a, Iterations);
+	Error += launch_easing("exponentialEaseInOut", glm::exponentialEaseInOut<float>, glm::easing_exponential_in_out, a, Iterations);
+	Error += launch_easing("elasticEaseInOut", glm::elasticEaseInOut<float>, glm::easing_elastic_in_out, a, Iterations);
+	Error += launch_easing("backEaseInOut", static_cast<float(*)(float const&)>(glm::backEaseInOut<float>), glm::easing_back_in_out, a, Iterations);
+	Error += launch_easing("bounceEaseInOut", glm::bounceEaseInOut<float>, glm::easing_bounce_in_out, a, Iterations);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
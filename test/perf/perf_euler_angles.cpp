@@ -0,0 +1,94 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/euler_angles_batch.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Motion capture frames of a skeleton, one XYZ angle triple per joint
+static int launch_euler(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<float> T1(Samples), T2(Samples), T3(Samples), A1(Samples), A2(Samples), A3(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		T1[i] = glm::linearRand(-3.0f, 3.0f);
+		T2[i] = glm::linearRand(-1.5f, 1.5f);
+		T3[i] = glm::linearRand(-3.0f, 3.0f);
+	}
+
+	std::vector<glm::mat4> Loop4(Samples), Batch4(Samples);
+	std::vector<glm::quat> LoopQuats(Samples), BatchQuats(Samples);
+	std::vector<glm::vec3> LoopAngles(Samples);
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop4[i] = glm::eulerAngleXYZ(T1[i], T2[i], T3[i]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::eulerAngleBatch(glm::euler_xyz, &T1[0], &T2[0], &T3[0], Samples, &Batch4[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		LoopQuats[i] = glm::quat_cast(glm::eulerAngleXYZ(T1[i], T2[i], T3[i]));
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::eulerAngleBatch(glm::euler_xyz, &T1[0], &T2[0], &T3[0], Samples, &BatchQuats[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		glm::extractEulerAngleXYZ(Loop4[i], LoopAngles[i].x, LoopAngles[i].y, LoopAngles[i].z);
+	perf_clock::time_point const t5 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::extractEulerAngleBatch(glm::euler_xyz, &Loop4[0], Samples, &A1[0], &A2[0], &A3[0]);
+	perf_clock::time_point const t6 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		glm::extractEulerAngleXYZ(glm::mat4_cast(LoopQuats[i]), LoopAngles[i].x, LoopAngles[i].y, LoopAngles[i].z);
+	perf_clock::time_point const t7 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::extractEulerAngleBatch(glm::euler_xyz, &BatchQuats[0], Samples, &A1[0], &A2[0], &A3[0]);
+	perf_clock::time_point const t8 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(Loop4[i], Batch4[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopQuats[i], BatchQuats[i], 0.0001f)) || glm::all(glm::equal(LoopQuats[i], -BatchQuats[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopAngles[i], glm::vec3(A1[i], A2[i], A3[i]), 0.0001f)) ? 0 : 1;
+	}
+
+	printf("%d angle triples x %d, ns per conversion:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- eulerAngleXYZ: %.2f, batch: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+	printf("- quat_cast(eulerAngleXYZ): %.2f, batch: %.2f\n", nanoseconds_per_element(t2, t3, Elements), nanoseconds_per_element(t3, t4, Elements));
+	printf("- extractEulerAngleXYZ: %.2f, batch: %.2f\n", nanoseconds_per_element(t4, t5, Elements), nanoseconds_per_element(t5, t6, Elements));
+	printf("- extractEulerAngleXYZ(mat4_cast): %.2f, batch: %.2f\n", nanoseconds_per_element(t6, t7, Elements), nanoseconds_per_element(t7, t8, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_euler(1024, 1024);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,88 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/frustum.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Typical hand written culling loop: array of spheres, early out on the first separating plane
+static void cull_spheres_loop(glm::vec4 const Planes[6], std::vector<glm::vec4> const& Spheres, std::vector<glm::uint32>& Visibility)
+{
+	for(std::size_t i = 0, n = Spheres.size(); i < n; ++i)
+	{
+		bool Visible = true;
+		for(int p = 0; p < 6 && Visible; ++p)
+			Visible = glm::dot(glm::vec3(Planes[p]), glm::vec3(Spheres[i])) + Planes[p].w >= -Spheres[i].w;
+		if(Visible)
+			Visibility[i / 32] |= 1u << (i % 32);
+		else
+			Visibility[i / 32] &= ~(1u << (i % 32));
+	}
+}
+
+static int launch_cull(std::size_t Samples)
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspective(glm::radians(60.f), 1.5f, 0.5f, 100.f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 0, 20), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	glm::vec4 Planes[6];
+	glm::frustumPlanes(Projection * View, Planes);
+
+	std::vector<glm::vec4> Spheres(Samples);
+	std::vector<float> X(Samples), Y(Samples), Z(Samples), R(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Spheres[i] = glm::vec4(glm::linearRand(glm::vec3(-100), glm::vec3(100)), glm::linearRand(0.f, 5.f));
+		X[i] = Spheres[i].x;
+		Y[i] = Spheres[i].y;
+		Z[i] = Spheres[i].z;
+		R[i] = Spheres[i].w;
+	}
+
+	std::vector<glm::uint32> Loop((Samples + 31) / 32, 0);
+	std::vector<glm::uint32> Batch((Samples + 31) / 32, 0);
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	cull_spheres_loop(Planes, Spheres, Loop);
+	perf_clock::time_point const t1 = perf_clock::now();
+	glm::frustumCullSpheres(Planes, &X[0], &Y[0], &Z[0], &R[0], Samples, &Batch[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	glm::frustumCullBoxes(Planes, &X[0], &Y[0], &Z[0], &R[0], &R[0], &R[0], Samples, &Batch[0]);
+	perf_clock::time_point const t3 = perf_clock::now();
+
+	printf("%d objects:\n", static_cast<int>(Samples));
+	printf("- Sphere loop: %d us\n", microseconds(t0, t1));
+	printf("- frustumCullSpheres: %d us\n", microseconds(t1, t2));
+	printf("- frustumCullBoxes: %d us\n", microseconds(t2, t3));
+
+	glm::frustumCullSpheres(Planes, &X[0], &Y[0], &Z[0], &R[0], Samples, &Batch[0]);
+	for(std::size_t i = 0; i < Batch.size(); ++i)
+		Error += Loop[i] == Batch[i] ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_cull(100000);
+	Error += launch_cull(1000000);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
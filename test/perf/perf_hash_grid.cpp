@@ -0,0 +1,95 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/random.hpp>
+#if GLM_HAS_CXX11_STL
+#include <glm/gtx/hash_grid.hpp>
+#include <unordered_map>
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Typical neighbor search: std::unordered_map from cell to the indices of its points
+static std::size_t search_unordered_map(std::vector<glm::vec3> const& Points, float Radius)
+{
+	std::unordered_map<glm::ivec3, std::vector<glm::uint32> > Cells;
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Cells[glm::ivec3(glm::floor(Points[i] / Radius))].push_back(static_cast<glm::uint32>(i));
+
+	std::size_t Found = 0;
+	for(std::size_t i = 0; i < Points.size(); ++i)
+	{
+		glm::ivec3 const Cell(glm::floor(Points[i] / Radius));
+		for(int z = -1; z <= 1; ++z)
+		for(int y = -1; y <= 1; ++y)
+		for(int x = -1; x <= 1; ++x)
+		{
+			std::unordered_map<glm::ivec3, std::vector<glm::uint32> >::const_iterator It = Cells.find(Cell + glm::ivec3(x, y, z));
+			if(It == Cells.end())
+				continue;
+			for(std::size_t j = 0; j < It->second.size(); ++j)
+			{
+				glm::vec3 const d(Points[It->second[j]] - Points[i]);
+				Found += glm::dot(d, d) <= Radius * Radius ? 1 : 0;
+			}
+		}
+	}
+	return Found;
+}
+
+static std::size_t search_hash_grid(std::vector<glm::vec3> const& Points, float Radius)
+{
+	glm::hash_grid<float> Grid;
+	glm::buildHashGrid(Grid, &Points[0], Points.size(), Radius);
+
+	std::size_t Found = 0;
+	std::vector<glm::uint32> Neighbors;
+	for(std::size_t i = 0; i < Grid.points.size(); ++i)
+	{
+		Neighbors.clear();
+		Found += glm::findNeighbors(Grid, Grid.points[i], Radius, Neighbors);
+	}
+	return Found;
+}
+
+static int launch_search(std::size_t Samples)
+{
+	// About 30 neighbors per particle
+	float const Extent = 100.f;
+	float const Radius = Extent * glm::pow(30.f / static_cast<float>(Samples) / 4.19f, 1.f / 3.f);
+
+	std::vector<glm::vec3> Points(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Points[i] = glm::linearRand(glm::vec3(0), glm::vec3(Extent));
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	std::size_t const FoundMap = search_unordered_map(Points, Radius);
+	perf_clock::time_point const t1 = perf_clock::now();
+	std::size_t const FoundGrid = search_hash_grid(Points, Radius);
+	perf_clock::time_point const t2 = perf_clock::now();
+
+	printf("%d particles, %d neighbors:\n", static_cast<int>(Samples), static_cast<int>(FoundGrid));
+	printf("- std::unordered_map<ivec3, std::vector>: %d us\n", microseconds(t0, t1));
+	printf("- hash_grid: %d us\n", microseconds(t1, t2));
+
+	return FoundMap == FoundGrid ? 0 : 1;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_search(10000);
+	Error += launch_search(200000);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,122 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/quaternion_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/keyframe.hpp>
+#if GLM_HAS_CXX11_STL
+#include <algorithm>
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Keys of a track as an animation exporter writes them, an array of times and an array of values
+template<typename genType>
+struct naive_track
+{
+	std::vector<float> Times;
+	std::vector<genType> Values;
+};
+
+template<typename genType>
+static std::size_t naive_segment(naive_track<genType> const& Track, float Time, float& s)
+{
+	std::size_t const Upper = static_cast<std::size_t>(std::upper_bound(Track.Times.begin(), Track.Times.end(), Time) - Track.Times.begin());
+	std::size_t const k = Upper > 0 ? Upper - 1 : 0;
+	s = k + 1 < Track.Times.size() ? glm::clamp((Time - Track.Times[k]) / (Track.Times[k + 1] - Track.Times[k]), 0.0f, 1.0f) : 0.0f;
+	return k;
+}
+
+// Translation and rotation tracks of the joints of skeletons, sampled at the frames of a looping 30 Hz playback
+static int launch_keyframe(std::size_t Tracks, std::size_t Keys, std::size_t Frames)
+{
+	int Error = 0;
+
+	std::vector<naive_track<glm::vec3> > NaiveTranslations(Tracks);
+	std::vector<naive_track<glm::quat> > NaiveRotations(Tracks);
+	std::vector<glm::keyframe_track<3, float> > Translations(Tracks);
+	std::vector<glm::keyframe_quat_track<float> > Rotations(Tracks);
+	for(std::size_t i = 0; i < Tracks; ++i)
+	{
+		naive_track<glm::vec3>& Translation = NaiveTranslations[i];
+		naive_track<glm::quat>& Rotation = NaiveRotations[i];
+		float Time = 0.0f;
+		for(std::size_t k = 0; k < Keys; ++k)
+		{
+			Translation.Times.push_back(Time);
+			Translation.Values.push_back(glm::ballRand(1.0f));
+			Rotation.Values.push_back(glm::angleAxis(glm::linearRand(-1.0f, 1.0f), glm::sphericalRand(1.0f)));
+			if(k > 0 && glm::dot(Rotation.Values[k - 1], Rotation.Values[k]) < 0.0f)
+				Rotation.Values[k] = -Rotation.Values[k];
+			Time += glm::linearRand(0.05f, 0.2f);
+		}
+		Rotation.Times = Translation.Times;
+		glm::buildKeyframeTrack(Translations[i], glm::keyframe_linear, &Translation.Times[0], &Translation.Values[0], static_cast<glm::vec3 const*>(NULL), Keys);
+		glm::buildKeyframeTrack(Rotations[i], glm::keyframe_linear, &Rotation.Times[0], &Rotation.Values[0], Keys);
+	}
+
+	std::vector<glm::vec3> LoopTranslations(Tracks), BatchTranslations(Tracks);
+	std::vector<glm::quat> LoopRotations(Tracks), BatchRotations(Tracks);
+	std::vector<std::size_t> TranslationSegments(Tracks, 0), RotationSegments(Tracks, 0);
+
+	std::size_t const Elements = Tracks * Frames;
+	float const FrameTime = 1.0f / 30.0f;
+	std::size_t const LoopFrames = static_cast<std::size_t>(static_cast<float>(Keys - 1) * 0.05f / FrameTime);
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t f = 0; f < Frames; ++f)
+	for(std::size_t i = 0; i < Tracks; ++i)
+	{
+		float s = 0.0f;
+		naive_track<glm::vec3> const& Track = NaiveTranslations[i];
+		std::size_t const k = naive_segment(Track, static_cast<float>(f % LoopFrames) * FrameTime, s);
+		LoopTranslations[i] = glm::mix(Track.Values[k], Track.Values[std::min(k + 1, Keys - 1)], s);
+	}
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t f = 0; f < Frames; ++f)
+		glm::sampleTracks(&Translations[0], Tracks, static_cast<float>(f % LoopFrames) * FrameTime, &TranslationSegments[0], &BatchTranslations[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t f = 0; f < Frames; ++f)
+	for(std::size_t i = 0; i < Tracks; ++i)
+	{
+		float s = 0.0f;
+		naive_track<glm::quat> const& Track = NaiveRotations[i];
+		std::size_t const k = naive_segment(Track, static_cast<float>(f % LoopFrames) * FrameTime, s);
+		LoopRotations[i] = glm::slerp(Track.Values[k], Track.Values[std::min(k + 1, Keys - 1)], s);
+	}
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t f = 0; f < Frames; ++f)
+		glm::sampleTracks(&Rotations[0], Tracks, static_cast<float>(f % LoopFrames) * FrameTime, &RotationSegments[0], &BatchRotations[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Tracks; ++i)
+	{
+		Error += glm::all(glm::equal(LoopTranslations[i], BatchTranslations[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopRotations[i], BatchRotations[i], 0.0001f)) ? 0 : 1;
+	}
+
+	printf("%d tracks of %d keys x %d frames, ns per sample:\n", static_cast<int>(Tracks), static_cast<int>(Keys), static_cast<int>(Frames));
+	printf("- upper_bound + mix: %.2f, sampleTracks: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+	printf("- upper_bound + slerp: %.2f, sampleTracks: %.2f\n", nanoseconds_per_element(t2, t3, Elements), nanoseconds_per_element(t3, t4, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_keyframe(256, 64, 3000);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
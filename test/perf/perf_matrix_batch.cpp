@@ -0,0 +1,88 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_batch.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+static int launch_batch(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	glm::mat4 const M = glm::mat4(glm::linearRand(glm::vec4(-1), glm::vec4(1)), glm::linearRand(glm::vec4(-1), glm::vec4(1)), glm::linearRand(glm::vec4(-1), glm::vec4(1)), glm::linearRand(glm::vec4(-1), glm::vec4(1)));
+	std::vector<glm::mat4> A(Samples), B(Samples), Loop(Samples), Batch(Samples);
+	std::vector<glm::vec4> V(Samples), LoopV(Samples), BatchV(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		A[i] = glm::mat4(glm::linearRand(glm::vec4(-1), glm::vec4(1)), glm::linearRand(glm::vec4(-1), glm::vec4(1)), glm::linearRand(glm::vec4(-1), glm::vec4(1)), glm::vec4(0, 0, 0, 1));
+		B[i] = A[(i * 7) % Samples];
+		V[i] = glm::linearRand(glm::vec4(-1), glm::vec4(1));
+	}
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = M * A[i];
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::mulBatch(M, &A[0], Samples, &Batch[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.0001f)) ? 0 : 1;
+
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = A[i] * B[i];
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::mulBatch(&A[0], &B[0], Samples, &Batch[0]);
+	perf_clock::time_point const t5 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.0001f)) ? 0 : 1;
+
+	perf_clock::time_point const t6 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		LoopV[i] = M * V[i];
+	perf_clock::time_point const t7 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::mulBatch(M, &V[0], Samples, &BatchV[0]);
+	perf_clock::time_point const t8 = perf_clock::now();
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(LoopV[i], BatchV[i], 0.0001f)) ? 0 : 1;
+
+	printf("%d elements x %d, ns per element:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- mat4 * mat4[i] loop: %.2f, mulBatch: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+	printf("- mat4[i] * mat4[i] loop: %.2f, mulBatch: %.2f\n", nanoseconds_per_element(t3, t4, Elements), nanoseconds_per_element(t4, t5, Elements));
+	printf("- mat4 * vec4[i] loop: %.2f, mulBatch: %.2f\n", nanoseconds_per_element(t6, t7, Elements), nanoseconds_per_element(t7, t8, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	// Cache resident, then 64 MB outputs written with non-temporal stores
+	Error += launch_batch(1024, 2048);
+	Error += launch_batch(1 << 20, 4);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,76 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_decompose.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+static int launch_decompose(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> Matrices(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::quat const r = glm::angleAxis(glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f));
+		Matrices[i] = glm::translate(glm::mat4(1), glm::linearRand(glm::vec3(-10), glm::vec3(10))) * glm::mat4_cast(r) * glm::scale(glm::mat4(1), glm::linearRand(glm::vec3(0.5f), glm::vec3(2)));
+	}
+
+	std::vector<glm::vec3> Scale(Samples), Translation(Samples);
+	std::vector<glm::quat> Orientation(Samples);
+	std::vector<float> Tx(Samples), Ty(Samples), Tz(Samples), Rx(Samples), Ry(Samples), Rz(Samples), Rw(Samples), Sx(Samples), Sy(Samples), Sz(Samples);
+	glm::vec3 Skew;
+	glm::vec4 Perspective;
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::decompose(Matrices[i], Scale[i], Orientation[i], Translation[i], Skew, Perspective) ? 0 : 1;
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::decomposeAffine(Matrices[i], Scale[i], Orientation[i], Translation[i]) ? 0 : 1;
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		Error += glm::decomposeAffine(&Matrices[0], Samples, &Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0]) == Samples ? 0 : 1;
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::decomposePolar(Matrices[i], Scale[i], Orientation[i], Translation[i]) ? 0 : 1;
+	perf_clock::time_point const t4 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::abs(glm::abs(glm::dot(Orientation[i], glm::quat(Rw[i], Rx[i], Ry[i], Rz[i]))) - 1.0f) < 0.001f ? 0 : 1;
+
+	printf("%d matrices x %d, ns per matrix:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- decompose: %.2f\n", nanoseconds_per_element(t0, t1, Elements));
+	printf("- decomposeAffine: %.2f\n", nanoseconds_per_element(t1, t2, Elements));
+	printf("- decomposeAffine batch: %.2f\n", nanoseconds_per_element(t2, t3, Elements));
+	printf("- decomposePolar: %.2f\n", nanoseconds_per_element(t3, t4, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_decompose(1024, 512);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,74 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/covariance.hpp>
+#include <glm/gtx/matrix_factorisation.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Normal estimation: the covariance of each neighborhood of points, then its eigendecomposition
+static int launch_eigen(std::size_t Samples, std::size_t Neighbors, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Points(Samples * Neighbors);
+	for(std::size_t i = 0; i < Points.size(); ++i)
+		Points[i] = glm::vec3(glm::diskRand(1.0f), glm::linearRand(-0.01f, 0.01f)) + glm::vec3(static_cast<float>(i / Neighbors) * 3.0f, 100.0f, -50.0f);
+
+	std::vector<glm::mat3> Covariances(Samples), Vectors(Samples), BatchVectors(Samples);
+	std::vector<glm::vec3> Values(Samples), BatchValues(Samples);
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::covariance_accumulator<float> Accumulator;
+		glm::accumulateCovariance(Accumulator, &Points[i * Neighbors], Neighbors);
+		Covariances[i] = glm::covarianceMatrix(Accumulator);
+	}
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		glm::eigen_decompose_symmetric(Covariances[i], Values[i], Vectors[i]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::eigen_decompose_symmetric(&Covariances[0], Samples, &BatchValues[0], &BatchVectors[0]);
+	perf_clock::time_point const t3 = perf_clock::now();
+
+	// The neighborhoods lie on planes of normal z
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::abs(Vectors[i][2].z) > 0.99f ? 0 : 1;
+		Error += glm::abs(BatchVectors[i][2].z) > 0.99f ? 0 : 1;
+	}
+
+	printf("%d neighborhoods of %d points x %d, ns per neighborhood:\n", static_cast<int>(Samples), static_cast<int>(Neighbors), static_cast<int>(Iterations));
+	printf("- accumulateCovariance: %.2f\n", nanoseconds_per_element(t0, t1, Elements));
+	printf("- eigen_decompose_symmetric: %.2f, batch: %.2f\n", nanoseconds_per_element(t1, t2, Elements), nanoseconds_per_element(t2, t3, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_eigen(1024, 16, 256);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,83 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_interpolation.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// The motion blur of objects: the matrices of the start and the end of a frame interpolated at the times of the samples
+static int launch_matrix_interpolation(std::size_t Objects, std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> Start(Objects), End(Objects);
+	std::vector<glm::matrix_interpolator<float> > Interpolators(Objects);
+	for(std::size_t i = 0; i < Objects; ++i)
+	{
+		glm::vec3 const Axis = glm::sphericalRand(1.0f);
+		glm::mat4 const Rotation = glm::rotate(glm::mat4(1.0f), glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f));
+		Start[i] = glm::translate(glm::mat4(1.0f), glm::ballRand(10.0f)) * Rotation;
+		End[i] = glm::translate(glm::mat4(1.0f), glm::ballRand(10.0f)) * glm::rotate(glm::mat4(1.0f), glm::linearRand(-0.5f, 0.5f), Axis) * Rotation;
+	}
+
+	std::vector<float> Deltas(Samples);
+	for(std::size_t s = 0; s < Samples; ++s)
+		Deltas[s] = (static_cast<float>(s) + 0.5f) / static_cast<float>(Samples);
+
+	std::vector<glm::mat4> Loop(Samples), Scalar(Samples), Batch(Samples);
+
+	std::size_t const Elements = Objects * Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Objects; ++i)
+	for(std::size_t s = 0; s < Samples; ++s)
+		Loop[s] = glm::interpolate(Start[i], End[i], Deltas[s]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Objects; ++i)
+	{
+		glm::buildMatrixInterpolator(Interpolators[i], Start[i], End[i]);
+		for(std::size_t s = 0; s < Samples; ++s)
+			Scalar[s] = glm::interpolate(Interpolators[i], Deltas[s]);
+	}
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Objects; ++i)
+	{
+		glm::buildMatrixInterpolator(Interpolators[i], Start[i], End[i]);
+		glm::interpolate(Interpolators[i], &Deltas[0], Samples, &Batch[0]);
+	}
+	perf_clock::time_point const t3 = perf_clock::now();
+
+	for(std::size_t s = 0; s < Samples; ++s)
+		Error += glm::all(glm::equal(Scalar[s], Batch[s], 0.0001f)) ? 0 : 1;
+
+	printf("%d objects x %d samples x %d, ns per matrix:\n", static_cast<int>(Objects), static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- interpolate: %.2f, matrix_interpolator: %.2f, batch: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements), nanoseconds_per_element(t2, t3, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_matrix_interpolation(1024, 16, 64);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
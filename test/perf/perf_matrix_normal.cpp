@@ -0,0 +1,99 @@
+#define GLM_FORCE_INLINE
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/matrix_inverse.hpp>
+#include <glm/gtc/random.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+template<typename T>
+static int launch_normal(std::size_t Samples, std::size_t Iterations)
+{
+	typedef glm::vec<3, T, glm::defaultp> vec3;
+	typedef glm::mat<3, 3, T, glm::defaultp> mat3;
+	typedef glm::mat<4, 4, T, glm::defaultp> mat4;
+	int Error = 0;
+
+	std::vector<mat4> Models(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		mat4 m = glm::translate(mat4(1), vec3(glm::linearRand(glm::vec3(-10), glm::vec3(10))));
+		m = glm::rotate(m, static_cast<T>(glm::linearRand(-3.f, 3.f)), vec3(glm::sphericalRand(1.f)));
+		Models[i] = glm::scale(m, vec3(glm::linearRand(glm::vec3(0.5f), glm::vec3(2.0f))));
+	}
+
+	std::vector<mat3> Linear(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Linear[i] = mat3(Models[i]);
+
+	std::vector<mat3> Reference(Samples);
+	std::vector<mat3> InverseTranspose(Samples);
+	std::vector<mat3> Normal(Samples);
+	std::vector<mat4> Affine(Samples);
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Reference[i] = glm::transpose(glm::inverse(Linear[i]));
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		InverseTranspose[i] = glm::inverseTranspose(Linear[i]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Normal[i] = glm::normalMatrix(Linear[i]);
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Normal[i] = glm::normalMatrix(Models[i]);
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Affine[i] = glm::affineInverse(Models[i]);
+	perf_clock::time_point const t5 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Affine[i] = glm::inverse(Models[i]);
+	perf_clock::time_point const t6 = perf_clock::now();
+
+	printf("%d x %d %s matrices:\n", static_cast<int>(Iterations), static_cast<int>(Samples), sizeof(T) == 4 ? "float" : "double");
+	printf("- transpose(inverse(mat3)): %d us\n", microseconds(t0, t1));
+	printf("- inverseTranspose(mat3): %d us\n", microseconds(t1, t2));
+	printf("- normalMatrix(mat3): %d us\n", microseconds(t2, t3));
+	printf("- normalMatrix(mat4): %d us\n", microseconds(t3, t4));
+	printf("- affineInverse(mat4): %d us\n", microseconds(t4, t5));
+	printf("- inverse(mat4): %d us\n", microseconds(t5, t6));
+
+	T const Epsilon = static_cast<T>(0.001);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		vec3 const n(Reference[i] * vec3(1, 2, 3));
+		Error += glm::all(glm::lessThan(glm::abs(InverseTranspose[i] * vec3(1, 2, 3) - n), vec3(Epsilon))) ? 0 : 1;
+		Error += glm::all(glm::lessThan(glm::abs(glm::normalize(Normal[i] * vec3(1, 2, 3)) - glm::normalize(n)), vec3(Epsilon))) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	// Working set in cache, the kernels are timed rather than the memory bandwidth
+	Error += launch_normal<float>(4096, 256);
+	Error += launch_normal<double>(4096, 256);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
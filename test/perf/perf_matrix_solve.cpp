@@ -0,0 +1,82 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_factorisation.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Diagonally dominant systems, the inverse and the solvers give close results
+template<glm::length_t N>
+static int launch_solve(std::size_t Samples, std::size_t Iterations)
+{
+	typedef glm::vec<N, float, glm::defaultp> vecN;
+	typedef glm::mat<N, N, float, glm::defaultp> matN;
+
+	int Error = 0;
+
+	std::vector<matN> Matrices(Samples), L(Samples);
+	std::vector<vecN> B(Samples), X(Samples, vecN(0)), Y(Samples, vecN(0)), Z(Samples, vecN(0));
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		matN m;
+		for(glm::length_t c = 0; c < N; ++c)
+			m[c] = glm::linearRand(vecN(-1), vecN(1));
+		Matrices[i] = m * glm::transpose(m) + matN(static_cast<float>(N));
+		B[i] = glm::linearRand(vecN(-1), vecN(1));
+	}
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		X[i] = glm::inverse(Matrices[i]) * B[i];
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Y[i] = glm::solve(Matrices[i], B[i]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::solve(&Matrices[0], &B[0], Samples, &Z[0]);
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::cholesky(&Matrices[0], Samples, &L[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(X[i], Y[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(X[i], Z[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(X[i], glm::cholesky_solve(L[i], B[i]), 0.001f)) ? 0 : 1;
+	}
+
+	printf("%d mat%d systems x %d, ns per system:\n", static_cast<int>(Samples), static_cast<int>(N), static_cast<int>(Iterations));
+	printf("- inverse * b: %.2f\n", nanoseconds_per_element(t0, t1, Elements));
+	printf("- solve: %.2f, batch: %.2f\n", nanoseconds_per_element(t1, t2, Elements), nanoseconds_per_element(t2, t3, Elements));
+	printf("- cholesky batch: %.2f\n", nanoseconds_per_element(t3, t4, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_solve<3>(1024, 256);
+	Error += launch_solve<4>(1024, 256);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
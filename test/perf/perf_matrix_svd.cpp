@@ -0,0 +1,73 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_factorisation.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+static int launch_svd(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::mat3> Matrices(Samples), U(Samples), V(Samples), BatchU(Samples), BatchV(Samples), Q(Samples), R(Samples);
+	std::vector<glm::vec3> S(Samples), BatchS(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Matrices[i] = glm::mat3(glm::linearRand(glm::vec3(-1), glm::vec3(1)), glm::linearRand(glm::vec3(-1), glm::vec3(1)), glm::linearRand(glm::vec3(-1), glm::vec3(1)));
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		glm::qr_decompose(Matrices[i], Q[i], R[i]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		glm::svd_decompose(Matrices[i], U[i], S[i], V[i]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::svd_decompose(&Matrices[0], Samples, &BatchU[0], &BatchS[0], &BatchV[0]);
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		glm::polar_decompose(Matrices[i], U[i], V[i]);
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::polar_decompose(&Matrices[0], Samples, &BatchU[0], &BatchV[0]);
+	perf_clock::time_point const t5 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(Q[i] * R[i], Matrices[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(BatchU[i] * BatchV[i], Matrices[i], 0.001f)) ? 0 : 1;
+	}
+
+	printf("%d matrices x %d, ns per matrix:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- qr_decompose: %.2f\n", nanoseconds_per_element(t0, t1, Elements));
+	printf("- svd_decompose: %.2f, batch: %.2f\n", nanoseconds_per_element(t1, t2, Elements), nanoseconds_per_element(t2, t3, Elements));
+	printf("- polar_decompose: %.2f, batch: %.2f\n", nanoseconds_per_element(t3, t4, Elements), nanoseconds_per_element(t4, t5, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_svd(1024, 256);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
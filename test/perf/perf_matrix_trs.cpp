@@ -0,0 +1,88 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/matrix_trs.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+static int launch_trs(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> Translations(Samples), Axes(Samples), Scales(Samples);
+	std::vector<float> Angles(Samples);
+	std::vector<glm::quat> Rotations(Samples);
+	std::vector<float> Tx(Samples), Ty(Samples), Tz(Samples), Rx(Samples), Ry(Samples), Rz(Samples), Rw(Samples), Sx(Samples), Sy(Samples), Sz(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Translations[i] = glm::linearRand(glm::vec3(-100), glm::vec3(100));
+		Axes[i] = glm::sphericalRand(1.0f);
+		Angles[i] = glm::linearRand(-3.f, 3.f);
+		Rotations[i] = glm::angleAxis(Angles[i], Axes[i]);
+		Scales[i] = glm::linearRand(glm::vec3(0.5f), glm::vec3(2.0f));
+
+		Tx[i] = Translations[i].x; Ty[i] = Translations[i].y; Tz[i] = Translations[i].z;
+		Rx[i] = Rotations[i].x; Ry[i] = Rotations[i].y; Rz[i] = Rotations[i].z; Rw[i] = Rotations[i].w;
+		Sx[i] = Scales[i].x; Sy[i] = Scales[i].y; Sz[i] = Scales[i].z;
+	}
+
+	std::vector<glm::mat4> Composed(Samples), Direct(Samples), Batch(Samples);
+	std::vector<glm::faffine> Affines(Samples);
+	glm::mat4 const Identity(1.0f);
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Composed[i] = glm::translate(Identity, Translations[i]) * glm::mat4_cast(Rotations[i]) * glm::scale(Identity, Scales[i]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Direct[i] = glm::trs(Translations[i], Rotations[i], Scales[i]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::trs(&Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0], Samples, &Batch[0]);
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::trs(&Tx[0], &Ty[0], &Tz[0], &Rx[0], &Ry[0], &Rz[0], &Rw[0], &Sx[0], &Sy[0], &Sz[0], Samples, &Affines[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+
+	printf("%d transformations x %d:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- translate * mat4_cast * scale: %d us\n", microseconds(t0, t1));
+	printf("- trs: %d us\n", microseconds(t1, t2));
+	printf("- trs batch mat4: %d us\n", microseconds(t2, t3));
+	printf("- trs batch affine: %d us\n", microseconds(t3, t4));
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(Composed[i], Direct[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Composed[i], Batch[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Composed[i], glm::mat4_cast(Affines[i]), 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_trs(1024, 1024);
+	Error += launch_trs(500000, 4);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
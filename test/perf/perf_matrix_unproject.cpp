@@ -0,0 +1,66 @@
+#define GLM_FORCE_INLINE
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_clip_space.hpp>
+#include <glm/ext/matrix_projection.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+static int launch_unProject(std::size_t Width, std::size_t Height)
+{
+	int Error = 0;
+
+	glm::mat4 const Projection = glm::perspective(glm::radians(60.f), static_cast<float>(Width) / static_cast<float>(Height), 0.5f, 100.f);
+	glm::mat4 const View = glm::lookAt(glm::vec3(0, 0, 20), glm::vec3(0, 0, 0), glm::vec3(0, 1, 0));
+	glm::vec4 const Viewport(0.f, 0.f, static_cast<float>(Width), static_cast<float>(Height));
+
+	std::vector<float> Depth(Width * Height);
+	for(std::size_t i = 0; i < Depth.size(); ++i)
+		Depth[i] = glm::linearRand(0.f, 1.f);
+
+	std::vector<glm::vec3> Loop(Width * Height);
+	std::vector<glm::vec3> Batch(Width * Height);
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Height; ++j)
+	for(std::size_t i = 0; i < Width; ++i)
+	{
+		glm::vec3 const Win(static_cast<float>(i) + 0.5f, static_cast<float>(j) + 0.5f, Depth[j * Width + i]);
+		Loop[j * Width + i] = glm::unProject(Win, View, Projection, Viewport);
+	}
+	perf_clock::time_point const t1 = perf_clock::now();
+	glm::projector<float> const Projector = glm::makeProjector(View, Projection, Viewport);
+	glm::unProjectDepth(Projector, &Depth[0], Width, Height, &Batch[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+
+	printf("%dx%d depth buffer:\n", static_cast<int>(Width), static_cast<int>(Height));
+	printf("- unProject per pixel: %d us\n", microseconds(t0, t1));
+	printf("- unProjectDepth: %d us\n", microseconds(t1, t2));
+
+	for(std::size_t i = 0; i < Loop.size(); ++i)
+		Error += glm::all(glm::lessThanEqual(glm::abs(Loop[i] - Batch[i]), glm::vec3(0.01f) * (1.f + glm::abs(Loop[i].z)))) ? 0 : 1;
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_unProject(640, 480);
+	Error += launch_unProject(1920, 1080);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,91 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Conversions of the joints of a pose, random rotations so that quat_cast picks each component unpredictably
+static int launch_cast(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> Quats(Samples), LoopQuats(Samples), BatchQuats(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		Quats[i] = glm::angleAxis(glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f));
+
+	std::vector<glm::mat3> Loop3(Samples), Batch3(Samples);
+	std::vector<glm::mat3x4> Loop34(Samples), Batch34(Samples);
+	std::vector<glm::mat4> Loop4(Samples), Batch4(Samples);
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop3[i] = glm::mat3_cast(Quats[i]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::mat3CastBatch(&Quats[0], Samples, &Batch3[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop34[i] = glm::mat3x4(glm::transpose(glm::mat4_cast(Quats[i])));
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::mat3x4CastBatch(&Quats[0], Samples, &Batch34[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop4[i] = glm::mat4_cast(Quats[i]);
+	perf_clock::time_point const t5 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::mat4CastBatch(&Quats[0], Samples, &Batch4[0]);
+	perf_clock::time_point const t6 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		LoopQuats[i] = glm::quat_cast(Loop4[i]);
+	perf_clock::time_point const t7 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::quatCastBatch(&Loop4[0], Samples, &BatchQuats[0]);
+	perf_clock::time_point const t8 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(Loop3[i], Batch3[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Loop34[i], Batch34[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Loop4[i], Batch4[i], 0.0001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopQuats[i], BatchQuats[i], 0.0001f)) ? 0 : 1;
+	}
+
+	printf("%d quaternions x %d, ns per conversion:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- mat3_cast: %.2f, batch: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+	printf("- mat3x4 from mat4_cast: %.2f, batch: %.2f\n", nanoseconds_per_element(t2, t3, Elements), nanoseconds_per_element(t3, t4, Elements));
+	printf("- mat4_cast: %.2f, batch: %.2f\n", nanoseconds_per_element(t4, t5, Elements), nanoseconds_per_element(t5, t6, Elements));
+	printf("- quat_cast(mat4): %.2f, batch: %.2f\n", nanoseconds_per_element(t6, t7, Elements), nanoseconds_per_element(t7, t8, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_cast(256, 4096);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,88 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/gtc/quaternion.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/quaternion_batch.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Blend of two poses of Samples joints, half of the pairs are in opposite hemispheres
+static int launch_blend(std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::quat> X(Samples), Y(Samples), Loop(Samples), Batch(Samples);
+	std::vector<float> A(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		X[i] = glm::angleAxis(glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f));
+		Y[i] = glm::angleAxis(glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f));
+		A[i] = glm::linearRand(0.0f, 1.0f);
+	}
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = glm::slerp(X[i], Y[i], A[i]);
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::slerpBatch(&X[0], &Y[0], &A[0], Samples, &Batch[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.0001f)) ? 0 : 1;
+
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = glm::normalize(X[i] * (1.0f - A[i]) + Y[i] * (glm::dot(X[i], Y[i]) < 0.0f ? -A[i] : A[i]));
+	perf_clock::time_point const t4 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::nlerpBatch(&X[0], &Y[0], &A[0], Samples, &Batch[0]);
+	perf_clock::time_point const t5 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.0001f)) ? 0 : 1;
+
+	perf_clock::time_point const t6 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+		Loop[i] = glm::fastSlerp(X[i], Y[i], A[i]);
+	perf_clock::time_point const t7 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::fastSlerpBatch(&X[0], &Y[0], &A[0], Samples, &Batch[0]);
+	perf_clock::time_point const t8 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.0001f)) ? 0 : 1;
+
+	printf("%d quaternions x %d, ns per quaternion:\n", static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- slerp: %.2f, batch: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+	printf("- nlerp: %.2f, batch: %.2f\n", nanoseconds_per_element(t3, t4, Elements), nanoseconds_per_element(t4, t5, Elements));
+	printf("- fastSlerp: %.2f, batch: %.2f\n", nanoseconds_per_element(t6, t7, Elements), nanoseconds_per_element(t7, t8, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_blend(1024, 1024);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,189 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/dual_quaternion.hpp>
+#include <glm/gtx/skinning.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <algorithm>
+#include <cstdio>
+#include <thread>
+#include "perf_clock.hpp"
+
+// A character of Bones bones and Samples vertices with four influences each
+static int launch_dual_quaternion(std::size_t Bones, std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::dualquat> Palette(Bones);
+	for(std::size_t i = 0; i < Bones; ++i)
+		Palette[i] = glm::dualquat(glm::angleAxis(glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f)), glm::linearRand(glm::vec3(-1), glm::vec3(1)));
+
+	std::vector<glm::u16vec4> Indices(Samples);
+	std::vector<glm::vec4> Weights(Samples);
+	std::vector<glm::vec3> Positions(Samples), Normals(Samples), LoopPositions(Samples), LoopNormals(Samples), BatchPositions(Samples), BatchNormals(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Indices[i] = glm::u16vec4(glm::linearRand(glm::ivec4(0), glm::ivec4(static_cast<int>(Bones) - 1)));
+		glm::vec4 const w = glm::linearRand(glm::vec4(0.0f), glm::vec4(1.0f));
+		Weights[i] = w / (w.x + w.y + w.z + w.w);
+		Positions[i] = glm::linearRand(glm::vec3(-1), glm::vec3(1));
+		Normals[i] = glm::sphericalRand(1.0f);
+	}
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::dualquat const& First = Palette[Indices[i].x];
+		glm::dualquat Blend = First * Weights[i].x;
+		for(glm::length_t k = 1; k < 4; ++k)
+		{
+			glm::dualquat const& Bone = Palette[Indices[i][k]];
+			Blend = Blend + Bone * (glm::dot(First.real, Bone.real) < 0.0f ? -Weights[i][k] : Weights[i][k]);
+		}
+		Blend = glm::normalize(Blend);
+		LoopPositions[i] = Blend * Positions[i];
+		LoopNormals[i] = Blend.real * Normals[i];
+	}
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::dualQuaternionSkinning(&Palette[0], &Indices[0], &Weights[0], &Positions[0], &Normals[0], Samples, &BatchPositions[0], &BatchNormals[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(LoopPositions[i], BatchPositions[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopNormals[i], BatchNormals[i], 0.001f)) ? 0 : 1;
+	}
+
+	printf("%d bones, %d vertices x %d, ns per vertex:\n", static_cast<int>(Bones), static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- dual quaternion skinning: %.2f, batch: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+
+	return Error;
+}
+
+struct vertex
+{
+	glm::vec3 Position;
+	glm::vec3 Normal;
+	glm::vec4 Tangent;
+	float Weights[4];
+	glm::uint16 Indices[4];
+};
+
+// Interleaved vertices with four influences each, compared with the usual loop of weighted mat4 * vec4 products
+static int launch_linear_blend(std::size_t Bones, std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::mat4> Palette(Bones);
+	std::vector<glm::faffine> AffinePalette(Bones);
+	for(std::size_t i = 0; i < Bones; ++i)
+	{
+		AffinePalette[i] = glm::faffine(glm::mat3_cast(glm::angleAxis(glm::linearRand(-3.0f, 3.0f), glm::sphericalRand(1.0f))), glm::linearRand(glm::vec3(-1), glm::vec3(1)));
+		Palette[i] = glm::mat4_cast(AffinePalette[i]);
+	}
+
+	std::vector<vertex> Vertices(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		glm::vec4 const w = glm::linearRand(glm::vec4(0.0f), glm::vec4(1.0f));
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			Vertices[i].Indices[k] = static_cast<glm::uint16>(glm::linearRand(0, static_cast<int>(Bones) - 1));
+			Vertices[i].Weights[k] = w[k] / (w.x + w.y + w.z + w.w);
+		}
+		Vertices[i].Position = glm::linearRand(glm::vec3(-1), glm::vec3(1));
+		Vertices[i].Normal = glm::sphericalRand(1.0f);
+		Vertices[i].Tangent = glm::vec4(glm::sphericalRand(1.0f), 1.0f);
+	}
+
+	std::vector<glm::vec3> LoopPositions(Samples), LoopNormals(Samples), LoopTangents(Samples);
+	std::vector<glm::vec3> BatchPositions(Samples), BatchNormals(Samples), BatchTangents(Samples);
+	std::vector<glm::vec3> ParallelPositions(Samples), ParallelNormals(Samples), ParallelTangents(Samples);
+
+	std::size_t const Stride = sizeof(vertex);
+	glm::skinning_streams<float, glm::defaultp, glm::uint16> Streams;
+	Streams.indices = glm::vertex_stream<glm::uint16 const>(&Vertices[0].Indices[0], Stride);
+	Streams.weights = glm::vertex_stream<float const>(&Vertices[0].Weights[0], Stride);
+	Streams.influences = 4;
+	Streams.positions = glm::vertex_stream<glm::vec3 const>(&Vertices[0].Position, Stride);
+	Streams.normals = glm::vertex_stream<glm::vec3 const>(&Vertices[0].Normal, Stride);
+	Streams.tangents = glm::vertex_stream<glm::vec3 const>(reinterpret_cast<glm::vec3 const*>(&Vertices[0].Tangent), Stride);
+	Streams.outPositions = glm::vertex_stream<glm::vec3>(&BatchPositions[0]);
+	Streams.outNormals = glm::vertex_stream<glm::vec3>(&BatchNormals[0]);
+	Streams.outTangents = glm::vertex_stream<glm::vec3>(&BatchTangents[0]);
+
+	glm::skinning_streams<float, glm::defaultp, glm::uint16> ParallelStreams(Streams);
+	ParallelStreams.outPositions = glm::vertex_stream<glm::vec3>(&ParallelPositions[0]);
+	ParallelStreams.outNormals = glm::vertex_stream<glm::vec3>(&ParallelNormals[0]);
+	ParallelStreams.outTangents = glm::vertex_stream<glm::vec3>(&ParallelTangents[0]);
+
+	unsigned const Threads = std::max(std::thread::hardware_concurrency(), 1u);
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		vertex const& Vertex = Vertices[i];
+		glm::vec4 Position(0.0f), Normal(0.0f), Tangent(0.0f);
+		for(glm::length_t k = 0; k < 4; ++k)
+		{
+			glm::mat4 const& Bone = Palette[Vertex.Indices[k]];
+			Position += Bone * glm::vec4(Vertex.Position, 1.0f) * Vertex.Weights[k];
+			Normal += Bone * glm::vec4(Vertex.Normal, 0.0f) * Vertex.Weights[k];
+			Tangent += Bone * glm::vec4(glm::vec3(Vertex.Tangent), 0.0f) * Vertex.Weights[k];
+		}
+		LoopPositions[i] = glm::vec3(Position);
+		LoopNormals[i] = glm::vec3(Normal);
+		LoopTangents[i] = glm::vec3(Tangent);
+	}
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::linearBlendSkinning(&AffinePalette[0], Streams, Samples);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::linearBlendSkinningParallel(&AffinePalette[0], ParallelStreams, Samples, Threads);
+	perf_clock::time_point const t3 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(LoopPositions[i], BatchPositions[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopNormals[i], BatchNormals[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopTangents[i], BatchTangents[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(BatchPositions[i], ParallelPositions[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(BatchTangents[i], ParallelTangents[i], 0.001f)) ? 0 : 1;
+	}
+
+	printf("%d bones, %d vertices x %d, ns per vertex:\n", static_cast<int>(Bones), static_cast<int>(Samples), static_cast<int>(Iterations));
+	printf("- weighted mat4 * vec4 loop: %.2f\n", nanoseconds_per_element(t0, t1, Elements));
+	printf("- linearBlendSkinning: %.2f\n", nanoseconds_per_element(t1, t2, Elements));
+	printf("- linearBlendSkinningParallel %d threads: %.2f\n", static_cast<int>(Threads), nanoseconds_per_element(t2, t3, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_dual_quaternion(64, 16384, 64);
+	Error += launch_linear_blend(64, 16384, 64);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
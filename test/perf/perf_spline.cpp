@@ -0,0 +1,87 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/vector_relational.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/spline.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// A camera path through control points, sampled at many parameters
+static int launch_spline(std::size_t Points, std::size_t Samples, std::size_t Iterations)
+{
+	int Error = 0;
+
+	std::vector<glm::vec3> ControlPoints(Points);
+	for(std::size_t i = 0; i < Points; ++i)
+		ControlPoints[i] = glm::vec3(static_cast<float>(i), 0.0f, 0.0f) + glm::ballRand(2.0f);
+
+	glm::cubic_spline<3, float> Spline;
+	glm::buildCatmullRomSpline(Spline, &ControlPoints[0], Points);
+
+	std::vector<float> u(Samples);
+	for(std::size_t i = 0; i < Samples; ++i)
+		u[i] = static_cast<float>(Points - 1) * static_cast<float>(i) / static_cast<float>(Samples);
+
+	std::vector<glm::vec3> Loop(Samples), Batch(Samples), LoopDerivatives(Samples), BatchDerivatives(Samples);
+
+	std::size_t const Elements = Samples * Iterations;
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		std::size_t const k = glm::min(static_cast<std::size_t>(u[i]), Points - 2);
+		Loop[i] = glm::catmullRom(ControlPoints[k > 0 ? k - 1 : 0], ControlPoints[k], ControlPoints[k + 1], ControlPoints[glm::min(k + 2, Points - 1)], u[i] - static_cast<float>(k));
+	}
+	perf_clock::time_point const t1 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::sampleSpline(Spline, &u[0], Samples, &Batch[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		std::size_t const k = glm::min(static_cast<std::size_t>(u[i]), Points - 2);
+		float const s = u[i] - static_cast<float>(k);
+		float const h = 0.01f;
+		glm::vec3 const& v1 = ControlPoints[k > 0 ? k - 1 : 0];
+		glm::vec3 const& v4 = ControlPoints[glm::min(k + 2, Points - 1)];
+		LoopDerivatives[i] = (glm::catmullRom(v1, ControlPoints[k], ControlPoints[k + 1], v4, s + h) - glm::catmullRom(v1, ControlPoints[k], ControlPoints[k + 1], v4, s - h)) / (2.0f * h);
+	}
+	perf_clock::time_point const t3 = perf_clock::now();
+	for(std::size_t j = 0; j < Iterations; ++j)
+		glm::sampleSplineDerivative(Spline, &u[0], Samples, &BatchDerivatives[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+
+	for(std::size_t i = 0; i < Samples; ++i)
+	{
+		Error += glm::all(glm::equal(Loop[i], Batch[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(LoopDerivatives[i], BatchDerivatives[i], 0.1f)) ? 0 : 1;
+	}
+
+	printf("%d samples of a curve of %d points x %d, ns per sample:\n", static_cast<int>(Samples), static_cast<int>(Points), static_cast<int>(Iterations));
+	printf("- catmullRom: %.2f, sampleSpline: %.2f\n", nanoseconds_per_element(t0, t1, Elements), nanoseconds_per_element(t1, t2, Elements));
+	printf("- catmullRom central difference: %.2f, sampleSplineDerivative: %.2f\n", nanoseconds_per_element(t2, t3, Elements), nanoseconds_per_element(t3, t4, Elements));
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_spline(1000, 1 << 16, 64);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif
@@ -0,0 +1,93 @@
+#define GLM_FORCE_INLINE
+#define GLM_ENABLE_EXPERIMENTAL
+#include <glm/glm.hpp>
+#include <glm/ext/matrix_relational.hpp>
+#include <glm/ext/matrix_transform.hpp>
+#include <glm/gtc/random.hpp>
+#include <glm/gtx/transform_hierarchy.hpp>
+#if GLM_HAS_CXX11_STL
+#include <vector>
+#include <cstdio>
+#include "perf_clock.hpp"
+
+// Typical scene graph update loop
+static void propagate_loop(std::vector<glm::int32> const& Parents, std::vector<glm::mat4> const& Locals, std::vector<glm::mat4>& Worlds)
+{
+	for(std::size_t i = 0, n = Parents.size(); i < n; ++i)
+		Worlds[i] = Parents[i] < 0 ? Locals[i] : Worlds[Parents[i]] * Locals[i];
+}
+
+static int launch_hierarchy(std::size_t Count, unsigned Threads)
+{
+	int Error = 0;
+
+	// Breadth first hierarchy with a branching factor of about four
+	std::vector<glm::int32> Parents(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+		Parents[i] = i < 16 ? -1 : static_cast<glm::int32>((i - 16) / 4);
+
+	std::vector<glm::mat4> Locals(Count);
+	std::vector<glm::faffine> AffineLocals(Count);
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Locals[i] = glm::rotate(glm::translate(glm::mat4(1.0f), glm::linearRand(glm::vec3(-1), glm::vec3(1))), glm::linearRand(-0.5f, 0.5f), glm::sphericalRand(1.0f));
+		AffineLocals[i] = glm::faffine(Locals[i]);
+	}
+
+	std::vector<std::size_t> Levels;
+	Error += glm::transformHierarchyLevels(&Parents[0], Count, Levels) ? 0 : 1;
+
+	// A node out of 100 changed
+	std::vector<glm::uint32> Dirty((Count + 31) / 32, 0);
+	for(std::size_t i = 0; i < Count; i += 100)
+		Dirty[i / 32] |= 1u << (i % 32);
+
+	std::vector<glm::mat4> Loop(Count), Worlds(Count), Parallel(Count);
+	std::vector<glm::faffine> AffineWorlds(Count);
+
+	perf_clock::time_point const t0 = perf_clock::now();
+	propagate_loop(Parents, Locals, Loop);
+	perf_clock::time_point const t1 = perf_clock::now();
+	glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Worlds[0]);
+	perf_clock::time_point const t2 = perf_clock::now();
+	glm::propagateTransforms(&Parents[0], &AffineLocals[0], Count, &AffineWorlds[0]);
+	perf_clock::time_point const t3 = perf_clock::now();
+	std::size_t const Updated = glm::propagateTransforms(&Parents[0], &Locals[0], Count, &Dirty[0], &Worlds[0]);
+	perf_clock::time_point const t4 = perf_clock::now();
+	glm::propagateTransformsParallel(&Parents[0], &Locals[0], Levels, static_cast<glm::uint32*>(GLM_NULLPTR), &Parallel[0], Threads);
+	perf_clock::time_point const t5 = perf_clock::now();
+
+	printf("%d nodes, %d levels:\n", static_cast<int>(Count), static_cast<int>(Levels.size() - 1));
+	printf("- world = parent * local loop: %d us\n", microseconds(t0, t1));
+	printf("- propagateTransforms mat4: %d us\n", microseconds(t1, t2));
+	printf("- propagateTransforms affine: %d us\n", microseconds(t2, t3));
+	printf("- propagateTransforms dirty (%d updated): %d us\n", static_cast<int>(Updated), microseconds(t3, t4));
+	printf("- propagateTransformsParallel %d threads: %d us\n", static_cast<int>(Threads), microseconds(t4, t5));
+
+	for(std::size_t i = 0; i < Count; ++i)
+	{
+		Error += glm::all(glm::equal(Loop[i], Worlds[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Loop[i], Parallel[i], 0.001f)) ? 0 : 1;
+		Error += glm::all(glm::equal(Loop[i], glm::mat4_cast(AffineWorlds[i]), 0.001f)) ? 0 : 1;
+	}
+
+	return Error;
+}
+
+int main()
+{
+	int Error = 0;
+
+	Error += launch_hierarchy(1000000, 4);
+
+	return Error;
+}
+
+#else
+
+int main()
+{
+	return 0;
+}
+
+#endif